@@ -0,0 +1,31 @@
+#include "core/CpuFeatures.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+namespace core::cpu
+{
+namespace
+{
+    bool detectSsse3()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        int regs[4] = {};
+        __cpuid(regs, 1);
+        return (regs[2] & (1 << 9)) != 0;   // ECX bit 9
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+#else
+        return false;
+#endif
+    }
+}
+
+bool hasSsse3()
+{
+    static const bool s = detectSsse3();
+    return s;
+}
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace core::cpu
+{
+// Laufzeit-Erkennung der CPU-Erweiterungen (cpuid, einmal pro Prozess).
+// SIMD-Kernel liegen in eigenen Translation Units mit passenden ISA-Flags
+// und werden nur aufgerufen, wenn die CPU sie tatsächlich kann.
+bool hasSsse3();
+}
@@ -1,4 +1,5 @@
 #include "core/Log.h"
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 
@@ -10,33 +11,285 @@ Log& Log::instance()
     return s;
 }
 
+Log::Log()
+    : m_ring(std::make_unique<Slot[]>(kRingSize))
+{
+    for (std::size_t i = 0; i < kRingSize; ++i)
+        m_ring[i].seq.store(i, std::memory_order_relaxed);
+
+    m_messages.reserve(kHistory);
+    m_writer = std::thread([this] { writerLoop(); });
+}
+
+Log::~Log()
+{
+    // neue Aufrufe gehen an stderr, begonnene landen noch im Ring
+    m_stopped.store(true);
+    while (m_activeWriters.load() != 0)
+        std::this_thread::yield();
+
+    m_stop.store(true);
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wakeCv.notify_one();
+
+    if (m_writer.joinable())
+        m_writer.join();
+}
+
 // ---- bestehend ----
 void Log::enableFileLogging(const std::string& filePath)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_file.open(filePath, std::ios::app);
-    fileLogging = m_file.is_open();
+    {
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        m_file.open(filePath, std::ios::app);
+        fileLogging = m_file.is_open();
+    }
     if (fileLogging) info("File logging enabled: " + filePath);
 }
 
-void Log::info (const std::string& msg) { instance().write(LogLevel::Info, msg); }
-void Log::warn (const std::string& msg) { instance().write(LogLevel::Warning, msg); }
-void Log::error(const std::string& msg) { instance().write(LogLevel::Error, msg); }
+void Log::info (const std::string& msg) { instance().write(Channel::Info, msg); }
+void Log::warn (const std::string& msg) { instance().write(Channel::Warning, msg); }
+void Log::error(const std::string& msg) { instance().write(Channel::Error, msg); }
 
-void Log::write(LogLevel level, const std::string& msg)
+std::vector<LogMessage> Log::messages() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    LogMessage entry { level, msg, nowString() };
-    m_messages.push_back(entry);
+    // älteste zuerst
+    std::vector<LogMessage> out;
+    out.reserve(m_messages.size());
+    out.insert(out.end(), m_messages.begin() + static_cast<std::ptrdiff_t>(m_messagesHead), m_messages.end());
+    out.insert(out.end(), m_messages.begin(), m_messages.begin() + static_cast<std::ptrdiff_t>(m_messagesHead));
+    return out;
+}
+
+void Log::write(Channel channel, const std::string& msg)
+{
+    // seq_cst mit ~Log: entweder sieht der Destruktor uns als aktiv oder wir m_stopped
+    m_activeWriters.fetch_add(1);
+    if (m_stopped.load())
+    {
+        m_activeWriters.fetch_sub(1);
+        writeDirect(channel, msg);
+        return;
+    }
+
+    const auto now = std::chrono::system_clock::now().time_since_epoch().count();
+
+    // Slot reservieren (MPSC, lock-free); voll -> Writer anstoßen und kurz warten
+    std::uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;)
+    {
+        slot = &m_ring[pos & (kRingSize - 1)];
+        const std::uint64_t seq = slot->seq.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::int64_t>(seq - pos);
+
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            wakeWriter();
+            std::this_thread::yield();
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->channel = channel;
+    slot->time = now;
+    slot->length = static_cast<std::uint32_t>(msg.size());
+    if (msg.size() <= kInlineText)
+        std::memcpy(slot->text, msg.data(), msg.size());
+    else
+        slot->longText = msg;
+
+    slot->seq.store(pos + 1, std::memory_order_release);
+
+    // nur der erste Producer weckt einen schlafenden Writer
+    if (m_writerSleeping.load(std::memory_order_relaxed) && m_writerSleeping.exchange(false))
+        wakeWriter();
+
+    m_activeWriters.fetch_sub(1, std::memory_order_release);
+}
+
+void Log::writeDirect(Channel channel, const std::string& msg)
+{
+    const char* p = channel == Channel::Warning       ? " [WARN] " :
+                    channel == Channel::Error         ? " [ERR ] " :
+                    channel == Channel::PipelineInfo  ? " [PIPE] " :
+                    channel == Channel::PipelineError ? " [PIPE][ERR] " : " [INFO] ";
+
+    std::string line = formatTime(std::chrono::system_clock::now().time_since_epoch().count());
+    line += p;
+    line += msg;
+    line += '\n';
+    std::cerr.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
+
+void Log::wakeWriter()
+{
+    m_wakeCv.notify_one();
+}
+
+bool Log::pending() const
+{
+    const Slot& s = m_ring[m_dequeuePos & (kRingSize - 1)];
+    return s.seq.load(std::memory_order_acquire) == m_dequeuePos + 1;
+}
+
+void Log::flush()
+{
+    Log& l = instance();
+    if (l.m_stopped.load())
+        return;   // Writer ist beendet, stderr ist ungepuffert
+
+    const std::uint64_t target = l.m_enqueuePos.load();
+
+    l.wakeWriter();
+    std::uint64_t done = l.m_writtenPos.load();
+    while (done < target)
+    {
+        l.m_writtenPos.wait(done);
+        done = l.m_writtenPos.load();
+    }
+}
+
+void Log::writerLoop()
+{
+    constexpr std::size_t kBatch = 512;
+
+    std::string console, file, pipe;
+    std::vector<LogMessage> history;
+
+    // strftime nur 1x pro Sekunde
+    std::int64_t lastSecond = -1;
+    std::string lastStamp;
 
-    const char* p = (level == LogLevel::Warning ? "[WARN]" :
-                         level == LogLevel::Error   ? "[ERR ]" : "[INFO]");
+    for (;;)
+    {
+        console.clear();
+        file.clear();
+        pipe.clear();
+        history.clear();
 
-    std::cout << entry.timestamp << " " << p << " " << msg << std::endl;
+        std::size_t n = 0;
+        while (n < kBatch && pending())
+        {
+            Slot& s = m_ring[m_dequeuePos & (kRingSize - 1)];
 
-    if (fileLogging)
-        m_file << entry.timestamp << " " << p << " " << msg << "\n";
+            const std::string_view text = s.length <= kInlineText
+                ? std::string_view(s.text, s.length)
+                : std::string_view(s.longText);
+
+            const auto second = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::duration(s.time)).count();
+            if (second != lastSecond)
+            {
+                lastSecond = second;
+                lastStamp = formatTime(s.time);
+            }
+
+            switch (s.channel)
+            {
+            case Channel::PipelineInfo:
+            case Channel::PipelineError:
+                // kein m_messages, kein stdout
+                pipe += lastStamp;
+                pipe += s.channel == Channel::PipelineError ? " [PIPE][ERR] " : " [PIPE] ";
+                pipe += text;
+                pipe += '\n';
+                break;
+
+            default:
+            {
+                const LogLevel level = s.channel == Channel::Warning ? LogLevel::Warning :
+                                       s.channel == Channel::Error   ? LogLevel::Error : LogLevel::Info;
+                const char* p = (level == LogLevel::Warning ? "[WARN]" :
+                                 level == LogLevel::Error   ? "[ERR ]" : "[INFO]");
+
+                const std::size_t begin = console.size();
+                console += lastStamp;
+                console += ' ';
+                console += p;
+                console += ' ';
+                console += text;
+                console += '\n';
+                file.append(console, begin, std::string::npos);
+
+                history.push_back({ level, std::string(text), lastStamp });
+                break;
+            }
+            }
+
+            if (s.length > kInlineText)
+                std::string().swap(s.longText);
+
+            s.seq.store(m_dequeuePos + kRingSize, std::memory_order_release);
+            ++m_dequeuePos;
+            ++n;
+        }
+
+        if (n == 0)
+        {
+            if (m_stop.load())
+                break;
+
+            // Producer wecken nur, wenn wir schlafen; Timeout fängt verpasste Signale ab
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_writerSleeping.store(true);
+            if (!pending() && !m_stop.load())
+                m_wakeCv.wait_for(lock, std::chrono::milliseconds(10));
+            m_writerSleeping.store(false);
+            continue;
+        }
+
+        // --- Batch schreiben ---
+        if (!console.empty())
+        {
+            std::cout.write(console.data(), static_cast<std::streamsize>(console.size()));
+            std::cout.flush();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            if (fileLogging && !file.empty())
+            {
+                m_file.write(file.data(), static_cast<std::streamsize>(file.size()));
+                m_file.flush();
+            }
+            if (pipelineLogging.load() && !pipe.empty())
+                m_pipelineFile.write(pipe.data(), static_cast<std::streamsize>(pipe.size()));
+        }
+
+        if (!history.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& m : history)
+            {
+                if (m_messages.size() < kHistory)
+                {
+                    m_messages.push_back(std::move(m));
+                }
+                else
+                {
+                    m_messages[m_messagesHead] = std::move(m);
+                    m_messagesHead = (m_messagesHead + 1) % kHistory;
+                }
+            }
+        }
+
+        m_writtenPos.store(m_dequeuePos);
+        m_writtenPos.notify_all();
+    }
 }
 
 // =====================================================
@@ -48,53 +301,50 @@ void Log::enablePipelineLogging(const std::string& filePath)
     Log& l = instance();
 
     // bewusst KEIN cout / KEIN info()
-    std::lock_guard<std::mutex> lock(l.m_mutex);
+    flush();
+    std::lock_guard<std::mutex> lock(l.m_fileMutex);
     l.m_pipelineFile.open(filePath, std::ios::out | std::ios::trunc);
-    l.pipelineLogging = l.m_pipelineFile.is_open();
+    l.pipelineLogging.store(l.m_pipelineFile.is_open());
 }
 
 void Log::disablePipelineLogging()
 {
     Log& l = instance();
-    std::lock_guard<std::mutex> lock(l.m_mutex);
+
+    // bereits eingereihte Pipeline-Zeilen noch schreiben
+    flush();
+    std::lock_guard<std::mutex> lock(l.m_fileMutex);
 
     if (l.m_pipelineFile.is_open())
         l.m_pipelineFile.close();
 
-    l.pipelineLogging = false;
+    l.pipelineLogging.store(false);
 }
 
 void Log::pipelineInfo(const std::string& msg)
 {
     Log& l = instance();
-    if (!l.pipelineLogging)
+    // Parser/Decoder laufen parallel auf dem TaskSystem -> nur einreihen
+    if (!l.pipelineLogging.load(std::memory_order_relaxed))
         return;
 
-    // kein m_messages, kein stdout
-    l.m_pipelineFile
-        << l.nowString()
-        << " [PIPE] "
-        << msg
-        << '\n';
+    l.write(Channel::PipelineInfo, msg);
 }
 
 void Log::pipelineError(const std::string& msg)
 {
     Log& l = instance();
-    if (!l.pipelineLogging)
+    if (!l.pipelineLogging.load(std::memory_order_relaxed))
         return;
 
-    l.m_pipelineFile
-        << l.nowString()
-        << " [PIPE][ERR] "
-        << msg
-        << '\n';
+    l.write(Channel::PipelineError, msg);
 }
 
-std::string Log::nowString()
+std::string Log::formatTime(std::int64_t ticks)
 {
     using namespace std::chrono;
-    auto t = system_clock::to_time_t(system_clock::now());
+    const system_clock::time_point tp{ system_clock::duration(ticks) };
+    auto t = system_clock::to_time_t(tp);
     std::tm tm{};
     localtime_s(&tm, &t);
 
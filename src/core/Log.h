@@ -5,6 +5,11 @@
 #include <fstream>
 #include <chrono>
 #include <sstream>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <thread>
 
 namespace core
 {
@@ -24,6 +29,12 @@ struct LogMessage
     std::string timestamp;
 };
 
+// Asynchron: Aufrufer schreiben nur in einen lock-freien MPSC-Ring
+// (Zeitstempel + Text kopieren), ein Writer-Thread formatiert, schreibt
+// gebündelt nach stdout/Datei/Pipeline-Datei und füllt den UI-Verlauf.
+// Ist der Ring voll, warten Aufrufer kurz (nichts geht verloren).
+// Nach ~Log (z.B. Log:: aus anderen statischen Destruktoren) geht jede
+// Zeile direkt und ungepuffert nach stderr.
 class Log
 {
 public:
@@ -32,11 +43,15 @@ public:
     // ---- bestehend ----
     static void info(const std::string& msg);
     static void warn(const std::string& msg);
-    static void error(const std::string& msg);  
+    static void error(const std::string& msg);
 
-    const std::vector<LogMessage>& messages() const { return m_messages; }
+    // Verlauf für die UI (begrenzt auf kHistory Einträge, älteste fallen raus)
+    std::vector<LogMessage> messages() const;
     void enableFileLogging(const std::string& filePath);
 
+    // blockiert, bis alles bis zu diesem Aufruf geschrieben ist
+    static void flush();
+
     // =====================================================
     // 🔥 ADD: Pipeline / High-Volume Logging
     // =====================================================
@@ -45,16 +60,61 @@ public:
     static void pipelineInfo(const std::string& msg);
     static void pipelineError(const std::string& msg);
 
+    ~Log();
+
 private:
-    Log() = default;
+    Log();
+
+    enum class Channel : std::uint8_t { Info, Warning, Error, PipelineInfo, PipelineError };
+
+    static constexpr std::size_t kRingSize = 4096;       // Zweierpotenz
+    static constexpr std::size_t kInlineText = 200;      // längere Texte liegen in longText
+    static constexpr std::size_t kHistory = 2000;
+
+    // Vyukov: seq == pos -> frei für Producer, seq == pos + 1 -> gefüllt
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint64_t> seq{ 0 };
+        Channel channel = Channel::Info;
+        std::int64_t time = 0;                 // system_clock ticks
+        std::uint32_t length = 0;
+        char text[kInlineText];
+        std::string longText;
+    };
 
     // ---- bestehend ----
-    void write(LogLevel level, const std::string& msg);
-    std::string nowString();
+    void write(Channel channel, const std::string& msg);
+    static void writeDirect(Channel channel, const std::string& msg);
+
+    // Writer-Thread
+    void writerLoop();
+    bool pending() const;
+    void wakeWriter();
+    static std::string formatTime(std::int64_t ticks);
+
+    std::unique_ptr<Slot[]> m_ring;
+    alignas(64) std::atomic<std::uint64_t> m_enqueuePos{ 0 };
+    alignas(64) std::uint64_t m_dequeuePos = 0;          // nur Writer
+    std::atomic<std::uint64_t> m_writtenPos{ 0 };        // für flush()
+
+    std::thread m_writer;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCv;
+    std::atomic<bool> m_writerSleeping{ false };
+    std::atomic<bool> m_stop{ false };
+
+    // Shutdown: ab m_stopped schreibt write() nach stderr; ~Log wartet,
+    // bis laufende write()-Aufrufe ihren Slot veröffentlicht haben
+    std::atomic<bool> m_stopped{ false };
+    alignas(64) std::atomic<std::uint32_t> m_activeWriters{ 0 };
 
+    // UI-Verlauf (Ring)
     std::vector<LogMessage> m_messages;
-    std::mutex m_mutex;
+    std::size_t m_messagesHead = 0;
+    mutable std::mutex m_mutex;
 
+    // Dateien: nur Writer schreibt, enable/disable öffnen/schließen
+    std::mutex m_fileMutex;
     std::ofstream m_file;
     bool fileLogging = false;
 
@@ -62,6 +122,6 @@ private:
     // 🔥 ADD: Pipeline intern
     // =====================================================
     std::ofstream m_pipelineFile;
-    bool pipelineLogging = false;
+    std::atomic<bool> pipelineLogging{ false };
 };
 }
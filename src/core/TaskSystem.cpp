@@ -1 +1,137 @@
-// Auto-generated placeholder for Flyff framework skeleton
+#include "core/TaskSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace core
+{
+TaskSystem& TaskSystem::instance()
+{
+    static TaskSystem s;
+    return s;
+}
+
+TaskSystem::TaskSystem(std::size_t workerCount)
+{
+    if (workerCount == 0)
+    {
+        const unsigned hw = std::thread::hardware_concurrency();
+        workerCount = (hw > 1) ? static_cast<std::size_t>(hw - 1) : 1;
+    }
+
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+        m_workers.emplace_back([this] { workerLoop(); });
+}
+
+TaskSystem::~TaskSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_workers)
+        if (t.joinable())
+            t.join();
+}
+
+void TaskSystem::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.emplace_back(std::move(task));
+    }
+    m_cv.notify_one();
+}
+
+void TaskSystem::workerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+
+            if (m_stop && m_queue.empty())
+                return;
+
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
+
+void TaskSystem::parallelFor(std::size_t count,
+                             std::size_t grain,
+                             const std::function<void(std::size_t, std::size_t)>& fn,
+                             std::size_t maxConcurrency)
+{
+    if (count == 0)
+        return;
+
+    if (grain == 0)
+        grain = 1;
+
+    const std::size_t chunkCount = (count + grain - 1) / grain;
+
+    std::size_t concurrency = (maxConcurrency == 0) ? (workerCount() + 1) : maxConcurrency;
+    concurrency = std::min(concurrency, chunkCount);
+
+    if (concurrency <= 1)
+    {
+        fn(0, count);
+        return;
+    }
+
+    // Geteilter Zustand: Helfer, die erst nach Ende starten, finden keine
+    // Blöcke mehr und beenden sich sofort (daher shared_ptr statt Stack).
+    struct Shared
+    {
+        std::atomic<std::size_t> nextChunk{ 0 };
+        std::size_t doneChunks = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    auto shared = std::make_shared<Shared>();
+
+    auto runChunks = [shared, &fn, count, grain, chunkCount]()
+    {
+        std::size_t done = 0;
+        for (;;)
+        {
+            const std::size_t c = shared->nextChunk.fetch_add(1);
+            if (c >= chunkCount)
+                break;
+
+            const std::size_t begin = c * grain;
+            const std::size_t end = std::min(count, begin + grain);
+            fn(begin, end);
+            ++done;
+        }
+
+        if (done > 0)
+        {
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            shared->doneChunks += done;
+            if (shared->doneChunks == chunkCount)
+                shared->cv.notify_all();
+        }
+    };
+
+    // 'fn' lebt nur bis zum Ende dieses Aufrufs. Helfer greifen nur darauf zu,
+    // solange sie einen Block geclaimt haben - und wir warten auf alle Blöcke.
+    for (std::size_t i = 0; i + 1 < concurrency; ++i)
+        submit(runChunks);
+
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(shared->mutex);
+    shared->cv.wait(lock, [&] { return shared->doneChunks == chunkCount; });
+}
+}
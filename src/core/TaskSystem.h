@@ -1 +1,53 @@
-// Auto-generated placeholder for Flyff framework skeleton
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core
+{
+// Fester Worker-Pool für CPU-/IO-lastige Pipeline-Schritte.
+//
+// - submit():      fire-and-forget Task
+// - parallelFor(): blockiert, der aufrufende Thread arbeitet mit
+//                  (damit ist auch ein verschachtelter Aufruf aus einem
+//                   Worker heraus deadlock-frei)
+class TaskSystem
+{
+public:
+    static TaskSystem& instance();
+
+    // workerCount == 0 -> hardware_concurrency() - 1 (mindestens 1)
+    explicit TaskSystem(std::size_t workerCount = 0);
+    ~TaskSystem();
+
+    TaskSystem(const TaskSystem&) = delete;
+    TaskSystem& operator=(const TaskSystem&) = delete;
+
+    std::size_t workerCount() const { return m_workers.size(); }
+
+    void submit(std::function<void()> task);
+
+    // Zerlegt [0,count) in Blöcke zu je 'grain' Elementen und ruft
+    // fn(begin, end) parallel auf. Kehrt erst zurück, wenn alle Blöcke fertig sind.
+    // maxConcurrency == 0 -> workerCount() + 1 (inkl. Aufrufer)
+    void parallelFor(std::size_t count,
+                     std::size_t grain,
+                     const std::function<void(std::size_t begin, std::size_t end)>& fn,
+                     std::size_t maxConcurrency = 0);
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_queue;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop = false;
+};
+}
@@ -0,0 +1,314 @@
+#include "core/asset/cache/ConversionCache.h"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace asset::cache
+{
+    namespace
+    {
+        // 64-bit Hash über 8-Byte-Wörter (murmur-artig), zwei Seeds -> 128 Bit.
+        // Kein Kryptohash: reicht zum Wiedererkennen, nicht gegen Angreifer.
+        constexpr std::uint64_t kMul1 = 0x9E3779B97F4A7C15ull;
+        constexpr std::uint64_t kMul2 = 0xC2B2AE3D27D4EB4Full;
+
+        inline std::uint64_t rotl(std::uint64_t v, int r)
+        {
+            return (v << r) | (v >> (64 - r));
+        }
+
+        inline std::uint64_t fmix(std::uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            h *= 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        std::uint64_t hashBytes(const std::uint8_t* p, std::size_t n, std::uint64_t seed)
+        {
+            std::uint64_t h = seed ^ (static_cast<std::uint64_t>(n) * kMul1);
+
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                std::uint64_t k;
+                std::memcpy(&k, p + i, 8);
+                k *= kMul2;
+                k = rotl(k, 31);
+                k *= kMul1;
+                h ^= k;
+                h = rotl(h, 27) * 5 + 0x52DCE729;
+            }
+
+            std::uint64_t tail = 0;
+            for (std::size_t t = 0; i + t < n; ++t)
+                tail |= static_cast<std::uint64_t>(p[i + t]) << (t * 8);
+            h ^= rotl(tail * kMul2, 31) * kMul1;
+
+            return fmix(h);
+        }
+
+        void appendHex(std::string& out, std::uint64_t v)
+        {
+            static const char* digits = "0123456789abcdef";
+            for (int s = 60; s >= 0; s -= 4)
+                out.push_back(digits[(v >> s) & 0xF]);
+        }
+    }
+
+    ConversionCache::ConversionCache(fs::path root)
+        : m_root(std::move(root))
+    {
+    }
+
+    std::string ConversionCache::hashSource(std::span<const std::uint8_t> source)
+    {
+        std::string hash;
+        hash.reserve(32);
+        appendHex(hash, hashBytes(source.data(), source.size(), 0x243F6A8885A308D3ull));
+        appendHex(hash, hashBytes(source.data(), source.size(), 0x13198A2E03707344ull));
+        return hash;
+    }
+
+    std::string ConversionCache::makeKey(std::string_view sourceHash,
+                                         std::string_view converterId,
+                                         std::uint32_t converterVersion,
+                                         std::string_view settingsTag)
+    {
+        // Meta (Id/Version/Settings) + Quellhash, wieder auf 128 Bit
+        std::string meta;
+        meta.reserve(sourceHash.size() + converterId.size() + settingsTag.size() + 16);
+        meta.append(sourceHash);
+        meta.push_back('\0');
+        meta.append(converterId);
+        meta.push_back('\0');
+        meta.append(std::to_string(converterVersion));
+        meta.push_back('\0');
+        meta.append(settingsTag);
+
+        return hashSource({ reinterpret_cast<const std::uint8_t*>(meta.data()), meta.size() });
+    }
+
+    void ConversionCache::rememberSource(const fs::path& sourceFile, std::uint64_t size, const std::string& hash)
+    {
+        std::error_code ec;
+        const auto t = fs::last_write_time(sourceFile, ec);
+        if (ec)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sources[sourceFile.generic_string()] = { size, static_cast<std::int64_t>(t.time_since_epoch().count()), hash };
+    }
+
+    bool ConversionCache::knownSourceHash(const fs::path& sourceFile, std::string& hash) const
+    {
+        std::error_code ec;
+        const std::uint64_t size = fs::file_size(sourceFile, ec);
+        if (ec)
+            return false;
+        const auto t = fs::last_write_time(sourceFile, ec);
+        if (ec)
+            return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sources.find(sourceFile.generic_string());
+        if (it == m_sources.end() || it->second.size != size ||
+            it->second.writeTime != static_cast<std::int64_t>(t.time_since_epoch().count()))
+            return false;
+
+        hash = it->second.hash;
+        return true;
+    }
+
+    fs::path ConversionCache::objectPath(const std::string& key, const fs::path& outFile) const
+    {
+        fs::path p = m_root / "objects" / key.substr(0, 2) / key;
+        p += outFile.extension();
+        return p;
+    }
+
+    bool ConversionCache::linkOrCopy(const fs::path& from, const fs::path& to, std::string* err)
+    {
+        std::error_code ec;
+        fs::create_directories(to.parent_path(), ec);
+
+        ec.clear();
+        fs::create_hard_link(from, to, ec);
+        if (!ec)
+            return true;
+
+        // z.B. anderes Laufwerk / FAT: Kopie statt Link
+        ec.clear();
+        fs::copy_file(from, to, fs::copy_options::overwrite_existing, ec);
+        if (ec)
+        {
+            if (err) *err = "ConversionCache: cannot link/copy " + from.string() + " -> " + to.string() + " (" + ec.message() + ")";
+            return false;
+        }
+        return true;
+    }
+
+    bool ConversionCache::isCurrent(const fs::path& outFile, const std::string& key) const
+    {
+        std::error_code ec;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_manifest.find(outFile.generic_string());
+        if (it == m_manifest.end() || it->second != key || !fs::exists(outFile, ec))
+            return false;
+
+        ++m_hits;
+        return true;
+    }
+
+    bool ConversionCache::restore(const fs::path& outFile, const std::string& key)
+    {
+        if (isCurrent(outFile, key))
+            return true;
+
+        const std::string outKey = outFile.generic_string();
+        std::error_code ec;
+
+        // Veraltete Ausgabe entfernen: sie kann ein Hardlink auf ein Objekt sein
+        // und darf daher nicht in-place überschrieben werden.
+        fs::remove(outFile, ec);
+
+        const fs::path obj = objectPath(key, outFile);
+        if (!fs::exists(obj, ec))
+            return false;
+
+        if (!linkOrCopy(obj, outFile, nullptr))
+            return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_manifest[outKey] = key;
+        ++m_dedupes;
+        return true;
+    }
+
+    bool ConversionCache::store(const fs::path& outFile, const std::string& key, std::string* err)
+    {
+        const fs::path obj = objectPath(key, outFile);
+        std::error_code ec;
+
+        {
+            // Objekt anlegen ist der einzige Wettlauf (gleiche Quelle, zwei Ziele)
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!fs::exists(obj, ec))
+            {
+                if (!linkOrCopy(outFile, obj, err))
+                    return false;
+            }
+            else if (!fs::equivalent(obj, outFile, ec))
+            {
+                // gleicher Inhalt existiert schon: Ausgabe durch Link ersetzen
+                fs::remove(outFile, ec);
+                if (!linkOrCopy(obj, outFile, err))
+                    return false;
+                ++m_dedupes;
+            }
+
+            m_manifest[outFile.generic_string()] = key;
+        }
+        return true;
+    }
+
+    bool ConversionCache::load(std::string* err)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_manifest.clear();
+        m_sources.clear();
+
+        std::ifstream f(m_root / "manifest.txt");
+        if (!f)
+            return true;
+
+        std::string line;
+        while (std::getline(f, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            // "S <hash> <size> <mtime> <sourceFile>"
+            if (line.size() > 2 && line[0] == 'S' && line[1] == ' ')
+            {
+                std::istringstream in(line.substr(2));
+                SourceStat st;
+                in >> st.hash >> st.size >> st.writeTime;
+                std::string path;
+                if (in.get() == ' ' && std::getline(in, path) && st.hash.size() == 32 && !path.empty())
+                    m_sources[path] = std::move(st);
+                continue;
+            }
+
+            // "<key> <outFile>" – Pfad darf Leerzeichen enthalten
+            const std::size_t sp = line.find(' ');
+            if (sp != 32 || line.size() <= sp + 1)
+                continue;
+
+            m_manifest[line.substr(sp + 1)] = line.substr(0, sp);
+        }
+
+        if (f.bad())
+        {
+            if (err) *err = "ConversionCache: cannot read manifest in " + m_root.string();
+            return false;
+        }
+        return true;
+    }
+
+    bool ConversionCache::save(std::string* err) const
+    {
+        std::error_code ec;
+        fs::create_directories(m_root, ec);
+
+        const fs::path path = m_root / "manifest.txt";
+        const fs::path tmp = m_root / "manifest.txt.tmp";
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+            if (!f)
+            {
+                if (err) *err = "ConversionCache: cannot write " + tmp.string();
+                return false;
+            }
+
+            for (const auto& [outFile, key] : m_manifest)
+                f << key << ' ' << outFile << '\n';
+            for (const auto& [sourceFile, st] : m_sources)
+                f << "S " << st.hash << ' ' << st.size << ' ' << st.writeTime << ' ' << sourceFile << '\n';
+
+            if (!f)
+            {
+                if (err) *err = "ConversionCache: write failed " + tmp.string();
+                return false;
+            }
+        }
+
+        fs::rename(tmp, path, ec);
+        if (ec)
+        {
+            if (err) *err = "ConversionCache: cannot replace " + path.string() + " (" + ec.message() + ")";
+            return false;
+        }
+        return true;
+    }
+
+    std::size_t ConversionCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hits;
+    }
+
+    std::size_t ConversionCache::dedupes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_dedupes;
+    }
+}
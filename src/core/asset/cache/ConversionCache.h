@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace asset::cache
+{
+    // Inhaltsadressierter Cache für Converter-Ausgaben.
+    //
+    // Schlüssel = Hash(Quellbytes) + Converter-Id/-Version + Settings-Tag.
+    // Layout unter root (typisch <assetCachePath>/.convcache):
+    //   objects/<2 hex>/<key><ext>   konvertierte Ausgabe, einmal pro Schlüssel
+    //   manifest.txt                 "<key> <outFile>" pro Zeile (zuletzt geschrieben)
+    //                                "S <hash> <size> <mtime> <source>" pro Quelle
+    //
+    // Der Quellhash wird mit Größe + Schreibzeit gemerkt: sind beide
+    // unverändert, ergibt sich der Schlüssel ohne die Quelle zu lesen.
+    //
+    // Ausgaben im Asset-Baum sind Hardlinks auf das Objekt (Fallback: Kopie),
+    // identische Quellen teilen sich so eine Datei auf der Platte.
+    // Alle Methoden sind thread-safe.
+    class ConversionCache
+    {
+    public:
+        explicit ConversionCache(std::filesystem::path root);
+
+        // Manifest laden/speichern; fehlendes Manifest ist kein Fehler.
+        bool load(std::string* err);
+        bool save(std::string* err) const;
+
+        // 128-bit Inhaltshash (32 hex)
+        static std::string hashSource(std::span<const std::uint8_t> source);
+
+        static std::string makeKey(std::string_view sourceHash,
+                                   std::string_view converterId,
+                                   std::uint32_t converterVersion,
+                                   std::string_view settingsTag);
+
+        // Hash zu gelesenen Quellbytes merken (Größe + aktuelle Schreibzeit)
+        void rememberSource(const std::filesystem::path& sourceFile, std::uint64_t size, const std::string& hash);
+
+        // bekannter Quellhash, wenn Größe und Schreibzeit unverändert sind
+        bool knownSourceHash(const std::filesystem::path& sourceFile, std::string& hash) const;
+
+        // Reine Abfrage: outFile existiert und wurde zuletzt mit key geschrieben
+        // oder verlinkt. Ändert nichts auf der Platte (zählt nur Treffer).
+        bool isCurrent(const std::filesystem::path& outFile, const std::string& key) const;
+
+        // true -> outFile entspricht key (war aktuell oder wurde aus dem
+        // Objektspeicher verlinkt/kopiert). Bei false ist eine veraltete
+        // Ausgabe bereits entfernt, der Converter schreibt eine neue Datei
+        // (nie in einen bestehenden Hardlink hinein).
+        bool restore(const std::filesystem::path& outFile, const std::string& key);
+
+        // Nach erfolgreichem Schreiben: Ausgabe als Objekt übernehmen.
+        bool store(const std::filesystem::path& outFile, const std::string& key, std::string* err);
+
+        const std::filesystem::path& root() const { return m_root; }
+
+        std::size_t hits() const;
+        std::size_t dedupes() const;
+
+    private:
+        std::filesystem::path objectPath(const std::string& key, const std::filesystem::path& outFile) const;
+
+        static bool linkOrCopy(const std::filesystem::path& from, const std::filesystem::path& to, std::string* err);
+
+        std::filesystem::path m_root;
+
+        struct SourceStat
+        {
+            std::uint64_t size = 0;
+            std::int64_t writeTime = 0;   // file_time_type::rep
+            std::string hash;
+        };
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, std::string> m_manifest; // outFile (generic) -> key
+        std::unordered_map<std::string, SourceStat> m_sources;   // sourceFile (generic) -> Stat
+        mutable std::size_t m_hits = 0;
+        std::size_t m_dedupes = 0;
+    };
+}
@@ -1,4 +1,5 @@
 #include "AssetConverterBase.h"
+#include "core/asset/cache/ConversionCache.h"
 #include <fstream>
 
 namespace asset
@@ -29,7 +30,68 @@ bool AssetConverterBase::shouldSkipWrite(const fs::path& outFile) const
     return fs::exists(outFile);
 }
 
-bool AssetConverterBase::writeAllBytes(const fs::path& outFile, const std::vector<uint8_t>& bytes, std::string* err) const
+std::string AssetConverterBase::cacheKey(const fs::path& sourceFile,
+                                        std::span<const uint8_t> source,
+                                        std::string_view converterId,
+                                        std::uint32_t converterVersion,
+                                        std::string_view settingsTag) const
+{
+    if (!settings().cache)
+        return {};
+
+    const std::string hash = cache::ConversionCache::hashSource(source);
+    if (!sourceFile.empty())
+        settings().cache->rememberSource(sourceFile, source.size(), hash);
+
+    return cache::ConversionCache::makeKey(hash, converterId, converterVersion, settingsTag);
+}
+
+std::string AssetConverterBase::knownCacheKey(const fs::path& sourceFile,
+                                             std::string_view converterId,
+                                             std::uint32_t converterVersion,
+                                             std::string_view settingsTag) const
+{
+    std::string hash;
+    if (!settings().cache || sourceFile.empty() || !settings().cache->knownSourceHash(sourceFile, hash))
+        return {};
+    return cache::ConversionCache::makeKey(hash, converterId, converterVersion, settingsTag);
+}
+
+bool AssetConverterBase::isCurrent(const fs::path& outFile, const std::string& key) const
+{
+    if (!settings().cache || key.empty())
+        return shouldSkipWrite(outFile);
+
+    if (settings().overwriteExisting)
+        return false;
+
+    return settings().cache->isCurrent(outFile, key);
+}
+
+bool AssetConverterBase::isUpToDate(const fs::path& outFile, const std::string& key) const
+{
+    if (!settings().cache || key.empty())
+        return shouldSkipWrite(outFile);
+
+    if (settings().overwriteExisting)
+    {
+        // evtl. Hardlink auf ein Cache-Objekt -> lösen, nicht überschreiben
+        std::error_code ec;
+        fs::remove(outFile, ec);
+        return false;
+    }
+
+    return settings().cache->restore(outFile, key);
+}
+
+bool AssetConverterBase::commitToCache(const fs::path& outFile, const std::string& key, std::string* err) const
+{
+    if (!settings().cache || key.empty())
+        return true;
+    return settings().cache->store(outFile, key, err);
+}
+
+bool AssetConverterBase::writeAllBytes(const fs::path& outFile, std::span<const uint8_t> bytes, std::string* err) const
 {
     if (!ensureParentDir(outFile, err))
         return false;
@@ -1,12 +1,20 @@
 #pragma once
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include "core/asset/index/AssetIndexBuilder.h"
+#include "core/asset/writer/PngEncoder.h"
+#include "core/asset/writer/ModelWriter.h"
 
 namespace fs = std::filesystem;
 
 namespace asset
 {
+namespace cache { class ConversionCache; }
+
 struct ConvertResult
 {
     bool ok = false;
@@ -26,6 +34,28 @@ struct ConverterSettings
     // Effekt-Seeker Endung (falls du später sfx->efs oder ähnliches willst)
     // Wenn leer => Endung bleibt wie Input.
     std::string sfxTargetExtension; // z.B. ".efs"
+
+    // DDS-Ziel: PNG (voller RGBA-Decode) oder KTX2 (BC1-BC5 Blöcke + Mips
+    // unverändert umverpackt, kein Decode). Unkomprimierte DDS bleiben PNG.
+    enum class DdsMode
+    {
+        DecodeToPng,
+        PassthroughKtx2
+    };
+    DdsMode ddsMode = DdsMode::DecodeToPng;
+
+    // Farbraum für BC1-BC3 ohne DX10-Header im KTX2-Passthrough
+    bool ddsLegacySrgb = true;
+
+    // PNG-Ausgabe: Store/Fast zum Iterieren, Default/Best für Releases
+    PngEncoder::Level pngLevel = PngEncoder::Level::Default;
+
+    // GLB-Ausgabe: float-Attribute oder interleavt + KHR_mesh_quantization (2-3x kleiner)
+    writer::ModelWriter::Options glb;
+
+    // Optional: inhaltsadressierter Cache (Quellhash + Converter-Version + Settings).
+    // Gesetzt -> übersprungen wird genau bei Schlüsseltreffer, nicht bei "Datei existiert".
+    std::shared_ptr<cache::ConversionCache> cache;
 };
 
 class AssetConverterBase
@@ -48,8 +78,36 @@ protected:
 
     bool shouldSkipWrite(const fs::path& outFile) const;
 
+    // Cache-Schlüssel; leer, wenn kein Cache gesetzt ist.
+    // Merkt den Quellhash zu sourceFile (Größe + Schreibzeit) für knownCacheKey.
+    std::string cacheKey(const fs::path& sourceFile,
+                         std::span<const uint8_t> source,
+                         std::string_view converterId,
+                         std::uint32_t converterVersion,
+                         std::string_view settingsTag) const;
+
+    // Schlüssel ohne Lesen der Quelle; leer, wenn sourceFile seit dem
+    // letzten cacheKey() geändert wurde (oder kein Cache gesetzt ist)
+    std::string knownCacheKey(const fs::path& sourceFile,
+                              std::string_view converterId,
+                              std::uint32_t converterVersion,
+                              std::string_view settingsTag) const;
+
+    // Reine Abfrage, ändert nichts auf der Platte: true -> outFile ist aktuell.
+    // Ohne Cache/Schlüssel wie shouldSkipWrite, mit Cache nur Schlüsseltreffer.
+    bool isCurrent(const fs::path& outFile, const std::string& key) const;
+
+    // Schritt auf dem Convert-Pfad: true -> outFile ist aktuell, nichts zu tun.
+    // Ohne Cache/Schlüssel wie shouldSkipWrite; mit Cache Schlüsseltreffer oder
+    // Dedupe aus dem Objektspeicher (verlinkt/kopiert). Bei false ist eine
+    // veraltete Ausgabe entfernt (overwriteExisting erzwingt Neuerzeugung).
+    bool isUpToDate(const fs::path& outFile, const std::string& key) const;
+
+    // Nach erfolgreichem Schreiben aufrufen (no-op ohne Cache/Schlüssel)
+    bool commitToCache(const fs::path& outFile, const std::string& key, std::string* err) const;
+
     // File utils
-    bool writeAllBytes(const fs::path& outFile, const std::vector<uint8_t>& bytes, std::string* err) const;
+    bool writeAllBytes(const fs::path& outFile, std::span<const uint8_t> bytes, std::string* err) const;
     bool copyFile(const fs::path& src, const fs::path& dst, std::string* err) const;
 
 private:
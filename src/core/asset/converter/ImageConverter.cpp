@@ -1,52 +1,137 @@
 #include "ImageConverter.h"
 #include "core/asset/decoder/ImageDecoder.h"
-#include <stb_image_write.h>
-
-namespace
+#include "core/asset/writer/Ktx2Writer.h"
+namespace asset
 {
-bool writePngRGBA(
-    const std::filesystem::path& outPath,
-    int width,
-    int height,
-    const uint8_t* rgba,
-    std::string* error)
+std::string ImageConverter::settingsTag() const
 {
-    if (!rgba || width <= 0 || height <= 0)
+    // nur was die Ausgabebytes beeinflusst
+    return "dds=" + std::to_string(static_cast<int>(settings().ddsMode)) +
+           ";srgb=" + std::to_string(settings().ddsLegacySrgb ? 1 : 0) +
+           ";png=" + std::to_string(static_cast<int>(settings().pngLevel));
+}
+
+ConvertResult ImageConverter::convertDdsPassthrough(const ImageSource& src, const std::string& key, bool& handled) const
+{
+    ConvertResult r;
+    handled = false;
+
+    // Nur BCn-DDS; alles andere (auch unkomprimierte DDS) geht den PNG-Weg
+    DdsPayloadInfo info;
+    if (!DdsDecoder::describePayload(info, src.bytes, nullptr))
+        return r;
+
+    handled = true;
+
+    auto outKtx = src.outPath;
+    outKtx.replace_extension(".ktx2");
+
+    if (isUpToDate(outKtx, key))
     {
-        if (error) *error = "writePngRGBA: invalid image data";
-        return false;
+        r.ok = true;
+        return r;
     }
 
-    const int stride = width * 4;
+    std::string err;
+    if (!ensureParentDir(outKtx, &err))
+    {
+        r.ok = false;
+        r.error = err;
+        return r;
+    }
 
-    if (!stbi_write_png(
-            outPath.string().c_str(),
-            width,
-            height,
-            4,
-            rgba,
-            stride))
+    if (!writer::Ktx2Writer::writeFromDds(info, src.bytes.view(), outKtx, settings().ddsLegacySrgb, &err) ||
+        !commitToCache(outKtx, key, &err))
     {
-        if (error)
-            *error = "stbi_write_png failed: " + outPath.string();
-        return false;
+        r.ok = false;
+        r.error = err;
+        return r;
     }
 
-    return true;
+    r.ok = true;
+    return r;
 }
-} // anonymous namespace
 
-namespace asset
+bool ImageConverter::needsConversion(const ImageSource& src) const
 {
+    auto outPng = src.outPath;
+    outPng.replace_extension(".png");
+
+    if (settings().cache)
+    {
+        if (settings().overwriteExisting)
+            return true;
+
+        // Quelle seit dem letzten Lauf unverändert (Größe + Schreibzeit)?
+        const std::string key = knownCacheKey(src.sourcePath, "image", kCacheVersion, settingsTag());
+        if (key.empty())
+            return true;
+
+        // Passthrough-DDS landen als .ktx2 (BCn) oder .png (unkomprimiert)
+        if (settings().ddsMode == ConverterSettings::DdsMode::PassthroughKtx2 && src.format == ImageFormat::DDS)
+        {
+            auto outKtx = src.outPath;
+            outKtx.replace_extension(".ktx2");
+            if (isCurrent(outKtx, key))
+                return false;
+        }
+        return !isCurrent(outPng, key);
+    }
+
+    if (!shouldSkipWrite(outPng))
+    {
+        // Passthrough-DDS landen als .ktx2; ob die DDS BCn ist, zeigt erst der Inhalt
+        if (settings().ddsMode != ConverterSettings::DdsMode::PassthroughKtx2 || src.format != ImageFormat::DDS)
+            return true;
+
+        auto outKtx = src.outPath;
+        outKtx.replace_extension(".ktx2");
+        return !shouldSkipWrite(outKtx);
+    }
+    return false;
+}
+
+bool ImageConverter::restoreFromCache(const ImageSource& src) const
+{
+    if (!settings().cache || settings().overwriteExisting)
+        return false;
+
+    const std::string key = knownCacheKey(src.sourcePath, "image", kCacheVersion, settingsTag());
+    if (key.empty())
+        return false;
+
+    if (settings().ddsMode == ConverterSettings::DdsMode::PassthroughKtx2 && src.format == ImageFormat::DDS)
+    {
+        auto outKtx = src.outPath;
+        outKtx.replace_extension(".ktx2");
+        if (isUpToDate(outKtx, key))
+            return true;
+    }
+
+    auto outPng = src.outPath;
+    outPng.replace_extension(".png");
+    return isUpToDate(outPng, key);
+}
+
 ConvertResult ImageConverter::convert(const ImageSource& src) const
 {
     ConvertResult r;
 
+    const std::string key = cacheKey(src.sourcePath, src.bytes.view(), "image", kCacheVersion, settingsTag());
+
+    if (settings().ddsMode == ConverterSettings::DdsMode::PassthroughKtx2)
+    {
+        bool handled = false;
+        ConvertResult pr = convertDdsPassthrough(src, key, handled);
+        if (handled)
+            return pr;
+    }
+
     // 🔒 Quelle & Ziel kommen aus AssetSourceBase
     auto outPng = src.outPath;   // Kopie (nicht const)
     outPng.replace_extension(".png");
 
-    if (shouldSkipWrite(outPng))
+    if (isUpToDate(outPng, key))
     {
         r.ok = true;
         return r;
@@ -69,7 +154,11 @@ ConvertResult ImageConverter::convert(const ImageSource& src) const
         return r;
     }
 
-    if (!writePngRGBA(outPng, dec.width, dec.height, dec.rgba.data(), &err))
+    PngEncoder::Options png;
+    png.level = settings().pngLevel;
+
+    if (!PngEncoder::writeRGBA(outPng, dec.width, dec.height, dec.rgba.data(), png, &err) ||
+        !commitToCache(outPng, key, &err))
     {
         r.ok = false;
         r.error = err;
@@ -2,24 +2,35 @@
 #include "core/asset/converter/AssetConverterBase.h"
 #include "data/asset/source/ImageSource.h"
 #include "data/asset/decoded/DecodedImageData.h"
+#include "core/asset/writer/PngEncoder.h"
 
 namespace asset
 {
-// Adapter: hier dockst du an deine Custom STB-PNG-Write Funktion an.
-struct PngEncoder
-{
-    // Muss RGBA8 annehmen (w*h*4).
-    static bool writeRGBA(const std::filesystem::path& outPng,
-                          int w, int h,
-                          const std::vector<uint8_t>& rgba,
-                          std::string* err);
-};
-
 class ImageConverter : public AssetConverterBase
 {
 public:
     using AssetConverterBase::AssetConverterBase;
 
+    // Bei Änderungen am Ausgabeformat erhöhen (invalidiert den Cache)
+    static constexpr std::uint32_t kCacheVersion = 1;
+
     ConvertResult convert(const ImageSource& src) const;
+
+    // Kein Lesen der Quelle, keine Änderung auf der Platte: false, wenn
+    // convert() das Ziel ohnehin überspringen würde (overwriteExisting/
+    // shouldSkipWrite). Mit Cache über den gemerkten Quellhash, sofern Größe
+    // und Schreibzeit unverändert sind.
+    bool needsConversion(const ImageSource& src) const;
+
+    // Vor dem Lesen, wenn needsConversion() true liefert: Ausgabe aus dem
+    // Objektspeicher verlinken/kopieren (gemerkter Quellhash). true -> fertig,
+    // die Quelle muss nicht gelesen werden.
+    bool restoreFromCache(const ImageSource& src) const;
+
+private:
+    // DDS mit BCn-Payload -> .ktx2 ohne Decode; handled=false, wenn nicht möglich
+    ConvertResult convertDdsPassthrough(const ImageSource& src, const std::string& key, bool& handled) const;
+
+    std::string settingsTag() const;
 };
 } // namespace asset
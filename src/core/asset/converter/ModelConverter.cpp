@@ -62,7 +62,7 @@ namespace asset
         // }
 
         // 3) Write GLB (NormalizedMesh -> GLB)
-        // if (!asset::writer::ModelWriter::writeGlb(nmesh, outGlb, &err))
+        // if (!asset::writer::ModelWriter::writeGlb(nmesh, outGlb, m_settings.glb, &err))
         // {
         //     r.ok = false;
         //     r.error = err;
@@ -13,8 +13,12 @@ ConvertResult SfxConverter::convert(const SfxSource& src) const
     if (!settings().sfxTargetExtension.empty())
         out.replace_extension(settings().sfxTargetExtension);
 
-    // Skip, wenn Datei existiert und overwrite=false
-    if (shouldSkipWrite(out))
+    // Skip, wenn Datei existiert und overwrite=false (mit Cache: Schlüsseltreffer)
+    const std::string key = src.bytes.empty()
+        ? std::string{}
+        : cacheKey(src.sourcePath, src.bytes.view(), "sfx", kCacheVersion, settings().sfxTargetExtension);
+
+    if (isUpToDate(out, key))
     {
         r.ok = true;
         return r;
@@ -25,7 +29,7 @@ ConvertResult SfxConverter::convert(const SfxSource& src) const
     // 1) Bevorzugt: bereits geladene Bytes schreiben
     if (!src.bytes.empty())
     {
-        if (!writeAllBytes(out, src.bytes.bytes, &err))
+        if (!writeAllBytes(out, src.bytes.view(), &err) || !commitToCache(out, key, &err))
         {
             r.ok = false;
             r.error = "SfxConverter: writeAllBytes failed: " + err;
@@ -9,6 +9,8 @@ class SfxConverter : public AssetConverterBase
 public:
     using AssetConverterBase::AssetConverterBase;
 
+    static constexpr std::uint32_t kCacheVersion = 1;
+
     ConvertResult convert(const SfxSource& src) const;
 };
 } // namespace asset
@@ -1,163 +1,420 @@
 #include "AniDecoder.h"
 #include "data/asset/decoded/DecodedAniData.h"
 #include "asset/source/BinaryData.h"
+#include "core/asset/decoder/RefScanner.h"
+#include "core/asset/decoder/BinaryReader.h"
 
-#include <cctype>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 #include <vector>
-#include <algorithm>
 
 namespace asset
 {
-    static std::string toLowerLocal(std::string s)
+    static void classify(std::string s, DecodedAniData& out)
     {
-        for (char& c : s)
-            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-        return s;
-    }
-
-    static std::string normalizePathLike(std::string s)
-    {
-        for (char& c : s)
-            if (c == '\\') c = '/';
-        return s;
-    }
+        // Referenz: mindestens ein Punkt
+        if (s.find('.') == std::string::npos)
+            return;
 
-    static bool isPrintableAscii(std::uint8_t c)
-    {
-        return (c >= 32 && c <= 126);
-    }
+        if (RefScanner::classifyExtension(s) == RefExt::Model)
+        {
+            out.refModels.push_back(std::move(s));
+            return;
+        }
 
-    static bool endsWith(const std::string& s, const char* suffix)
-    {
-        const std::size_t sl = s.size();
-        const std::size_t tl = std::strlen(suffix);
-        if (sl < tl) return false;
-        return s.compare(sl - tl, tl, suffix) == 0;
-    }
+        // typische Skeleton-/Bone-Namen (sehr vorsichtig!)
+        if (s.find("bone") != std::string::npos ||
+            s.find("skel") != std::string::npos)
+        {
+            out.refSkeletons.push_back(std::move(s));
+            return;
+        }
 
-    static void pushUnique(std::vector<std::string>& out, std::unordered_set<std::string>& seen, const std::string& v)
-    {
-        if (v.empty()) return;
-        if (seen.insert(v).second)
-            out.push_back(v);
+        out.refOther.push_back(std::move(s));
     }
 
-    static bool looksLikeRef(const std::string& s)
+    // ==================================================
+    // Strukturierter Parser (CMotion-Layout)
+    // ==================================================
+    //
+    //   i32  version, i32 id, f32 perSlerp, [32] reserved
+    //   i32  boneCount, i32 frameCount
+    //   i32  hasPath  -> frameCount x vec3
+    //   boneCount x { i32 len, name[len], mat4 inverseTM, mat4 localTM, i32 parent }
+    //   i32  poolSize (= animierte Bones * frameCount)
+    //   boneCount x { i32 animated -> frameCount x { quat rot, vec3 pos } | mat4 localTM }
+    //   Rest (Attribute/Events) wird ignoriert.
+    namespace
     {
-        if (s.size() < 4) return false;
-        if (s.find('.') == std::string::npos) return false;
-        return true;
-    }
+        using decode::BinaryReader;
 
-    // Strategy 1: ASCII runs
-    static void extractAsciiRuns(const std::vector<std::uint8_t>& buf, std::vector<std::string>& out)
-    {
-        std::string cur;
-        cur.reserve(256);
+        constexpr std::int32_t kMaxBones = 1024;
+        constexpr std::int32_t kMaxFrames = 65535;   // Frame-Nummer als u16
+        constexpr std::int32_t kMaxBoneName = 64;
 
-        auto flush = [&]()
+        struct RawKey
         {
-            if (cur.size() >= 4)
-                out.push_back(cur);
-            cur.clear();
+            float rot[4]; // x y z w
+            float pos[3];
         };
 
-        for (std::uint8_t c : buf)
+        bool readFloats(BinaryReader& br, float* out, std::size_t n)
+        {
+            return br.readArray(out, n);
+        }
+
+        bool parseMotion(std::span<const std::uint8_t> bytes, DecodedAniData& out,
+                         std::vector<std::vector<RawKey>>& keys, std::string& err)
         {
-            if (c == 0)
+            BinaryReader br(bytes);
+
+            const auto version = br.readLE<std::int32_t>();
+            const auto id = br.readLE<std::int32_t>();
+            const auto perSlerp = br.readLE<float>();
+            if (!version || !id || !perSlerp || *version <= 0 || *version > 100)
+            {
+                err = "ANI: invalid motion header";
+                return false;
+            }
+
+            const auto boneCount = br.skip(32) ? br.readLE<std::int32_t>() : std::nullopt;
+            const auto frameCount = br.readLE<std::int32_t>();
+            const auto hasPath = br.readLE<std::int32_t>();
+            if (!boneCount || !frameCount || !hasPath ||
+                *boneCount <= 0 || *boneCount > kMaxBones ||
+                *frameCount <= 0 || *frameCount > kMaxFrames ||
+                (*hasPath != 0 && *hasPath != 1))
+            {
+                err = "ANI: invalid bone/frame count";
+                return false;
+            }
+
+            if (*hasPath && !br.skip(static_cast<std::size_t>(*frameCount) * 12))
+            {
+                err = "ANI: truncated path";
+                return false;
+            }
+
+            out.version = static_cast<std::uint32_t>(*version);
+            out.motionId = *id;
+            out.perSlerp = *perSlerp;
+            out.frameCount = static_cast<std::uint32_t>(*frameCount);
+            out.bones.resize(static_cast<std::size_t>(*boneCount));
+
+            for (AniBone& bone : out.bones)
+            {
+                const auto len = br.readLE<std::int32_t>();
+                const auto name = (len && *len > 0 && *len <= kMaxBoneName)
+                    ? br.readSpan(static_cast<std::size_t>(*len))
+                    : std::nullopt;
+                if (!name)
+                {
+                    err = "ANI: invalid bone name";
+                    return false;
+                }
+
+                const auto nul = std::find(name->begin(), name->end(), 0);
+                bone.name.assign(name->begin(), nul);
+
+                const bool tms = readFloats(br, bone.inverseTM, 16) && readFloats(br, bone.localTM, 16);
+                const auto parent = br.readLE<std::int32_t>();
+                if (!tms || !parent || *parent < -1 || *parent >= *boneCount)
+                {
+                    err = "ANI: truncated bone '" + bone.name + "'";
+                    return false;
+                }
+                bone.parent = *parent;
+            }
+
+            const auto poolSize = br.readLE<std::int32_t>();
+            if (!poolSize || *poolSize < 0)
             {
-                flush();
-                continue;
+                err = "ANI: invalid key pool size";
+                return false;
             }
 
-            if (isPrintableAscii(c))
+            keys.assign(out.bones.size(), {});
+            std::int64_t animatedKeys = 0;
+
+            for (std::size_t b = 0; b < out.bones.size(); ++b)
             {
-                cur.push_back((char)c);
-                if (cur.size() > 512)
-                    flush();
+                const auto animated = br.readLE<std::int32_t>();
+                if (!animated || (*animated != 0 && *animated != 1))
+                {
+                    err = "ANI: invalid frame flag for bone " + std::to_string(b);
+                    return false;
+                }
+
+                AniBone& bone = out.bones[b];
+                bone.animated = (*animated == 1);
+
+                if (!bone.animated)
+                {
+                    // statischer Bone: eigene Local-Matrix im Frame-Block
+                    if (!readFloats(br, bone.localTM, 16))
+                    {
+                        err = "ANI: truncated static bone " + std::to_string(b);
+                        return false;
+                    }
+                    continue;
+                }
+
+                if (static_cast<std::uint64_t>(*frameCount) * 28 > br.remaining())
+                {
+                    err = "ANI: truncated keys for bone " + std::to_string(b);
+                    return false;
+                }
+
+                keys[b].resize(static_cast<std::size_t>(*frameCount));
+                for (RawKey& k : keys[b])
+                {
+                    if (!readFloats(br, k.rot, 4) || !readFloats(br, k.pos, 3))
+                    {
+                        err = "ANI: truncated keys for bone " + std::to_string(b);
+                        return false;
+                    }
+                }
+
+                animatedKeys += *frameCount;
             }
-            else
+
+            if (animatedKeys != *poolSize)
             {
-                flush();
+                err = "ANI: key pool size mismatch";
+                return false;
             }
+            return true;
         }
-        flush();
-    }
 
-    static void classify(
-        const std::string& s,
-        DecodedAniData& out,
-        std::unordered_set<std::string>& seenSkel,
-        std::unordered_set<std::string>& seenModel,
-        std::unordered_set<std::string>& seenOther)
-    {
-        if (endsWith(s, ".o3d") || endsWith(s, ".ase"))
+        // Vorzeichen fortlaufend halten (q und -q sind dieselbe Rotation) + normalisieren
+        void conditionRotations(std::vector<RawKey>& keys)
         {
-            pushUnique(out.refModels, seenModel, s);
-            return;
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                float* q = keys[i].rot;
+                const float len = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+                if (len > 0.0f)
+                    for (int c = 0; c < 4; ++c) q[c] /= len;
+                else
+                    q[0] = q[1] = q[2] = 0.0f, q[3] = 1.0f;
+
+                if (i > 0)
+                {
+                    const float* p = keys[i - 1].rot;
+                    if (p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3] < 0.0f)
+                        for (int c = 0; c < 4; ++c) q[c] = -q[c];
+                }
+            }
         }
 
-        // typische Skeleton-/Bone-Namen (sehr vorsichtig!)
-        if (s.find("bone") != std::string::npos ||
-            s.find("skel") != std::string::npos ||
-            s.find("skeleton") != std::string::npos)
+        void selectKeys(const std::vector<RawKey>& keys, const AniDecoder::DecodeOptions& opts, std::vector<std::uint32_t>& outIdx)
         {
-            pushUnique(out.refSkeletons, seenSkel, s);
-            return;
+            outIdx.clear();
+            const std::size_t n = keys.size();
+            if (!opts.reduceKeys || n <= 2)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    outIdx.push_back(static_cast<std::uint32_t>(i));
+                return;
+            }
+
+            // Greedy: Segment ab dem letzten behaltenen Key so lange verlängern,
+            // wie alle Zwischenkeys interpolierbar bleiben. Ein Durchlauf: pro
+            // Komponente wird das Steigungsfenster gehalten, in dem die Gerade vom
+            // Anker alle bisherigen Zwischenkeys trifft (Swinging Door).
+            // Rotation komponentenweise: |lerp - q| <= e je Komponente ergibt nach
+            // nlerp 1 - |dot| <= 8e^2, also e = sqrt(rotationTolerance / 8).
+            constexpr int kComponents = 7;   // pos xyz, rot xyzw
+            auto value = [&](std::size_t i, int c) { return c < 3 ? keys[i].pos[c] : keys[i].rot[c - 3]; };
+            const float rotEps = std::sqrt(std::max(opts.rotationTolerance, 0.0f) / 8.0f);
+
+            float lo[kComponents], hi[kComponents];
+            auto resetWindow = [&]
+            {
+                std::fill(std::begin(lo), std::end(lo), -std::numeric_limits<float>::infinity());
+                std::fill(std::begin(hi), std::end(hi), std::numeric_limits<float>::infinity());
+            };
+
+            std::size_t anchor = 0;
+            resetWindow();
+            outIdx.push_back(0);
+            for (std::size_t end = 2; end < n; ++end)
+            {
+                // neuer Zwischenkey end-1 engt das Fenster ein, dann end prüfen
+                const std::size_t m = end - 1;
+                const float dm = static_cast<float>(m - anchor);
+                const float de = static_cast<float>(end - anchor);
+
+                bool ok = true;
+                for (int c = 0; c < kComponents; ++c)
+                {
+                    const float eps = c < 3 ? opts.positionTolerance : rotEps;
+                    const float base = value(anchor, c);
+                    lo[c] = std::max(lo[c], (value(m, c) - eps - base) / dm);
+                    hi[c] = std::min(hi[c], (value(m, c) + eps - base) / dm);
+
+                    const float slope = (value(end, c) - base) / de;
+                    ok = ok && slope >= lo[c] && slope <= hi[c];
+                }
+
+                if (!ok)
+                {
+                    anchor = m;
+                    resetWindow();
+                    outIdx.push_back(static_cast<std::uint32_t>(anchor));
+                }
+            }
+            outIdx.push_back(static_cast<std::uint32_t>(n - 1));
         }
 
-        pushUnique(out.refOther, seenOther, s);
+        std::uint32_t packSmallestThree(const float q[4])
+        {
+            std::uint32_t largest = 0;
+            for (std::uint32_t i = 1; i < 4; ++i)
+                if (std::fabs(q[i]) > std::fabs(q[largest]))
+                    largest = i;
+
+            const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+            constexpr float kRange = 0.70710678f;
+
+            std::uint32_t v = largest << 30;
+            int slot = 0;
+            for (std::uint32_t i = 0; i < 4; ++i)
+            {
+                if (i == largest)
+                    continue;
+                const float n = std::clamp(q[i] * sign / kRange, -1.0f, 1.0f);
+                const auto qv = static_cast<std::uint32_t>(std::lround((n + 1.0f) * 0.5f * 1023.0f));
+                v |= qv << (20 - slot * 10);
+                ++slot;
+            }
+            return v;
+        }
+
+        void buildTracks(std::vector<std::vector<RawKey>>& keys, const AniDecoder::DecodeOptions& opts, DecodedAniData& out)
+        {
+            AniTracks& t = out.tracks;
+            t = AniTracks{};
+            t.rotationsCompressed = opts.compressRotations;
+
+            std::vector<std::uint32_t> idx;
+            for (std::size_t b = 0; b < keys.size(); ++b)
+            {
+                if (keys[b].empty())
+                    continue;
+
+                conditionRotations(keys[b]);
+                selectKeys(keys[b], opts, idx);
+
+                AniTrack track;
+                track.bone = static_cast<std::uint32_t>(b);
+                track.firstKey = static_cast<std::uint32_t>(t.frame.size());
+                track.keyCount = static_cast<std::uint32_t>(idx.size());
+                t.tracks.push_back(track);
+
+                for (std::uint32_t i : idx)
+                {
+                    const RawKey& k = keys[b][i];
+                    t.frame.push_back(static_cast<std::uint16_t>(i));
+                    t.posX.push_back(k.pos[0]);
+                    t.posY.push_back(k.pos[1]);
+                    t.posZ.push_back(k.pos[2]);
+
+                    if (opts.compressRotations)
+                    {
+                        t.rotPacked.push_back(packSmallestThree(k.rot));
+                    }
+                    else
+                    {
+                        t.rotX.push_back(k.rot[0]);
+                        t.rotY.push_back(k.rot[1]);
+                        t.rotZ.push_back(k.rot[2]);
+                        t.rotW.push_back(k.rot[3]);
+                    }
+                }
+            }
+
+            // Pools sind final -> Überkapazität abgeben
+            for (auto* v : { &t.posX, &t.posY, &t.posZ, &t.rotX, &t.rotY, &t.rotZ, &t.rotW })
+                v->shrink_to_fit();
+            t.frame.shrink_to_fit();
+            t.rotPacked.shrink_to_fit();
+        }
     }
 
     bool AniDecoder::decode(DecodedAniData& out, const BinaryData& bytes, std::string* outError)
+    {
+        return decode(out, bytes, DecodeOptions{}, outError);
+    }
+
+    bool AniDecoder::decode(DecodedAniData& out, const BinaryData& bytes, const DecodeOptions& opts, std::string* outError)
     {
         out = DecodedAniData{};
-        out.raw = bytes.bytes;
 
-        if (bytes.bytes.empty())
+        if (bytes.empty())
         {
             if (outError) *outError = "ANI: empty byte buffer.";
             return false;
         }
 
+        // Kopie nur auf Wunsch (Tracks/Refs verweisen nicht in raw)
+        if (opts.keepRaw)
+            out.raw.assign(bytes.data(), bytes.data() + bytes.size());
+
+        // --------------------------------------------------
+        // 0) Motion-Layout (Bones + Keys) -> kompakte Tracks
+        // --------------------------------------------------
+        {
+            std::vector<std::vector<RawKey>> keys;
+            std::string err;
+            if (parseMotion(bytes.view(), out, keys, err))
+            {
+                out.containerKind = "ANI";
+                out.parsed = true;
+                buildTracks(keys, opts, out);
+                return true;
+            }
+
+            // Fallback unten: Header-Sniffing + String-Scan
+            std::vector<std::uint8_t> raw = std::move(out.raw);
+            out = DecodedAniData{};
+            out.raw = std::move(raw);
+        }
+
         // --------------------------------------------------
         // 1) Container detection (best effort)
         // --------------------------------------------------
         out.containerKind = "Unknown";
         out.version = 0;
 
-        if (bytes.bytes.size() >= 3)
+        if (bytes.size() >= 3)
         {
-            if (bytes.bytes[0] == 'A' && bytes.bytes[1] == 'N' && bytes.bytes[2] == 'I')
+            const std::uint8_t* p = bytes.data();
+            if (p[0] == 'A' && p[1] == 'N' && p[2] == 'I')
                 out.containerKind = "ANI";
         }
 
         // --------------------------------------------------
         // 2) String extraction
         // --------------------------------------------------
-        std::vector<std::string> found;
-        extractAsciiRuns(bytes.bytes, found);
-
-        std::unordered_set<std::string> seenAll;
-        std::unordered_set<std::string> seenSkel, seenModel, seenOther;
+        // Läufe sind Views in den Puffer; nur neue (gefaltete) Strings werden kopiert
+        RefScanner::FoldedSet seen;
+        seen.reserve(256);
 
-        for (auto& s : found)
+        RefScanner::forEachAsciiRun(bytes.view(), [&](std::size_t off, std::size_t len)
         {
-            s = normalizePathLike(s);
-            s = toLowerLocal(s);
+            const std::string_view raw(reinterpret_cast<const char*>(bytes.data()) + off, len);
+            if (!seen.insert(raw).second)
+                return;
 
-            if (s.size() < 4)
-                continue;
-
-            if (seenAll.insert(s).second)
-                out.allStrings.push_back(s);
-
-            if (looksLikeRef(s))
-                classify(s, out, seenSkel, seenModel, seenOther);
-        }
+            std::string s = RefScanner::fold(raw);
+            out.allStrings.push_back(s);
+            classify(std::move(s), out);
+        });
 
         // Decoder ist erfolgreich, auch wenn keine Referenzen erkannt wurden
         return true;
@@ -11,8 +11,23 @@ namespace asset
     class AniDecoder
     {
     public:
+        struct DecodeOptions
+        {
+            // Keys weglassen, die sich aus den Nachbarn interpolieren lassen
+            bool reduceKeys = true;
+            float positionTolerance = 1e-4f;   // Einheiten
+            float rotationTolerance = 1e-4f;   // 1 - |dot(q, q')|
+
+            // Rotationen als "smallest three" (32 Bit statt 16 Byte pro Key)
+            bool compressRotations = false;
+
+            // raw-Kopie behalten (Converter, Debug)
+            bool keepRaw = true;
+        };
+
         // Variante A: direkt aus BinaryData (minimal & universell)
         static bool decode(DecodedAniData& out, const BinaryData& bytes, std::string* outError = nullptr);
+        static bool decode(DecodedAniData& out, const BinaryData& bytes, const DecodeOptions& opts, std::string* outError = nullptr);
 
         // Variante B (optional): aus AniSource
         // static bool decode(DecodedAniData& out, const AniSource& src, std::string* outError = nullptr);
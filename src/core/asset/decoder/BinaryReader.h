@@ -1,71 +1,141 @@
 #pragma once
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <string>
-#include <vector>
 #include <optional>
+#include <span>
+#include <string>
 #include <type_traits>
 
 namespace asset::decode
 {
-    // Minimal binary reader for "sniffing" / simple header parsing.
-    // (Full format parsing can be layered on top later.)
+    enum class Endian
+    {
+        Little,
+        Big
+    };
+
+    // Nicht-besitzender Reader über einen Byte-Span (BinaryData::view(), vector, ...).
+    // - alle Reads sind bounds-checked, bei Fehler bleibt die Position unverändert
+    // - readSpan/peekSpan liefern Views in den Puffer (keine Kopie)
+    // - readArray<T> liest n Werte direkt in einen Caller-Puffer
+    // - Endianness explizit (FlyFF-Dateien sind little endian)
     class BinaryReader
     {
     public:
-        explicit BinaryReader(const std::vector<unsigned char>& bytes)
+        explicit BinaryReader(std::span<const std::uint8_t> bytes)
             : m_bytes(bytes)
         {}
 
-        size_t size() const { return m_bytes.size(); }
-        size_t tell() const { return m_pos; }
+        std::size_t size() const { return m_bytes.size(); }
+        std::size_t tell() const { return m_pos; }
+        std::size_t remaining() const { return m_bytes.size() - m_pos; }
         bool eof() const { return m_pos >= m_bytes.size(); }
 
-        bool seek(size_t pos)
+        std::span<const std::uint8_t> bytes() const { return m_bytes; }
+
+        bool seek(std::size_t pos)
         {
             if (pos > m_bytes.size()) return false;
             m_pos = pos;
             return true;
         }
 
-        std::vector<unsigned char> peekBytes(size_t n) const
+        bool skip(std::size_t n)
+        {
+            if (n > remaining()) return false;
+            m_pos += n;
+            return true;
+        }
+
+        // auf Vielfaches von alignment (Zweierpotenz) vorrücken
+        bool align(std::size_t alignment)
         {
-            const size_t end = (m_pos + n > m_bytes.size()) ? m_bytes.size() : (m_pos + n);
-            return std::vector<unsigned char>(m_bytes.begin() + static_cast<std::ptrdiff_t>(m_pos),
-                                              m_bytes.begin() + static_cast<std::ptrdiff_t>(end));
+            const std::size_t aligned = (m_pos + alignment - 1) & ~(alignment - 1);
+            return seek(aligned);
         }
 
-        std::vector<unsigned char> readBytes(size_t n)
+        bool canRead(std::size_t n) const { return n <= remaining(); }
+
+        // --- Zero-copy ---
+        std::optional<std::span<const std::uint8_t>> peekSpan(std::size_t n) const
         {
-            auto out = peekBytes(n);
-            m_pos += out.size();
-            return out;
+            if (!canRead(n)) return std::nullopt;
+            return m_bytes.subspan(m_pos, n);
         }
 
+        std::optional<std::span<const std::uint8_t>> readSpan(std::size_t n)
+        {
+            auto s = peekSpan(n);
+            if (s) m_pos += n;
+            return s;
+        }
+
+        // --- Skalare ---
         template<typename T>
-        std::optional<T> readLE()
+        std::optional<T> read(Endian e)
+        {
+            auto v = peekAt<T>(m_pos, e);
+            if (v) m_pos += sizeof(T);
+            return v;
+        }
+
+        template<typename T>
+        std::optional<T> readLE() { return read<T>(Endian::Little); }
+
+        template<typename T>
+        std::optional<T> readBE() { return read<T>(Endian::Big); }
+
+        // Wahlfreier Zugriff ohne die Position zu ändern
+        template<typename T>
+        std::optional<T> peekAt(std::size_t offset, Endian e = Endian::Little) const
         {
             static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
-            if (m_pos + sizeof(T) > m_bytes.size())
+            if (offset > m_bytes.size() || sizeof(T) > m_bytes.size() - offset)
                 return std::nullopt;
 
-            T v{};
-            std::memcpy(&v, m_bytes.data() + m_pos, sizeof(T));
-            m_pos += sizeof(T);
+            T v;
+            std::memcpy(&v, m_bytes.data() + offset, sizeof(T));
+            return fromEndian(v, e);
+        }
 
-#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
-            // If you ever build on big-endian, add byte swap here.
-#endif
-            return v;
+        // --- Bulk: n Werte in out ---
+        template<typename T>
+        bool readArray(T* out, std::size_t n, Endian e = Endian::Little)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+            if (n > remaining() / sizeof(T))
+                return false;
+
+            std::memcpy(out, m_bytes.data() + m_pos, n * sizeof(T));
+            if (needsSwap(e))
+                for (std::size_t i = 0; i < n; ++i)
+                    out[i] = byteSwap(out[i]);
+
+            m_pos += n * sizeof(T);
+            return true;
+        }
+
+        template<typename T, std::size_t N>
+        bool readArray(T (&out)[N], Endian e = Endian::Little)
+        {
+            return readArray(out, N, e);
         }
 
-        static std::string toHex(const std::vector<unsigned char>& bytes)
+        template<typename T>
+        bool readArray(std::span<T> out, Endian e = Endian::Little)
+        {
+            return readArray(out.data(), out.size(), e);
+        }
+
+        static std::string toHex(std::span<const std::uint8_t> bytes)
         {
             static const char* hex = "0123456789ABCDEF";
             std::string out;
             out.reserve(bytes.size() * 2);
-            for (unsigned char b : bytes)
+            for (std::uint8_t b : bytes)
             {
                 out.push_back(hex[(b >> 4) & 0xF]);
                 out.push_back(hex[b & 0xF]);
@@ -74,7 +144,40 @@ namespace asset::decode
         }
 
     private:
-        const std::vector<unsigned char>& m_bytes;
-        size_t m_pos = 0;
+        static bool needsSwap(Endian e)
+        {
+            return (e == Endian::Little) != (std::endian::native == std::endian::little);
+        }
+
+        template<typename T>
+        static T byteSwap(T v)
+        {
+            if constexpr (sizeof(T) == 1)
+            {
+                return v;
+            }
+            else
+            {
+                std::uint8_t b[sizeof(T)];
+                std::memcpy(b, &v, sizeof(T));
+                for (std::size_t i = 0; i < sizeof(T) / 2; ++i)
+                {
+                    const std::uint8_t t = b[i];
+                    b[i] = b[sizeof(T) - 1 - i];
+                    b[sizeof(T) - 1 - i] = t;
+                }
+                std::memcpy(&v, b, sizeof(T));
+                return v;
+            }
+        }
+
+        template<typename T>
+        static T fromEndian(T v, Endian e)
+        {
+            return needsSwap(e) ? byteSwap(v) : v;
+        }
+
+        std::span<const std::uint8_t> m_bytes;
+        std::size_t m_pos = 0;
     };
 } // namespace asset::decode
@@ -1,8 +1,11 @@
 #include "data/asset/decoded/DecodedImageData.h"
 #include "asset/source/BinaryData.h"
+#include "core/TaskSystem.h"
+#include "core/asset/decoder/DecoderSsse3.h"
 
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -58,6 +61,9 @@ namespace asset
     static constexpr std::uint32_t DDPF_FOURCC      = 0x00000004;
     static constexpr std::uint32_t DDPF_RGB         = 0x00000040;
 
+    // D3D11 erlaubt 16384; größer gilt als kaputte Datei (int-Casts, Puffergrößen)
+    static constexpr std::uint32_t kMaxDimension = 1u << 16;
+
     // FourCC helper
     static constexpr std::uint32_t FCC(char a, char b, char c, char d)
     {
@@ -103,7 +109,7 @@ namespace asset
     // Safe reads
     // ------------------------------------------------------------
     template <typename T>
-    static bool readAt(const std::vector<std::uint8_t>& buf, std::size_t off, T& out)
+    static bool readAt(std::span<const std::uint8_t> buf, std::size_t off, T& out)
     {
         if (off + sizeof(T) > buf.size())
             return false;
@@ -111,7 +117,7 @@ namespace asset
         return true;
     }
 
-    static bool readU32At(const std::vector<std::uint8_t>& buf, std::size_t off, std::uint32_t& out)
+    static bool readU32At(std::span<const std::uint8_t> buf, std::size_t off, std::uint32_t& out)
     {
         if (off + 4 > buf.size())
             return false;
@@ -147,7 +153,7 @@ namespace asset
     }
 
     static bool decodeUncompressedToRGBA8(
-        const std::vector<std::uint8_t>& src,
+        std::span<const std::uint8_t> src,
         std::size_t pixelDataOffset,
         int width, int height,
         const DDS_PIXELFORMAT& pf,
@@ -342,317 +348,303 @@ namespace asset
         }
     }
 
-    static bool decodeBC1ToRGBA8(
-        const std::vector<std::uint8_t>& src,
-        std::size_t pixelDataOffset,
-        int width, int height,
-        std::vector<std::uint8_t>& outRGBA,
-        std::string* err)
+    // ------------------------------------------------------------
+    // BCn block kernels
+    //
+    // Jeder Block wird direkt als 4 Zeilen à 16 Byte (4 RGBA-Pixel) in das
+    // Ziel geschrieben. Die Palette (4 Farben = 16 Byte) wird per Zeilen-
+    // Indexbyte über eine Shuffle-Maske ausgelesen: SSSE3 pshufb (Auswahl zur
+    // Laufzeit, siehe DecoderSsse3.h), sonst dieselbe Tabelle skalar.
+    // Ergebnis ist bitidentisch zum alten Pfad.
+    // ------------------------------------------------------------
+    enum class BcFormat { BC1, BC2, BC3, BC4, BC5 };
+
+    static std::size_t bcBlockBytes(BcFormat fmt)
     {
-        const int blocksX = (width + 3) / 4;
-        const int blocksY = (height + 3) / 4;
-        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * 8u;
+        return (fmt == BcFormat::BC1 || fmt == BcFormat::BC4) ? 8u : 16u;
+    }
 
-        if (pixelDataOffset + needed > src.size())
+    static const char* bcInsufficientDataError(BcFormat fmt)
+    {
+        switch (fmt)
         {
-            if (err) *err = "DDS: insufficient data for BC1/DXT1 blocks.";
-            return false;
+        case BcFormat::BC1: return "DDS: insufficient data for BC1/DXT1 blocks.";
+        case BcFormat::BC2: return "DDS: insufficient data for BC2/DXT3 blocks.";
+        case BcFormat::BC3: return "DDS: insufficient data for BC3/DXT5 blocks.";
+        case BcFormat::BC4: return "DDS: insufficient data for BC4 blocks.";
+        default:            return "DDS: insufficient data for BC5 blocks.";
         }
+    }
 
-        outRGBA.assign((std::size_t)width * (std::size_t)height * 4u, 0);
-
-        const std::uint8_t* p = src.data() + pixelDataOffset;
+    // Indexbyte einer Blockzeile (4 x 2 Bit) -> Byte-Gather-Maske in die Palette
+    struct BcRowLut
+    {
+        alignas(16) std::uint8_t ctrl[256][16];
+    };
 
-        for (int by = 0; by < blocksY; ++by)
+    static const BcRowLut& bcRowLut()
+    {
+        static const BcRowLut lut = []
         {
-            for (int bx = 0; bx < blocksX; ++bx)
-            {
-                const std::uint8_t* block = p + (by * blocksX + bx) * 8u;
-
-                std::uint8_t colors[4][4];
-                bool hasTransparent = false;
-                decodeBC1Block(block, colors, hasTransparent);
-
-                const std::uint32_t indices =
-                    (std::uint32_t)block[4] |
-                    ((std::uint32_t)block[5] << 8) |
-                    ((std::uint32_t)block[6] << 16) |
-                    ((std::uint32_t)block[7] << 24);
-
-                for (int py = 0; py < 4; ++py)
+            BcRowLut t{};
+            for (int b = 0; b < 256; ++b)
+                for (int px = 0; px < 4; ++px)
                 {
-                    for (int px = 0; px < 4; ++px)
-                    {
-                        const int x = bx * 4 + px;
-                        const int y = by * 4 + py;
-                        if (x >= width || y >= height)
-                            continue;
-
-                        const int idx = (indices >> (2 * (py * 4 + px))) & 0x3;
-                        const std::size_t o = ((std::size_t)y * (std::size_t)width + (std::size_t)x) * 4u;
-
-                        outRGBA[o + 0] = colors[idx][0];
-                        outRGBA[o + 1] = colors[idx][1];
-                        outRGBA[o + 2] = colors[idx][2];
-                        outRGBA[o + 3] = colors[idx][3];
-                    }
+                    const int idx = (b >> (2 * px)) & 0x3;
+                    for (int c = 0; c < 4; ++c)
+                        t.ctrl[b][px * 4 + c] = (std::uint8_t)(idx * 4 + c);
                 }
-            }
-        }
-
-        return true;
+            return t;
+        }();
+        return lut;
     }
 
-    static bool decodeBC2ToRGBA8(
-        const std::vector<std::uint8_t>& src,
-        std::size_t pixelDataOffset,
-        int width, int height,
-        std::vector<std::uint8_t>& outRGBA,
-        std::string* err)
+    // palette: 4 Farben RGBA, rowIdx: 4 Indexbytes (eine Zeile je Byte),
+    // alpha: optional 16 Alphawerte, die den Palettenalpha ersetzen
+    static void writeColorRows(const std::uint8_t palette[16],
+                               const std::uint8_t rowIdx[4],
+                               const std::uint8_t* alpha,
+                               std::uint8_t* dst, std::size_t stride,
+                               bool useSimd)
     {
-        const int blocksX = (width + 3) / 4;
-        const int blocksY = (height + 3) / 4;
-        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * 16u;
+        const BcRowLut& lut = bcRowLut();
 
-        if (pixelDataOffset + needed > src.size())
+        if (useSimd)
         {
-            if (err) *err = "DDS: insufficient data for BC2/DXT3 blocks.";
-            return false;
+            const std::uint8_t* const ctrl[4] = {
+                lut.ctrl[rowIdx[0]], lut.ctrl[rowIdx[1]], lut.ctrl[rowIdx[2]], lut.ctrl[rowIdx[3]]
+            };
+            simd::bcColorRows(palette, ctrl, alpha, dst, stride);
+            return;
         }
 
-        outRGBA.assign((std::size_t)width * (std::size_t)height * 4u, 0);
-
-        const std::uint8_t* p = src.data() + pixelDataOffset;
-
-        for (int by = 0; by < blocksY; ++by)
+        for (int py = 0; py < 4; ++py)
         {
-            for (int bx = 0; bx < blocksX; ++bx)
-            {
-                const std::uint8_t* block = p + (by * blocksX + bx) * 16u;
+            const std::uint8_t* ctrl = lut.ctrl[rowIdx[py]];
+            std::uint8_t* row = dst + (std::size_t)py * stride;
 
-                std::uint8_t alpha[16];
-                decodeBC2Alpha(block, alpha);
+            for (int i = 0; i < 16; ++i)
+                row[i] = palette[ctrl[i]];
 
-                std::uint8_t colors[4][4];
-                bool hasTransparent = false;
-                decodeBC1Block(block + 8, colors, hasTransparent);
+            if (alpha)
+            {
+                row[3]  = alpha[py * 4 + 0];
+                row[7]  = alpha[py * 4 + 1];
+                row[11] = alpha[py * 4 + 2];
+                row[15] = alpha[py * 4 + 3];
+            }
+        }
+    }
 
-                const std::uint32_t indices =
-                    (std::uint32_t)block[12] |
-                    ((std::uint32_t)block[13] << 8) |
-                    ((std::uint32_t)block[14] << 16) |
-                    ((std::uint32_t)block[15] << 24);
+    // BC4/BC5: R (und optional G) aus den Alpha-Tabellen, B = 0, A = 255
+    static void writeRGRows(const std::uint8_t r[16],
+                            const std::uint8_t* g,
+                            std::uint8_t* dst, std::size_t stride,
+                            bool useSimd)
+    {
+        if (useSimd)
+        {
+            simd::bcRGRows(r, g, dst, stride);
+            return;
+        }
 
-                for (int py = 0; py < 4; ++py)
-                {
-                    for (int px = 0; px < 4; ++px)
-                    {
-                        const int x = bx * 4 + px;
-                        const int y = by * 4 + py;
-                        if (x >= width || y >= height)
-                            continue;
-
-                        const int i = py * 4 + px;
-                        const int idx = (indices >> (2 * i)) & 0x3;
-
-                        const std::size_t o = ((std::size_t)y * (std::size_t)width + (std::size_t)x) * 4u;
-                        outRGBA[o + 0] = colors[idx][0];
-                        outRGBA[o + 1] = colors[idx][1];
-                        outRGBA[o + 2] = colors[idx][2];
-                        outRGBA[o + 3] = alpha[i];
-                    }
-                }
+        for (int py = 0; py < 4; ++py)
+        {
+            std::uint8_t* row = dst + (std::size_t)py * stride;
+            for (int px = 0; px < 4; ++px)
+            {
+                row[px * 4 + 0] = r[py * 4 + px];
+                row[px * 4 + 1] = g ? g[py * 4 + px] : 0;
+                row[px * 4 + 2] = 0;
+                row[px * 4 + 3] = 255;
             }
         }
-
-        return true;
     }
 
-    static bool decodeBC3ToRGBA8(
-        const std::vector<std::uint8_t>& src,
-        std::size_t pixelDataOffset,
-        int width, int height,
-        std::vector<std::uint8_t>& outRGBA,
-        std::string* err)
+    static void decodeBCBlock(BcFormat fmt, const std::uint8_t* block, std::uint8_t* dst, std::size_t stride, bool useSimd)
     {
-        const int blocksX = (width + 3) / 4;
-        const int blocksY = (height + 3) / 4;
-        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * 16u;
+        alignas(16) std::uint8_t colors[4][4];
+        alignas(16) std::uint8_t a[16];
+        alignas(16) std::uint8_t b[16];
+        bool hasTransparent = false;
 
-        if (pixelDataOffset + needed > src.size())
+        switch (fmt)
         {
-            if (err) *err = "DDS: insufficient data for BC3/DXT5 blocks.";
-            return false;
+        case BcFormat::BC1:
+            decodeBC1Block(block, colors, hasTransparent);
+            writeColorRows(&colors[0][0], block + 4, nullptr, dst, stride, useSimd);
+            break;
+
+        case BcFormat::BC2:
+            decodeBC2Alpha(block, a);
+            decodeBC1Block(block + 8, colors, hasTransparent);
+            writeColorRows(&colors[0][0], block + 12, a, dst, stride, useSimd);
+            break;
+
+        case BcFormat::BC3:
+            decodeBC3Alpha(block, a);
+            decodeBC1Block(block + 8, colors, hasTransparent);
+            writeColorRows(&colors[0][0], block + 12, a, dst, stride, useSimd);
+            break;
+
+        case BcFormat::BC4:
+            decodeBC3Alpha(block, a); // works: same index encoding, only 8 bytes total
+            writeRGRows(a, nullptr, dst, stride, useSimd);
+            break;
+
+        case BcFormat::BC5:
+            // two BC4 blocks back-to-back (R and G)
+            decodeBC3Alpha(block + 0, a);
+            decodeBC3Alpha(block + 8, b);
+            writeRGRows(a, b, dst, stride, useSimd);
+            break;
         }
+    }
 
-        outRGBA.assign((std::size_t)width * (std::size_t)height * 4u, 0);
-
-        const std::uint8_t* p = src.data() + pixelDataOffset;
+    // Dekodiert die Blockzeilen [byBegin, byEnd). Innere Blöcke schreiben
+    // direkt ins Ziel, Randblöcke gehen über eine 4x4-Kachel.
+    static void decodeBCBlockRows(BcFormat fmt,
+                                  const std::uint8_t* p,
+                                  int blocksX,
+                                  int byBegin, int byEnd,
+                                  int width, int height,
+                                  std::uint8_t* outRGBA)
+    {
+        const std::size_t blockBytes = bcBlockBytes(fmt);
+        const std::size_t rowStride = (std::size_t)width * 4u;
+        const int fullBlocksX = width / 4;
+        const bool useSimd = simd::ssse3Available();
 
-        for (int by = 0; by < blocksY; ++by)
+        for (int by = byBegin; by < byEnd; ++by)
         {
-            for (int bx = 0; bx < blocksX; ++bx)
-            {
-                const std::uint8_t* block = p + (by * blocksX + bx) * 16u;
-
-                std::uint8_t alpha[16];
-                decodeBC3Alpha(block, alpha);
+            const int y0 = by * 4;
+            const int rows = std::min(4, height - y0);
 
-                std::uint8_t colors[4][4];
-                bool hasTransparent = false;
-                decodeBC1Block(block + 8, colors, hasTransparent);
+            std::uint8_t* rowBase = outRGBA + (std::size_t)y0 * rowStride;
+            const std::uint8_t* block = p + (std::size_t)by * (std::size_t)blocksX * blockBytes;
 
-                const std::uint32_t indices =
-                    (std::uint32_t)block[12] |
-                    ((std::uint32_t)block[13] << 8) |
-                    ((std::uint32_t)block[14] << 16) |
-                    ((std::uint32_t)block[15] << 24);
+            for (int bx = 0; bx < blocksX; ++bx, block += blockBytes)
+            {
+                std::uint8_t* dst = rowBase + (std::size_t)bx * 16u;
 
-                for (int py = 0; py < 4; ++py)
+                if (rows == 4 && bx < fullBlocksX)
                 {
-                    for (int px = 0; px < 4; ++px)
-                    {
-                        const int x = bx * 4 + px;
-                        const int y = by * 4 + py;
-                        if (x >= width || y >= height)
-                            continue;
-
-                        const int i = py * 4 + px;
-                        const int idx = (indices >> (2 * i)) & 0x3;
-
-                        const std::size_t o = ((std::size_t)y * (std::size_t)width + (std::size_t)x) * 4u;
-                        outRGBA[o + 0] = colors[idx][0];
-                        outRGBA[o + 1] = colors[idx][1];
-                        outRGBA[o + 2] = colors[idx][2];
-                        outRGBA[o + 3] = alpha[i];
-                    }
+                    decodeBCBlock(fmt, block, dst, rowStride, useSimd);
+                    continue;
                 }
+
+                alignas(16) std::uint8_t tile[64];
+                decodeBCBlock(fmt, block, tile, 16u, useSimd);
+
+                const std::size_t cols = (std::size_t)std::min(4, width - bx * 4);
+                for (int r = 0; r < rows; ++r)
+                    std::memcpy(dst + (std::size_t)r * rowStride, tile + r * 16, cols * 4u);
             }
         }
-
-        return true;
     }
 
-    static bool decodeBC4ToRGBA8(
-        const std::vector<std::uint8_t>& src,
+    static bool decodeBCToRGBA8(
+        BcFormat fmt,
+        std::span<const std::uint8_t> src,
         std::size_t pixelDataOffset,
         int width, int height,
+        const DdsDecoder::DecodeOptions& opts,
         std::vector<std::uint8_t>& outRGBA,
         std::string* err)
     {
-        // BC4: 8 bytes per 4x4 block, same alpha scheme as BC3 alpha
         const int blocksX = (width + 3) / 4;
         const int blocksY = (height + 3) / 4;
-        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * 8u;
+        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * bcBlockBytes(fmt);
 
         if (pixelDataOffset + needed > src.size())
         {
-            if (err) *err = "DDS: insufficient data for BC4 blocks.";
+            if (err) *err = bcInsufficientDataError(fmt);
             return false;
         }
 
-        outRGBA.assign((std::size_t)width * (std::size_t)height * 4u, 0);
+        // jedes Pixel wird geschrieben -> kein Vorbelegen nötig
+        outRGBA.resize((std::size_t)width * (std::size_t)height * 4u);
 
         const std::uint8_t* p = src.data() + pixelDataOffset;
+        std::uint8_t* dst = outRGBA.data();
 
-        for (int by = 0; by < blocksY; ++by)
+        const std::size_t pixels = (std::size_t)width * (std::size_t)height;
+        if (!opts.parallel || pixels < opts.parallelMinPixels || blocksY < 2)
         {
-            for (int bx = 0; bx < blocksX; ++bx)
-            {
-                const std::uint8_t* block = p + (by * blocksX + bx) * 8u;
+            decodeBCBlockRows(fmt, p, blocksX, 0, blocksY, width, height, dst);
+            return true;
+        }
 
-                std::uint8_t a[16];
-                decodeBC3Alpha(block, a); // works: same index encoding, only 8 bytes total
+        // Blockzeilen-Bereiche: ~4 Bereiche pro Thread für Lastausgleich
+        core::TaskSystem& tasks = core::TaskSystem::instance();
+        const std::size_t slices = (tasks.workerCount() + 1) * 4u;
+        const std::size_t grain = std::max<std::size_t>(1u, (std::size_t)blocksY / slices);
 
-                for (int py = 0; py < 4; ++py)
-                {
-                    for (int px = 0; px < 4; ++px)
-                    {
-                        const int x = bx * 4 + px;
-                        const int y = by * 4 + py;
-                        if (x >= width || y >= height)
-                            continue;
-
-                        const int i = py * 4 + px;
-                        const std::size_t o = ((std::size_t)y * (std::size_t)width + (std::size_t)x) * 4u;
-
-                        outRGBA[o + 0] = a[i]; // R
-                        outRGBA[o + 1] = 0;
-                        outRGBA[o + 2] = 0;
-                        outRGBA[o + 3] = 255;
-                    }
-                }
-            }
-        }
+        tasks.parallelFor((std::size_t)blocksY, grain, [&](std::size_t begin, std::size_t end)
+        {
+            decodeBCBlockRows(fmt, p, blocksX, (int)begin, (int)end, width, height, dst);
+        });
 
         return true;
     }
 
-    static bool decodeBC5ToRGBA8(
-        const std::vector<std::uint8_t>& src,
-        std::size_t pixelDataOffset,
-        int width, int height,
-        std::vector<std::uint8_t>& outRGBA,
-        std::string* err)
+    // ------------------------------------------------------------
+    // Layout (Header + Mip-Kette)
+    // ------------------------------------------------------------
+    struct DdsLayout
     {
-        // BC5: two BC4 blocks back-to-back (R and G), 16 bytes per block
-        const int blocksX = (width + 3) / 4;
-        const int blocksY = (height + 3) / 4;
-        const std::size_t needed = (std::size_t)blocksX * (std::size_t)blocksY * 16u;
+        int width = 0;
+        int height = 0;
+        int mipCount = 1;            // laut Header
+        bool premultipliedAlpha = false;
 
-        if (pixelDataOffset + needed > src.size())
-        {
-            if (err) *err = "DDS: insufficient data for BC5 blocks.";
-            return false;
-        }
+        bool compressed = false;
+        BcFormat bc = BcFormat::BC1;
+        DDS_PIXELFORMAT pf{};
 
-        outRGBA.assign((std::size_t)width * (std::size_t)height * 4u, 0);
+        std::size_t dataOffset = 0;  // Beginn von Mip 0
 
-        const std::uint8_t* p = src.data() + pixelDataOffset;
+        // Farbraum/Vorzeichen, soweit der Header sie hergibt
+        bool dx10 = false;           // nur der DX10-Header kennt sRGB explizit
+        bool srgb = false;
+        bool snorm = false;
+    };
 
-        for (int by = 0; by < blocksY; ++by)
-        {
-            for (int bx = 0; bx < blocksX; ++bx)
-            {
-                const std::uint8_t* block = p + (by * blocksX + bx) * 16u;
+    static int mipDim(int dim, int level)
+    {
+        return std::max(1, dim >> level);
+    }
 
-                std::uint8_t r[16];
-                std::uint8_t g[16];
-                decodeBC3Alpha(block + 0, r);
-                decodeBC3Alpha(block + 8, g);
+    // Länge der vollen Mip-Kette: floor(log2(max(w, h))) + 1
+    static int maxMipCount(int width, int height)
+    {
+        int n = 1;
+        for (int d = std::max(width, height); d > 1; d >>= 1)
+            ++n;
+        return n;
+    }
 
-                for (int py = 0; py < 4; ++py)
-                {
-                    for (int px = 0; px < 4; ++px)
-                    {
-                        const int x = bx * 4 + px;
-                        const int y = by * 4 + py;
-                        if (x >= width || y >= height)
-                            continue;
-
-                        const int i = py * 4 + px;
-                        const std::size_t o = ((std::size_t)y * (std::size_t)width + (std::size_t)x) * 4u;
-
-                        outRGBA[o + 0] = r[i];
-                        outRGBA[o + 1] = g[i];
-                        outRGBA[o + 2] = 0;
-                        outRGBA[o + 3] = 255;
-                    }
-                }
-            }
-        }
+    static std::size_t mipLevelBytes(const DdsLayout& l, int level)
+    {
+        const std::size_t w = (std::size_t)mipDim(l.width, level);
+        const std::size_t h = (std::size_t)mipDim(l.height, level);
 
-        return true;
+        if (l.compressed)
+            return ((w + 3u) / 4u) * ((h + 3u) / 4u) * bcBlockBytes(l.bc);
+
+        return w * h * ((std::size_t)l.pf.rgbBitCount / 8u);
     }
 
-    // ------------------------------------------------------------
-    // Main decode
-    // ------------------------------------------------------------
-    bool DdsDecoder::decode(DecodedImageData& out, const BinaryData& inBytes, std::string* outError)
+    static std::size_t mipLevelOffset(const DdsLayout& l, int level)
     {
-        out = DecodedImageData{};
+        std::size_t off = l.dataOffset;
+        for (int i = 0; i < level; ++i)
+            off += mipLevelBytes(l, i);
+        return off;
+    }
 
-        const auto& buf = inBytes.bytes;
+    static bool parseLayout(std::span<const std::uint8_t> buf, DdsLayout& l, std::string* outError)
+    {
         if (buf.size() < 4 + sizeof(DDS_HEADER))
         {
             if (outError) *outError = "DDS: file too small.";
@@ -679,19 +671,23 @@ namespace asset
             return false;
         }
 
-        if (hdr.width == 0 || hdr.height == 0)
+        if (hdr.width == 0 || hdr.height == 0 ||
+            hdr.width > kMaxDimension || hdr.height > kMaxDimension)
         {
             if (outError) *outError = "DDS: invalid dimensions.";
             return false;
         }
 
-        out.width  = (int)hdr.width;
-        out.height = (int)hdr.height;
+        l.width  = (int)hdr.width;
+        l.height = (int)hdr.height;
 
+        // mipMapCount kommt ungeprüft aus der Datei: auf die volle Kette
+        // begrenzen, sonst Shifts >= 32 in mipDim / negative Zählung
         if (hdr.mipMapCount > 0)
-            out.mipCount = (int)hdr.mipMapCount;
+            l.mipCount = (int)std::min<std::uint32_t>(hdr.mipMapCount, (std::uint32_t)maxMipCount(l.width, l.height));
 
-        std::size_t pixelDataOffset = 4 + sizeof(DDS_HEADER);
+        l.pf = hdr.ddspf;
+        l.dataOffset = 4 + sizeof(DDS_HEADER);
 
         // Determine compression / format
         bool isFourCC = (hdr.ddspf.flags & DDPF_FOURCC) != 0;
@@ -701,12 +697,12 @@ namespace asset
         if (isFourCC && fourCC == FCC('D','X','1','0'))
         {
             DDS_HEADER_DXT10 dx10{};
-            if (!readAt(buf, pixelDataOffset, dx10))
+            if (!readAt(buf, l.dataOffset, dx10))
             {
                 if (outError) *outError = "DDS: DX10 header present but missing.";
                 return false;
             }
-            pixelDataOffset += sizeof(DDS_HEADER_DXT10);
+            l.dataOffset += sizeof(DDS_HEADER_DXT10);
 
             std::uint32_t mapped = 0;
             if (!dxgiToKind(dx10.dxgiFormat, mapped))
@@ -715,45 +711,34 @@ namespace asset
                 return false;
             }
             fourCC = mapped;
+
+            l.dx10  = true;
+            l.srgb  = (dx10.dxgiFormat == 72 || dx10.dxgiFormat == 75 || dx10.dxgiFormat == 78);
+            l.snorm = (dx10.dxgiFormat == 81 || dx10.dxgiFormat == 84);
         }
 
-        // Decode
-        if (isFourCC)
+        if (!isFourCC)
         {
-            // DXTn / BCn
-            if (fourCC == FCC('D','X','T','1'))
-            {
-                return decodeBC1ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-            if (fourCC == FCC('D','X','T','3'))
-            {
-                return decodeBC2ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-            if (fourCC == FCC('D','X','T','5'))
-            {
-                return decodeBC3ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-            if (fourCC == FCC('D','X','T','2'))
-            {
-                out.premultipliedAlpha = true;
-                return decodeBC2ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-            if (fourCC == FCC('D','X','T','4'))
-            {
-                out.premultipliedAlpha = true;
-                return decodeBC3ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-
-            // BC4/BC5 (common aliases)
-            if (fourCC == FCC('A','T','I','1') || fourCC == FCC('B','C','4','U') || fourCC == FCC('B','C','4','S'))
-            {
-                return decodeBC4ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
-            if (fourCC == FCC('A','T','I','2') || fourCC == FCC('B','C','5','U') || fourCC == FCC('B','C','5','S'))
-            {
-                return decodeBC5ToRGBA8(buf, pixelDataOffset, out.width, out.height, out.rgba, outError);
-            }
+            // Uncompressed RGB(A) via masks
+            l.compressed = false;
+            return true;
+        }
 
+        l.compressed = true;
+
+        // DXTn / BCn
+        if (fourCC == FCC('D','X','T','1'))      l.bc = BcFormat::BC1;
+        else if (fourCC == FCC('D','X','T','3')) l.bc = BcFormat::BC2;
+        else if (fourCC == FCC('D','X','T','5')) l.bc = BcFormat::BC3;
+        else if (fourCC == FCC('D','X','T','2')) { l.bc = BcFormat::BC2; l.premultipliedAlpha = true; }
+        else if (fourCC == FCC('D','X','T','4')) { l.bc = BcFormat::BC3; l.premultipliedAlpha = true; }
+        // BC4/BC5 (common aliases)
+        else if (fourCC == FCC('A','T','I','1') || fourCC == FCC('B','C','4','U') || fourCC == FCC('B','C','4','S'))
+            l.bc = BcFormat::BC4;
+        else if (fourCC == FCC('A','T','I','2') || fourCC == FCC('B','C','5','U') || fourCC == FCC('B','C','5','S'))
+            l.bc = BcFormat::BC5;
+        else
+        {
             if (outError)
             {
                 char a = (char)(fourCC & 0xFF);
@@ -764,10 +749,177 @@ namespace asset
             }
             return false;
         }
-        else
+
+        if (fourCC == FCC('B','C','4','S') || fourCC == FCC('B','C','5','S'))
+            l.snorm = true;
+
+        return true;
+    }
+
+    static bool decodeLevel(DecodedImageData& out,
+                            std::span<const std::uint8_t> buf,
+                            const DdsLayout& l,
+                            int level,
+                            const DdsDecoder::DecodeOptions& opts,
+                            std::string* outError)
+    {
+        out.width  = mipDim(l.width, level);
+        out.height = mipDim(l.height, level);
+        out.mipCount = l.mipCount;
+        out.mipLevel = level;
+        out.premultipliedAlpha = l.premultipliedAlpha;
+
+        const std::size_t offset = mipLevelOffset(l, level);
+
+        if (l.compressed)
+            return decodeBCToRGBA8(l.bc, buf, offset, out.width, out.height, opts, out.rgba, outError);
+
+        return decodeUncompressedToRGBA8(buf, offset, out.width, out.height, l.pf, out.rgba, outError);
+    }
+
+    // ------------------------------------------------------------
+    // Main decode
+    // ------------------------------------------------------------
+    bool DdsDecoder::decode(DecodedImageData& out, const BinaryData& inBytes, std::string* outError)
+    {
+        return decode(out, inBytes, DecodeOptions{}, outError);
+    }
+
+    bool DdsDecoder::decode(DecodedImageData& out, const BinaryData& inBytes, const DecodeOptions& opts, std::string* outError)
+    {
+        return decodeMip(out, inBytes, 0, opts, outError);
+    }
+
+    bool DdsDecoder::decodeMip(DecodedImageData& out, const BinaryData& inBytes, int mipLevel, std::string* outError)
+    {
+        return decodeMip(out, inBytes, mipLevel, DecodeOptions{}, outError);
+    }
+
+    bool DdsDecoder::decodeMip(DecodedImageData& out, const BinaryData& inBytes, int mipLevel,
+                               const DecodeOptions& opts, std::string* outError)
+    {
+        out = DecodedImageData{};
+
+        const std::span<const std::uint8_t> buf = inBytes.view();
+
+        DdsLayout layout;
+        if (!parseLayout(buf, layout, outError))
+            return false;
+
+        if (mipLevel < 0 || mipLevel >= layout.mipCount)
         {
-            // Uncompressed RGB(A) via masks
-            return decodeUncompressedToRGBA8(buf, pixelDataOffset, out.width, out.height, hdr.ddspf, out.rgba, outError);
+            if (outError)
+                *outError = "DDS: mip level " + std::to_string(mipLevel) +
+                            " out of range (mipCount=" + std::to_string(layout.mipCount) + ").";
+            return false;
         }
+
+        return decodeLevel(out, buf, layout, mipLevel, opts, outError);
+    }
+
+    int DdsDecoder::selectMipForSize(int width, int height, int mipCount, int targetWidth, int targetHeight)
+    {
+        if (width <= 0 || height <= 0 || targetWidth <= 0 || targetHeight <= 0)
+            return 0;
+
+        // Bild proportional in die Zielbox einpassen (nie vergrößern)
+        const double scale = std::min(1.0, std::min((double)targetWidth / width, (double)targetHeight / height));
+        const double needW = width * scale;
+        const double needH = height * scale;
+
+        mipCount = std::min(mipCount, maxMipCount(width, height));
+
+        int level = 0;
+        while (level + 1 < mipCount &&
+               mipDim(width, level + 1) >= needW &&
+               mipDim(height, level + 1) >= needH)
+        {
+            ++level;
+        }
+        return level;
+    }
+
+    bool DdsDecoder::describePayload(DdsPayloadInfo& out, const BinaryData& inBytes, std::string* outError)
+    {
+        out = DdsPayloadInfo{};
+
+        const std::span<const std::uint8_t> buf = inBytes.view();
+
+        DdsLayout layout;
+        if (!parseLayout(buf, layout, outError))
+            return false;
+
+        if (!layout.compressed)
+        {
+            if (outError) *outError = "DDS: payload is not block-compressed (BC1-BC5).";
+            return false;
+        }
+
+        switch (layout.bc)
+        {
+        case BcFormat::BC1: out.format = DdsBlockFormat::BC1; break;
+        case BcFormat::BC2: out.format = DdsBlockFormat::BC2; break;
+        case BcFormat::BC3: out.format = DdsBlockFormat::BC3; break;
+        case BcFormat::BC4: out.format = DdsBlockFormat::BC4; break;
+        case BcFormat::BC5: out.format = DdsBlockFormat::BC5; break;
+        }
+
+        out.width = layout.width;
+        out.height = layout.height;
+        out.blockBytes = (int)bcBlockBytes(layout.bc);
+        out.premultipliedAlpha = layout.premultipliedAlpha;
+        out.colorSpaceKnown = layout.dx10;
+        out.srgb = layout.srgb;
+        out.snorm = layout.snorm;
+
+        // nur vollständig vorhandene Stufen übernehmen
+        std::size_t offset = layout.dataOffset;
+        for (int level = 0; level < layout.mipCount; ++level)
+        {
+            const std::size_t size = mipLevelBytes(layout, level);
+            if (offset + size > buf.size())
+                break;
+
+            DdsMipInfo mip;
+            mip.width = mipDim(layout.width, level);
+            mip.height = mipDim(layout.height, level);
+            mip.offset = offset;
+            mip.size = size;
+            out.mips.push_back(mip);
+
+            offset += size;
+        }
+
+        if (out.mips.empty())
+        {
+            if (outError) *outError = bcInsufficientDataError(layout.bc);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool DdsDecoder::decodeForSize(DecodedImageData& out, const BinaryData& inBytes,
+                                   int targetWidth, int targetHeight, std::string* outError)
+    {
+        out = DecodedImageData{};
+
+        const std::span<const std::uint8_t> buf = inBytes.view();
+
+        DdsLayout layout;
+        if (!parseLayout(buf, layout, outError))
+            return false;
+
+        int level = selectMipForSize(layout.width, layout.height, layout.mipCount, targetWidth, targetHeight);
+
+        // Abgeschnittene Dateien: auf die letzte vollständig vorhandene Stufe zurückfallen
+        while (level > 0 && mipLevelOffset(layout, level) + mipLevelBytes(layout, level) > buf.size())
+            --level;
+
+        // Thumbnails sind klein -> kein Aufteilen auf Threads
+        DecodeOptions opts;
+        opts.parallel = false;
+
+        return decodeLevel(out, buf, layout, level, opts, outError);
     }
 }
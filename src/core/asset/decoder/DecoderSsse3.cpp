@@ -0,0 +1,131 @@
+#include "DecoderSsse3.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define ASSET_SSSE3_KERNELS 1   // MSVC: Intrinsics ohne /arch verfügbar
+#elif defined(__SSSE3__)
+    #define ASSET_SSSE3_KERNELS 1   // GCC/Clang: -mssse3 nur für diese Datei
+#else
+    #define ASSET_SSSE3_KERNELS 0
+#endif
+
+#if ASSET_SSSE3_KERNELS
+    #include <tmmintrin.h>
+#endif
+
+namespace asset::simd
+{
+#if ASSET_SSSE3_KERNELS
+
+    bool ssse3KernelsCompiled() { return true; }
+
+    void bcColorRows(const std::uint8_t* palette,
+                     const std::uint8_t* const ctrl[4],
+                     const std::uint8_t* alpha,
+                     std::uint8_t* dst, std::size_t stride)
+    {
+        const __m128i pal = _mm_load_si128(reinterpret_cast<const __m128i*>(palette));
+        const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+        const __m128i alphaSpread = _mm_setr_epi8(-1, -1, -1, 0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3);
+
+        for (int py = 0; py < 4; ++py)
+        {
+            __m128i px = _mm_shuffle_epi8(pal, _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl[py])));
+
+            if (alpha)
+            {
+                std::int32_t a4;
+                std::memcpy(&a4, alpha + py * 4, 4);
+                const __m128i a = _mm_shuffle_epi8(_mm_cvtsi32_si128(a4), alphaSpread);
+                px = _mm_or_si128(_mm_and_si128(px, rgbMask), a);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (std::size_t)py * stride), px);
+        }
+    }
+
+    void bcRGRows(const std::uint8_t* r,
+                  const std::uint8_t* g,
+                  std::uint8_t* dst, std::size_t stride)
+    {
+        const __m128i ba = _mm_set1_epi16((short)0xFF00);
+
+        for (int py = 0; py < 4; ++py)
+        {
+            std::int32_t r4 = 0, g4 = 0;
+            std::memcpy(&r4, r + py * 4, 4);
+            if (g)
+                std::memcpy(&g4, g + py * 4, 4);
+
+            const __m128i rg = _mm_unpacklo_epi8(_mm_cvtsi32_si128(r4), _mm_cvtsi32_si128(g4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (std::size_t)py * stride),
+                             _mm_unpacklo_epi16(rg, ba));
+        }
+    }
+
+    std::size_t tgaBgra32(const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        const __m128i swz = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_shuffle_epi8(v, swz));
+        }
+        return i;
+    }
+
+    std::size_t tgaBgr24(const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000u);
+        const __m128i swz = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+
+        // 16-Byte-Load für 12 Byte Nutzdaten -> nur solange >= 16 Byte im Lauf liegen
+        std::size_t i = 0;
+        for (; i + 6 <= count; i += 4)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4),
+                             _mm_or_si128(_mm_shuffle_epi8(v, swz), alphaMask));
+        }
+        return i;
+    }
+
+    std::size_t tgaGray8(const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000u);
+        const __m128i s0 = _mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1);
+        const __m128i s1 = _mm_setr_epi8(4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1);
+        const __m128i s2 = _mm_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1);
+        const __m128i s3 = _mm_setr_epi8(12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1);
+
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i* o = reinterpret_cast<__m128i*>(dst + i * 4);
+            _mm_storeu_si128(o + 0, _mm_or_si128(_mm_shuffle_epi8(v, s0), alphaMask));
+            _mm_storeu_si128(o + 1, _mm_or_si128(_mm_shuffle_epi8(v, s1), alphaMask));
+            _mm_storeu_si128(o + 2, _mm_or_si128(_mm_shuffle_epi8(v, s2), alphaMask));
+            _mm_storeu_si128(o + 3, _mm_or_si128(_mm_shuffle_epi8(v, s3), alphaMask));
+        }
+        return i;
+    }
+
+#else
+
+    // Nicht gebaut: ssse3Available() ist false, die Kernel werden nie erreicht
+    bool ssse3KernelsCompiled() { return false; }
+
+    void bcColorRows(const std::uint8_t*, const std::uint8_t* const[4], const std::uint8_t*,
+                     std::uint8_t*, std::size_t) {}
+    void bcRGRows(const std::uint8_t*, const std::uint8_t*, std::uint8_t*, std::size_t) {}
+
+    std::size_t tgaBgra32(const std::uint8_t*, std::uint8_t*, std::size_t) { return 0; }
+    std::size_t tgaBgr24(const std::uint8_t*, std::uint8_t*, std::size_t) { return 0; }
+    std::size_t tgaGray8(const std::uint8_t*, std::uint8_t*, std::size_t) { return 0; }
+
+#endif
+}
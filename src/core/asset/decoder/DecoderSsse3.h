@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/CpuFeatures.h"
+
+// SSSE3-Kernel für DdsDecoder/TgaDecoder.
+//
+// DecoderSsse3.cpp wird als einzige Datei mit -mssse3 gebaut (CMake, MSVC
+// braucht kein Flag), der Rest des Decoders bleibt SSE2-Baseline. Aufrufer
+// prüfen ssse3Available() und nehmen sonst ihren skalaren Pfad.
+namespace asset::simd
+{
+    // false, wenn der Compiler die Kernel nicht gebaut hat (kein x86 / kein Flag)
+    bool ssse3KernelsCompiled();
+
+    inline bool ssse3Available()
+    {
+        static const bool s = ssse3KernelsCompiled() && core::cpu::hasSsse3();
+        return s;
+    }
+
+    // ---- BCn (DdsDecoder) ----
+    // palette: 4 Farben RGBA (16 Byte, 16-aligned), ctrl: je Zeile die
+    // 16-Byte-Gather-Maske (16-aligned), alpha: optional 16 Alphawerte
+    void bcColorRows(const std::uint8_t* palette,
+                     const std::uint8_t* const ctrl[4],
+                     const std::uint8_t* alpha,
+                     std::uint8_t* dst, std::size_t stride);
+
+    // BC4/BC5: R (und optional G), B = 0, A = 255
+    void bcRGRows(const std::uint8_t* r,
+                  const std::uint8_t* g,
+                  std::uint8_t* dst, std::size_t stride);
+
+    // ---- TGA -> RGBA8 (TgaDecoder) ----
+    // Rückgabe: Anzahl konvertierter Pixel (Vielfaches der Vektorbreite),
+    // den Rest erledigt der Aufrufer skalar
+    std::size_t tgaBgra32(const std::uint8_t* src, std::uint8_t* dst, std::size_t count);
+    std::size_t tgaBgr24(const std::uint8_t* src, std::uint8_t* dst, std::size_t count);
+    std::size_t tgaGray8(const std::uint8_t* src, std::uint8_t* dst, std::size_t count);
+}
@@ -71,4 +71,16 @@ namespace asset
         // 🔥 Alles andere: BMP / PNG / JPG / GIF etc.
         return decodeWithStb(out, bytes, err);
     }
+
+    bool ImageDecoder::decodeThumbnail(
+        DecodedImageData& out,
+        const BinaryData& bytes,
+        int maxWidth, int maxHeight,
+        std::string* err)
+    {
+        if (isDDS(bytes))
+            return DdsDecoder::decodeForSize(out, bytes, maxWidth, maxHeight, err);
+
+        return decode(out, bytes, err);
+    }
 }
@@ -12,6 +12,12 @@ namespace asset
     {
     public:
         static bool decode(DecodedImageData& out, const BinaryData& bytes, std::string* err);
+
+        // Vorschau: DDS liefert direkt die passende kleine Mip-Stufe,
+        // alle anderen Formate werden vollständig dekodiert.
+        static bool decodeThumbnail(DecodedImageData& out, const BinaryData& bytes,
+                                    int maxWidth, int maxHeight, std::string* err);
+
         static bool shouldDecode(const BinaryData& bytes);
         static bool isSupportedByStb(const BinaryData& bytes);
     };
@@ -3,12 +3,13 @@
 
 #include "data/asset/source/ModelSource.h"
 
+#include <span>
 #include <sstream>
 #include <iomanip>
 
 namespace asset
 {
-    static std::string hexPrefix(const std::vector<std::uint8_t>& bytes, std::size_t n)
+    static std::string hexPrefix(std::span<const std::uint8_t> bytes, std::size_t n)
     {
         const std::size_t count = (bytes.size() < n) ? bytes.size() : n;
 
@@ -30,11 +31,11 @@ namespace asset
         // Memory-only: wir ignorieren part.path vollständig
         out.exists = true;
         out.extension = part.extension; // kommt aus Loader (lower-case)
-        out.sizeBytes = static_cast<std::uint32_t>(part.bytes.bytes.size());
-        out.signatureHex = hexPrefix(part.bytes.bytes, 32);
+        out.sizeBytes = static_cast<std::uint32_t>(part.bytes.size());
+        out.signatureHex = hexPrefix(part.bytes.view(), 32);
 
         // Raw unverändert durchreichen
-        out.raw = part.bytes.bytes;
+        out.raw.assign(part.bytes.data(), part.bytes.data() + part.bytes.size());
     }
 
     bool O3DDecoder::decode(O3DDecoded& out, const ModelSource& src, std::string* outError)
@@ -1,4 +1,7 @@
 #include "O3DDecryptor.h"
+#include "data/asset/source/BinaryData.h"
+
+#include <algorithm>
 
 namespace asset
 {
@@ -16,7 +19,7 @@ std::uint8_t O3DDecryptor::decryptByte(std::uint8_t key, std::uint8_t b)
     return rot4(x);
 }
 
-std::uint32_t O3DDecryptor::readU32LE(const std::vector<std::uint8_t>& b, std::size_t off)
+std::uint32_t O3DDecryptor::readU32LE(std::span<const std::uint8_t> b, std::size_t off)
 {
     return  (static_cast<std::uint32_t>(b[off + 0])      ) |
            (static_cast<std::uint32_t>(b[off + 1]) <<  8) |
@@ -33,7 +36,7 @@ void O3DDecryptor::decryptWithKey(std::vector<std::uint8_t>& out,
         out[i] = decryptByte(key, in[i]);
 }
 
-bool O3DDecryptor::looksLikeO3DDecrypted(const std::vector<std::uint8_t>& bytes)
+bool O3DDecryptor::looksLikeO3DDecrypted(std::span<const std::uint8_t> bytes)
 {
     // Heuristik anhand GameSource Object3D::LoadObject:
     // [0] nameLen (1 byte)
@@ -59,6 +62,30 @@ bool O3DDecryptor::looksLikeO3DDecrypted(const std::vector<std::uint8_t>& bytes)
     return true;
 }
 
+// looksLikeO3DDecrypted liest höchstens nameLen(1) + 63 + version(4) Bytes.
+static constexpr std::size_t kO3DProbeBytes = 1u + 63u + 4u;
+
+bool O3DDecryptor::detectKey(std::span<const std::uint8_t> in, std::uint8_t& outKey)
+{
+    // Nur den Header entschlüsseln statt der ganzen Datei pro Kandidat.
+    const std::span<const std::uint8_t> head = in.first(std::min(in.size(), kO3DProbeBytes));
+
+    std::uint8_t probe[kO3DProbeBytes];
+    for (int k = 0; k <= 255; ++k)
+    {
+        const std::uint8_t key = static_cast<std::uint8_t>(k);
+        for (std::size_t i = 0; i < head.size(); ++i)
+            probe[i] = decryptByte(key, head[i]);
+
+        if (looksLikeO3DDecrypted(std::span<const std::uint8_t>(probe, head.size())))
+        {
+            outKey = key;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool O3DDecryptor::decryptAuto(std::vector<std::uint8_t>& out,
                                const std::vector<std::uint8_t>& in,
                                std::uint8_t* outUsedKey,
@@ -74,21 +101,42 @@ bool O3DDecryptor::decryptAuto(std::vector<std::uint8_t>& out,
         return true;
     }
 
-    // brute-force key 0..255
-    std::vector<std::uint8_t> candidate;
-    for (int k = 0; k <= 255; ++k)
+    std::uint8_t key = 0;
+    if (detectKey(in, key))
     {
-        decryptWithKey(candidate, in, static_cast<std::uint8_t>(k));
-        if (looksLikeO3DDecrypted(candidate))
-        {
-            out = std::move(candidate);
-            if (outUsedKey) *outUsedKey = static_cast<std::uint8_t>(k);
-            return true;
-        }
+        decryptWithKey(out, in, key);
+        if (outUsedKey) *outUsedKey = key;
+        return true;
     }
 
     if (outError)
         *outError = "O3DDecryptor::decryptAuto: no plausible key found (0..255).";
     return false;
 }
+
+bool O3DDecryptor::decryptAutoInPlace(BinaryData& data,
+                                      std::uint8_t* outUsedKey,
+                                      std::string* outError)
+{
+    if (looksLikeO3DDecrypted(data.view()))
+    {
+        if (outUsedKey) *outUsedKey = 0xFF; // sentinel: "no decryption applied"
+        return true;
+    }
+
+    std::uint8_t key = 0;
+    if (!detectKey(data.view(), key))
+    {
+        if (outError)
+            *outError = "O3DDecryptor::decryptAuto: no plausible key found (0..255).";
+        return false;
+    }
+
+    std::vector<std::uint8_t>& bytes = data.mutableBytes();
+    for (std::uint8_t& b : bytes)
+        b = decryptByte(key, b);
+
+    if (outUsedKey) *outUsedKey = key;
+    return true;
+}
 }
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace asset
 {
+struct BinaryData;
+
 class O3DDecryptor
 {
 public:
@@ -22,9 +25,18 @@ public:
                             std::uint8_t* outUsedKey = nullptr,
                             std::string* outError = nullptr);
 
+    // Same detection as decryptAuto, but the key is probed on the header only
+    // and the buffer is decrypted in place. Already-decrypted data is left
+    // untouched (a mapped view stays mapped); otherwise it is promoted to an
+    // owned copy first (copy-on-write).
+    static bool decryptAutoInPlace(BinaryData& data,
+                                   std::uint8_t* outUsedKey = nullptr,
+                                   std::string* outError = nullptr);
+
 private:
     static std::uint8_t decryptByte(std::uint8_t key, std::uint8_t b);
-    static bool looksLikeO3DDecrypted(const std::vector<std::uint8_t>& bytes);
-    static std::uint32_t readU32LE(const std::vector<std::uint8_t>& b, std::size_t off);
+    static bool looksLikeO3DDecrypted(std::span<const std::uint8_t> bytes);
+    static bool detectKey(std::span<const std::uint8_t> in, std::uint8_t& outKey);
+    static std::uint32_t readU32LE(std::span<const std::uint8_t> b, std::size_t off);
 };
 }
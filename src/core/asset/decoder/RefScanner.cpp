@@ -0,0 +1,181 @@
+#include "core/asset/decoder/RefScanner.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define REF_SCAN_SSE2 1
+#else
+#define REF_SCAN_SSE2 0
+#endif
+
+namespace asset
+{
+    namespace
+    {
+        // Bitmaske "druckbar" für 16 Bytes ab p (Bit i = p[i])
+#if REF_SCAN_SSE2
+        inline std::uint32_t printableMask16(const std::uint8_t* p)
+        {
+            // signed Vergleich: Bytes >= 0x80 sind negativ und fallen bei > 31 raus
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i ge = _mm_cmpgt_epi8(v, _mm_set1_epi8(31));
+            const __m128i le = _mm_cmplt_epi8(v, _mm_set1_epi8(127));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(ge, le)));
+        }
+#endif
+
+        // erste Position >= i, deren Byte (nicht) druckbar ist
+        std::size_t findBoundary(const std::uint8_t* p, std::size_t i, std::size_t n, bool printable)
+        {
+#if REF_SCAN_SSE2
+            for (; i + 16 <= n; i += 16)
+            {
+                std::uint32_t m = printableMask16(p + i);
+                if (!printable)
+                    m = ~m & 0xFFFFu;
+                if (m)
+                    return i + static_cast<std::size_t>(std::countr_zero(m));
+            }
+#endif
+            for (; i < n; ++i)
+                if (RefScanner::isPrintable(p[i]) == printable)
+                    return i;
+            return n;
+        }
+
+        // Umgekehrter Trie über alle Endungen (inkl. '.'), Kinder als kleine Arrays.
+        struct ExtTrie
+        {
+            struct Node
+            {
+                char c[16] = {};
+                std::uint8_t next[16] = {};
+                std::uint8_t count = 0;
+                RefExt term = RefExt::None;
+            };
+
+            Node nodes[64];
+            std::uint8_t used = 1;
+
+            void add(const char* ext, RefExt cls)
+            {
+                std::size_t len = 0;
+                while (ext[len]) ++len;
+
+                std::uint8_t cur = 0;
+                for (std::size_t k = len; k-- > 0;)
+                {
+                    Node& n = nodes[cur];
+                    std::uint8_t nx = 0;
+                    for (std::uint8_t j = 0; j < n.count; ++j)
+                        if (n.c[j] == ext[k]) { nx = n.next[j]; break; }
+
+                    if (!nx)
+                    {
+                        nx = used++;
+                        n.c[n.count] = ext[k];
+                        n.next[n.count] = nx;
+                        ++n.count;
+                    }
+                    cur = nx;
+                }
+                nodes[cur].term = cls;
+            }
+        };
+
+        const ExtTrie& extTrie()
+        {
+            static const ExtTrie trie = []
+            {
+                ExtTrie t;
+                for (const char* e : { ".dds", ".tga", ".png", ".jpg", ".jpeg", ".bmp" }) t.add(e, RefExt::Image);
+                for (const char* e : { ".wav", ".ogg", ".mp3", ".bgm" })                  t.add(e, RefExt::Sound);
+                for (const char* e : { ".o3d", ".ase" })                                   t.add(e, RefExt::Model);
+                t.add(".ani", RefExt::Animation);
+                t.add(".sfx", RefExt::Sfx);
+                return t;
+            }();
+            return trie;
+        }
+    }
+
+    void RefScanner::forEachAsciiRun(std::span<const std::uint8_t> buf,
+                                     const std::function<void(std::size_t, std::size_t)>& fn)
+    {
+        const std::uint8_t* p = buf.data();
+        const std::size_t n = buf.size();
+
+        std::size_t i = 0;
+        while (i < n)
+        {
+            const std::size_t begin = findBoundary(p, i, n, true);
+            if (begin >= n)
+                break;
+            const std::size_t end = findBoundary(p, begin, n, false);
+
+            std::size_t s = begin;
+            while (end - s > kMaxRun)
+            {
+                fn(s, kMaxRun);
+                s += kMaxRun;
+            }
+            if (end - s >= kMinRun)
+                fn(s, end - s);
+
+            i = end;
+        }
+    }
+
+    RefExt RefScanner::classifyExtension(std::string_view s)
+    {
+        const ExtTrie& t = extTrie();
+
+        std::uint8_t cur = 0;
+        for (std::size_t k = s.size(); k-- > 0;)
+        {
+            const char c = foldChar(s[k]);
+            const ExtTrie::Node& n = t.nodes[cur];
+
+            std::uint8_t nx = 0;
+            for (std::uint8_t j = 0; j < n.count; ++j)
+                if (n.c[j] == c) { nx = n.next[j]; break; }
+
+            if (!nx)
+                return RefExt::None;
+            if (t.nodes[nx].term != RefExt::None)
+                return t.nodes[nx].term;
+            cur = nx;
+        }
+        return RefExt::None;
+    }
+
+    std::string RefScanner::fold(std::string_view raw)
+    {
+        std::string s(raw);
+        for (char& c : s)
+            c = foldChar(c);
+        return s;
+    }
+
+    std::size_t RefScanner::FoldedHash::operator()(std::string_view s) const noexcept
+    {
+        std::uint64_t h = 1469598103934665603ull;
+        for (char c : s)
+        {
+            h ^= static_cast<std::uint8_t>(foldChar(c));
+            h *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(h);
+    }
+
+    bool RefScanner::FoldedEqual::operator()(std::string_view a, std::string_view b) const noexcept
+    {
+        if (a.size() != b.size())
+            return false;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            if (foldChar(a[i]) != foldChar(b[i]))
+                return false;
+        return true;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace asset
+{
+    // Endungsklasse bekannter FlyFF-Referenzen
+    enum class RefExt : std::uint8_t
+    {
+        None,
+        Image,      // dds/tga/png/jpg/jpeg/bmp
+        Sound,      // wav/ogg/mp3/bgm
+        Model,      // o3d/ase
+        Animation,  // ani
+        Sfx         // sfx
+    };
+
+    // Gemeinsamer Referenz-Scanner für SfxDecoder/AniDecoder.
+    //
+    // - ASCII-Läufe werden mit SSE2 (16 Bytes pro Schritt) gesucht und nur als
+    //   (offset, length) in den Puffer gemeldet – keine std::string pro Kandidat.
+    // - Endungen werden über einen umgekehrten Trie vom Stringende aus erkannt
+    //   (ein Durchlauf, case-insensitive, ohne lowercased Kopie).
+    // - Dedupe über gefaltete Views (lower-case, '\\' -> '/') direkt im Puffer.
+    struct RefScanner
+    {
+        static constexpr std::size_t kMinRun = 4;
+        static constexpr std::size_t kMaxRun = 513; // wie bisher: Umbruch nach >512 Zeichen
+
+        static bool isPrintable(std::uint8_t c) { return c >= 32 && c <= 126; }
+
+        static char foldChar(char c)
+        {
+            if (c >= 'A' && c <= 'Z') return static_cast<char>(c - 'A' + 'a');
+            if (c == '\\') return '/';
+            return c;
+        }
+
+        // Druckbare Läufe (32..126), getrennt an allen anderen Bytes,
+        // nach kMaxRun Zeichen umgebrochen; gemeldet werden nur Läufe >= kMinRun.
+        static void forEachAsciiRun(std::span<const std::uint8_t> buf,
+                                    const std::function<void(std::size_t offset, std::size_t length)>& fn);
+
+        static RefExt classifyExtension(std::string_view s);
+
+        // lower-case + Pfadtrenner normalisiert (nur für neue, eindeutige Strings)
+        static std::string fold(std::string_view raw);
+
+        struct FoldedHash
+        {
+            std::size_t operator()(std::string_view s) const noexcept;
+        };
+
+        struct FoldedEqual
+        {
+            bool operator()(std::string_view a, std::string_view b) const noexcept;
+        };
+
+        using FoldedSet = std::unordered_set<std::string_view, FoldedHash, FoldedEqual>;
+    };
+}
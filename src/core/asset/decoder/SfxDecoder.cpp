@@ -1,161 +1,28 @@
 #include "data/asset/decoded/DecodedSfxData.h"
 #include "asset/source/BinaryData.h"
+#include "core/asset/decoder/RefScanner.h"
+#include "core/asset/decoder/BinaryReader.h"
 
-#include <cctype>
 #include <cstdint>
-#include <cstring>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 #include <algorithm>
 
 namespace asset
 {
-    static std::string toLowerLocal(std::string s)
-    {
-        for (char& c : s)
-            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-        return s;
-    }
-
-    static bool isPrintableAscii(std::uint8_t c)
-    {
-        // erlaubtes Set für Pfade/Dateinamen (relativ tolerant)
-        return (c >= 32 && c <= 126);
-    }
-
-    static std::string normalizePathLike(std::string s)
-    {
-        for (char& c : s)
-        {
-            if (c == '\\') c = '/';
-        }
-        return s;
-    }
-
-    static bool endsWith(const std::string& s, const char* suffix)
-    {
-        const std::size_t sl = s.size();
-        const std::size_t tl = std::strlen(suffix);
-        if (sl < tl) return false;
-        return s.compare(sl - tl, tl, suffix) == 0;
-    }
-
-    static bool looksLikeAssetRef(const std::string& s)
-    {
-        // Minimal: muss einen Punkt haben und nicht zu kurz sein
-        if (s.size() < 5) return false;
-        if (s.find('.') == std::string::npos) return false;
-
-        // Häufige Flyff-Referenzen
-        static const char* exts[] = {
-            ".dds",".tga",".png",".jpg",".jpeg",".bmp",
-            ".wav",".ogg",".mp3",".bgm",
-            ".o3d",".ase",".ani",
-            ".sfx"
-        };
-
-        for (auto* e : exts)
-            if (endsWith(s, e)) return true;
-
-        return false;
-    }
-
-    static void pushUnique(std::vector<std::string>& out, std::unordered_set<std::string>& seen, const std::string& v)
-    {
-        if (v.empty()) return;
-        if (seen.insert(v).second)
-            out.push_back(v);
-    }
-
-    static void classifyAndStore(
-        const std::string& vLower,
-        DecodedSfxData& out,
-        std::unordered_set<std::string>& seenImages,
-        std::unordered_set<std::string>& seenSounds,
-        std::unordered_set<std::string>& seenModels,
-        std::unordered_set<std::string>& seenSfx,
-        std::unordered_set<std::string>& seenOther)
-    {
-        if (endsWith(vLower, ".dds") || endsWith(vLower, ".tga") || endsWith(vLower, ".png") ||
-            endsWith(vLower, ".jpg") || endsWith(vLower, ".jpeg") || endsWith(vLower, ".bmp"))
-        {
-            pushUnique(out.refImages, seenImages, vLower);
-            return;
-        }
-        if (endsWith(vLower, ".wav") || endsWith(vLower, ".ogg") || endsWith(vLower, ".mp3") || endsWith(vLower, ".bgm"))
-        {
-            pushUnique(out.refSounds, seenSounds, vLower);
-            return;
-        }
-        if (endsWith(vLower, ".o3d") || endsWith(vLower, ".ase") || endsWith(vLower, ".ani"))
-        {
-            pushUnique(out.refModels, seenModels, vLower);
-            return;
-        }
-        if (endsWith(vLower, ".sfx"))
-        {
-            pushUnique(out.refSfx, seenSfx, vLower);
-            return;
-        }
-
-        // Fallback: irgendwas mit dot
-        pushUnique(out.refOther, seenOther, vLower);
-    }
-
-    static std::uint32_t readU32LE(const std::uint8_t* p)
-    {
-        return (std::uint32_t)p[0] |
-               ((std::uint32_t)p[1] << 8) |
-               ((std::uint32_t)p[2] << 16) |
-               ((std::uint32_t)p[3] << 24);
-    }
-
-    // --- Strategy 1: Null-terminated / raw ASCII sequences scan ---
-    static void extractAsciiRuns(const std::vector<std::uint8_t>& buf, std::vector<std::string>& outStrings)
-    {
-        std::string cur;
-        cur.reserve(256);
-
-        auto flush = [&]()
-        {
-            if (cur.size() >= 4)
-                outStrings.push_back(cur);
-            cur.clear();
-        };
-
-        for (std::size_t i = 0; i < buf.size(); ++i)
-        {
-            const std::uint8_t c = buf[i];
-            if (c == 0)
-            {
-                flush();
-                continue;
-            }
-
-            if (isPrintableAscii(c))
-            {
-                cur.push_back((char)c);
-                // harte Grenze, damit wir nicht riesige Blöcke sammeln
-                if (cur.size() > 512)
-                    flush();
-            }
-            else
-            {
-                flush();
-            }
-        }
-        flush();
-    }
-
     // --- Strategy 2: Length-prefixed strings (legacy) ---
-    static void extractLengthPrefixedStrings(const std::vector<std::uint8_t>& buf, std::vector<std::string>& outStrings)
+    template <class Fn>
+    static void forEachLengthPrefixedString(std::span<const std::uint8_t> buf, Fn&& fn)
     {
         // Wir scannen "sliding window" nach plausiblen [u32 len][len bytes printable]
         // len darf nicht zu groß sein, und muss path-like sein.
+        const decode::BinaryReader br(buf);
         for (std::size_t i = 0; i + 8 <= buf.size(); ++i)
         {
-            const std::uint32_t len = readU32LE(buf.data() + i);
+            const std::uint32_t len = *br.peekAt<std::uint32_t>(i);
             if (len < 4 || len > 260)
                 continue;
 
@@ -167,7 +34,7 @@ namespace asset
             bool ok = true;
             for (std::size_t k = start; k < end; ++k)
             {
-                if (!isPrintableAscii(buf[k]))
+                if (!RefScanner::isPrintable(buf[k]))
                 {
                     ok = false;
                     break;
@@ -176,13 +43,11 @@ namespace asset
             if (!ok)
                 continue;
 
-            std::string s((const char*)buf.data() + start, (const char*)buf.data() + end);
-            if (s.size() >= 4)
-                outStrings.push_back(s);
+            fn(std::string_view((const char*)buf.data() + start, (std::size_t)len));
         }
     }
 
-    static bool startsWithSfxHeader(const std::vector<std::uint8_t>& buf, std::string& outVer)
+    static bool startsWithSfxHeader(std::span<const std::uint8_t> buf, std::string& outVer)
     {
         if (buf.size() < 6) return false;
         if (!(buf[0] == 'S' && buf[1] == 'F' && buf[2] == 'X' && buf[3] == '0' && buf[4] == '.'))
@@ -201,24 +66,223 @@ namespace asset
         return true;
     }
 
+    // ==================================================
+    // Strukturierter Parser (SFX0.x)
+    // ==================================================
+    //
+    // Layout (little endian, gepackt):
+    //   [8]  "SFX0.n  "                  (fehlt bei Legacy -> Version 0)
+    //   u32  partCount
+    //   pro Part:
+    //     u32  type                      (SfxPartType)
+    //     str  name                      (ab 0.2)
+    //     str  texture                   (Mesh: Modellname)
+    //     u16  texFrame, u16 texLoop
+    //     u32  visible                   (ab 0.3)
+    //     u32  billType, u32 alphaType
+    //     Particle: 5x u16, 6x f32, 4x vec3
+    //     u32  keyCount, keyCount x { u16 frame, 4x vec3, i32 alpha }
+    //   str = u32 len + len Bytes (druckbar, evtl. mit '\0' am Ende)
+    //
+    // Jede Abweichung (Grenzen, unplausible Werte, Restbytes) -> false,
+    // der Aufrufer fällt dann auf den String-Scan zurück.
+    namespace
+    {
+        using decode::BinaryReader;
+
+        constexpr std::uint32_t kMaxParts = 1024;
+        constexpr std::uint32_t kMaxString = 260;
+        constexpr std::size_t kKeyBytes = 2 + 4 * 12 + 4;
+
+        bool readString(BinaryReader& br, std::string& out)
+        {
+            const auto len = br.readLE<std::uint32_t>();
+            if (!len || *len > kMaxString)
+                return false;
+
+            const auto span = br.readSpan(*len);
+            if (!span)
+                return false;
+            const std::span<const std::uint8_t> bytes = *span;
+
+            std::size_t n = bytes.size();
+            while (n > 0 && bytes[n - 1] == 0)
+                --n;
+
+            out.clear();
+            out.reserve(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (!RefScanner::isPrintable(bytes[i]))
+                    return false;
+                out.push_back(RefScanner::foldChar(static_cast<char>(bytes[i])));
+            }
+            return true;
+        }
+
+        template <std::size_t N>
+        bool readFloats(BinaryReader& br, float (&out)[N])
+        {
+            return br.readArray(out);
+        }
+
+        bool readU16(BinaryReader& br, std::uint16_t& out)
+        {
+            const auto v = br.readLE<std::uint16_t>();
+            if (!v) return false;
+            out = *v;
+            return true;
+        }
+
+        bool readParticle(BinaryReader& br, SfxParticleParams& p)
+        {
+            float f[6] = {};
+            if (!readU16(br, p.createInterval) || !readU16(br, p.createCount) ||
+                !readU16(br, p.frameAppear) || !readU16(br, p.frameKeep) ||
+                !readU16(br, p.frameDisappear) || !readFloats(br, f))
+                return false;
+
+            p.startPosVar  = f[0];
+            p.startPosVarY = f[1];
+            p.yLow   = f[2];
+            p.yHigh  = f[3];
+            p.xzLow  = f[4];
+            p.xzHigh = f[5];
+
+            return readFloats(br, p.accel) && readFloats(br, p.scale) &&
+                   readFloats(br, p.rotationLow) && readFloats(br, p.rotationHigh);
+        }
+
+        bool readPart(BinaryReader& br, int version, SfxPart& part)
+        {
+            const auto type = br.readLE<std::uint32_t>();
+            if (!type || *type < 1 || *type > 4)
+                return false;
+            part.type = static_cast<SfxPartType>(*type);
+
+            if (version >= 2 && !readString(br, part.name))
+                return false;
+            if (!readString(br, part.texture))
+                return false;
+
+            if (!readU16(br, part.texFrame) || !readU16(br, part.texLoop))
+                return false;
+
+            if (version >= 3)
+            {
+                const auto visible = br.readLE<std::uint32_t>();
+                if (!visible || *visible > 1)
+                    return false;
+                part.visible = (*visible != 0);
+            }
+
+            const auto bill = br.readLE<std::uint32_t>();
+            const auto alpha = br.readLE<std::uint32_t>();
+            if (!bill || !alpha || *bill > 16 || *alpha > 16)
+                return false;
+            part.billType = *bill;
+            part.alphaType = *alpha;
+
+            if (part.type == SfxPartType::Particle && !readParticle(br, part.particle))
+                return false;
+
+            const auto keyCount = br.readLE<std::uint32_t>();
+            if (!keyCount || static_cast<std::uint64_t>(*keyCount) * kKeyBytes > br.remaining())
+                return false;
+
+            part.keys.resize(*keyCount);
+            for (SfxKeyFrame& k : part.keys)
+            {
+                if (!readU16(br, k.frame) ||
+                    !readFloats(br, k.pos) || !readFloats(br, k.posRotate) ||
+                    !readFloats(br, k.scale) || !readFloats(br, k.rotate))
+                    return false;
+
+                const auto alphaKey = br.readLE<std::int32_t>();
+                if (!alphaKey)
+                    return false;
+                k.alpha = *alphaKey;
+            }
+            return true;
+        }
+
+        bool parseStructured(std::span<const std::uint8_t> bytes, int version, std::vector<SfxPart>& outParts)
+        {
+            BinaryReader br(bytes);
+            if (version > 0 && !br.seek(8))
+                return false;
+
+            const auto partCount = br.readLE<std::uint32_t>();
+            if (!partCount || *partCount > kMaxParts)
+                return false;
+
+            outParts.clear();
+            outParts.resize(*partCount);
+            for (SfxPart& part : outParts)
+                if (!readPart(br, version, part))
+                    return false;
+
+            // alles muss aufgehen, sonst war das Layout geraten
+            return br.eof();
+        }
+
+        void collectRefs(DecodedSfxData& out)
+        {
+            std::unordered_set<std::string> seen;
+            for (const SfxPart& part : out.parts)
+            {
+                if (part.texture.empty() || !seen.insert(part.texture).second)
+                    continue;
+
+                switch (RefScanner::classifyExtension(part.texture))
+                {
+                case RefExt::Image:     out.refImages.push_back(part.texture); break;
+                case RefExt::Sound:     out.refSounds.push_back(part.texture); break;
+                case RefExt::Model:
+                case RefExt::Animation: out.refModels.push_back(part.texture); break;
+                case RefExt::Sfx:       out.refSfx.push_back(part.texture);    break;
+                case RefExt::None:      out.refOther.push_back(part.texture);  break;
+                }
+            }
+        }
+
+        int versionFromHeader(const std::string& ver)
+        {
+            // "SFX0.1" .. "SFX0.3"
+            if (ver.size() >= 6 && ver[5] >= '1' && ver[5] <= '3')
+                return ver[5] - '0';
+            return -1;
+        }
+    }
+
     bool SfxDecoder::decode(DecodedSfxData& out, const BinaryData& inBytes, std::string* outError)
+    {
+        return decode(out, inBytes, DecodeOptions{}, outError);
+    }
+
+    bool SfxDecoder::decode(DecodedSfxData& out, const BinaryData& inBytes, const DecodeOptions& opts, std::string* outError)
     {
         out = DecodedSfxData{};
-        out.raw = inBytes.bytes;
 
-        const auto& buf = inBytes.bytes;
+        const std::span<const std::uint8_t> buf = inBytes.view();
         if (buf.empty())
         {
             if (outError) *outError = "SFX: empty file.";
             return false;
         }
 
+        // Kopie nur auf Wunsch (Parts/Refs verweisen nicht in raw)
+        if (opts.keepRaw)
+            out.raw.assign(inBytes.data(), inBytes.data() + inBytes.size());
+
         // 1) Container/Version erkennen
         std::string ver;
+        int version = 0; // Legacy: kein Header
         if (startsWithSfxHeader(buf, ver))
         {
             out.containerKind = "SFX0x";
             out.version = ver;
+            version = versionFromHeader(ver);
         }
         else
         {
@@ -226,37 +290,46 @@ namespace asset
             out.version.clear(); // unknown
         }
 
-        // 2) Strings extrahieren (beide Strategien)
-        std::vector<std::string> found;
-        found.reserve(256);
-
-        extractAsciiRuns(buf, found);
-        extractLengthPrefixedStrings(buf, found);
-
-        // 3) Normalize + dedupe + classify
-        std::unordered_set<std::string> seenAll;
-        std::unordered_set<std::string> seenImages, seenSounds, seenModels, seenSfx, seenOther;
+        // 2) Strukturiert parsen -> exakte Parts/Keys/Refs, kein String-Scan
+        if (version >= 0 && parseStructured(buf, version, out.parts))
+        {
+            out.structured = true;
+            collectRefs(out);
+            return true;
+        }
+        out.parts.clear();
 
-        out.allStrings.reserve(found.size());
+        // 3) Fallback: Strings extrahieren (beide Strategien) + dedupe + classify in einem Zug.
+        //    Kandidaten sind Views in den Puffer; nur neue Strings werden kopiert.
+        RefScanner::FoldedSet seen;
+        seen.reserve(256);
 
-        for (auto& s : found)
+        auto consider = [&](std::string_view raw)
         {
-            s = normalizePathLike(s);
-            s = toLowerLocal(s);
+            if (!seen.insert(raw).second)
+                return;
 
-            // Mini-Filter: zu viele Spaces/komische Sequenzen rauswerfen
-            // (aber nicht zu aggressiv sein)
-            if (s.size() < 4)
-                continue;
+            std::string s = RefScanner::fold(raw);
 
-            // allStrings (dedupe)
-            if (seenAll.insert(s).second)
-                out.allStrings.push_back(s);
+            // Referenz: mindestens 5 Zeichen und bekannte Endung
+            switch (s.size() >= 5 ? RefScanner::classifyExtension(s) : RefExt::None)
+            {
+            case RefExt::Image:     out.refImages.push_back(s); break;
+            case RefExt::Sound:     out.refSounds.push_back(s); break;
+            case RefExt::Model:
+            case RefExt::Animation: out.refModels.push_back(s); break;
+            case RefExt::Sfx:       out.refSfx.push_back(s);    break;
+            case RefExt::None:      break;
+            }
 
-            // refs
-            if (looksLikeAssetRef(s))
-                classifyAndStore(s, out, seenImages, seenSounds, seenModels, seenSfx, seenOther);
-        }
+            out.allStrings.push_back(std::move(s));
+        };
+
+        RefScanner::forEachAsciiRun(buf, [&](std::size_t off, std::size_t len)
+        {
+            consider(std::string_view((const char*)buf.data() + off, len));
+        });
+        forEachLengthPrefixedString(buf, consider);
 
         // Decoder-Definition: auch wenn keine refs gefunden wurden, ist das NICHT zwingend ein Fehler.
         // Manche Effekte könnten intern sein oder ohne externe Dateien.
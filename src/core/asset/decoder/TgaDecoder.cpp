@@ -1,5 +1,7 @@
 #include "TgaDecoder.h"
+#include "core/asset/decoder/DecoderSsse3.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -36,9 +38,80 @@ namespace asset
         return true;
     }
 
-    static void writePixelRGBA(std::uint8_t* dst, std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+    enum class TgaPixelKind
     {
-        dst[0] = r; dst[1] = g; dst[2] = b; dst[3] = a;
+        Gray8,
+        BGR24,
+        BGRA32
+    };
+
+    // Konvertiert 'count' zusammenhängende Quellpixel nach RGBA8.
+    // Bounds werden vom Aufrufer einmal für den ganzen Lauf geprüft.
+    static void convertPixels(TgaPixelKind kind, const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        // SSSE3 pshufb für volle Vektoren, Rest skalar (Auswahl zur Laufzeit)
+        if (simd::ssse3Available())
+        {
+            switch (kind)
+            {
+            case TgaPixelKind::BGRA32: i = simd::tgaBgra32(src, dst, count); break;
+            case TgaPixelKind::BGR24:  i = simd::tgaBgr24(src, dst, count);  break;
+            case TgaPixelKind::Gray8:  i = simd::tgaGray8(src, dst, count);  break;
+            }
+        }
+
+        switch (kind)
+        {
+        case TgaPixelKind::BGRA32:
+            for (; i < count; ++i)
+            {
+                const std::uint8_t* p = src + i * 4;
+                std::uint8_t* d = dst + i * 4;
+                d[0] = p[2]; d[1] = p[1]; d[2] = p[0]; d[3] = p[3];
+            }
+            break;
+        case TgaPixelKind::BGR24:
+            for (; i < count; ++i)
+            {
+                const std::uint8_t* p = src + i * 3;
+                std::uint8_t* d = dst + i * 4;
+                d[0] = p[2]; d[1] = p[1]; d[2] = p[0]; d[3] = 255;
+            }
+            break;
+        case TgaPixelKind::Gray8:
+            for (; i < count; ++i)
+            {
+                std::uint8_t* d = dst + i * 4;
+                d[0] = d[1] = d[2] = src[i]; d[3] = 255;
+            }
+            break;
+        }
+    }
+
+    // Füllt 'count' Pixel mit einem RGBA-Wert (memset, falls alle Bytes gleich,
+    // sonst durch Verdoppeln der bereits geschriebenen Pixel).
+    static void fillPixels(std::uint8_t* dst, const std::uint8_t rgba[4], std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        if (rgba[0] == rgba[1] && rgba[1] == rgba[2] && rgba[2] == rgba[3])
+        {
+            std::memset(dst, rgba[0], count * 4);
+            return;
+        }
+
+        std::memcpy(dst, rgba, 4);
+
+        std::size_t done = 1;
+        while (done < count)
+        {
+            const std::size_t n = std::min(done, count - done);
+            std::memcpy(dst + done * 4, dst, n * 4);
+            done += n;
+        }
     }
 
     bool TgaDecoder::decode(DecodedImageData& out, const BinaryData& bytes, std::string* err)
@@ -93,49 +166,55 @@ namespace asset
         std::uint8_t* dst = out.rgba.data();
         const bool originTop = (h.imageDescriptor & 0x20) != 0;
 
-        auto putPixelAt = [&](std::size_t linearIndex, std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
-        {
-            std::size_t x = linearIndex % w;
-            std::size_t y = linearIndex / w;
-            if (!originTop)
-                y = (hgt - 1) - y;
+        const TgaPixelKind kind = gray ? TgaPixelKind::Gray8
+                                : (srcPixelSize == 4) ? TgaPixelKind::BGRA32
+                                : TgaPixelKind::BGR24;
 
-            std::size_t outIndex = (y * w + x) * 4;
-            writePixelRGBA(dst + outIndex, r, g, b, a);
+        // Ruft fn(dstRow, runOffset, n) für jeden Zeilenabschnitt eines
+        // Laufs ab Pixel 'start' auf (Bottom-up-Zeilen werden gespiegelt).
+        auto forEachRowSegment = [&](std::size_t start, std::size_t count, auto&& fn)
+        {
+            std::size_t done = 0;
+            while (done < count)
+            {
+                const std::size_t linear = start + done;
+                const std::size_t x = linear % w;
+                std::size_t y = linear / w;
+                if (!originTop)
+                    y = (hgt - 1) - y;
+
+                const std::size_t n = std::min<std::size_t>(count - done, w - x);
+                fn(dst + (y * w + x) * 4, done, n);
+                done += n;
+            }
         };
 
-        auto readOnePixel = [&](std::size_t& off, std::uint8_t& r, std::uint8_t& g, std::uint8_t& b, std::uint8_t& a) -> bool
+        // Wie viele ganze Pixel ab 'off' noch in der Datei liegen
+        auto pixelsAvailable = [&](std::size_t off) -> std::size_t
         {
-            if (off + srcPixelSize > bytes.size())
-                return false;
+            return (off >= bytes.size()) ? 0 : (bytes.size() - off) / srcPixelSize;
+        };
 
-            const std::uint8_t* p = bytes.data() + off;
-            off += srcPixelSize;
+        // Rohpixel konvertieren; bei zu wenig Daten wird der vorhandene Teil
+        // noch geschrieben (wie bisher) und false geliefert.
+        auto convertRun = [&](std::size_t start, std::size_t count, std::size_t& off) -> bool
+        {
+            const std::size_t n = std::min(count, pixelsAvailable(off));
+            const std::uint8_t* src = bytes.data() + off;
 
-            if (gray)
+            forEachRowSegment(start, n, [&](std::uint8_t* d, std::size_t runOff, std::size_t segLen)
             {
-                r = g = b = p[0];
-                a = 255;
-                return true;
-            }
+                convertPixels(kind, src + runOff * srcPixelSize, d, segLen);
+            });
 
-            b = p[0];
-            g = p[1];
-            r = p[2];
-            a = (srcPixelSize == 4) ? p[3] : 255;
-            return true;
+            off += n * srcPixelSize;
+            return n == count;
         };
 
         if (!rle)
         {
-            for (std::size_t i = 0; i < pixelCount; ++i)
-            {
-                std::uint8_t r = 0, g = 0, b = 0, a = 255;
-                if (!readOnePixel(offset, r, g, b, a))
-                    return fail(err, "TGA: unexpected end of file while reading pixels");
-
-                putPixelAt(i, r, g, b, a);
-            }
+            if (!convertRun(0, pixelCount, offset))
+                return fail(err, "TGA: unexpected end of file while reading pixels");
             return true;
         }
 
@@ -146,27 +225,28 @@ namespace asset
                 return fail(err, "TGA: unexpected end of file in RLE stream");
 
             std::uint8_t packetHeader = bytes.data()[offset++];
-            std::size_t count = (packetHeader & 0x7Fu) + 1u;
+            const std::size_t count = std::min<std::size_t>((packetHeader & 0x7Fu) + 1u, pixelCount - written);
 
             if (packetHeader & 0x80u)
             {
-                std::uint8_t r = 0, g = 0, b = 0, a = 255;
-                if (!readOnePixel(offset, r, g, b, a))
+                if (pixelsAvailable(offset) < 1)
                     return fail(err, "TGA: unexpected end of file in RLE pixel");
 
-                for (std::size_t k = 0; k < count && written < pixelCount; ++k)
-                    putPixelAt(written++, r, g, b, a);
+                std::uint8_t rgba[4];
+                convertPixels(kind, bytes.data() + offset, rgba, 1);
+                offset += srcPixelSize;
+
+                forEachRowSegment(written, count, [&](std::uint8_t* d, std::size_t, std::size_t segLen)
+                {
+                    fillPixels(d, rgba, segLen);
+                });
+                written += count;
             }
             else
             {
-                for (std::size_t k = 0; k < count && written < pixelCount; ++k)
-                {
-                    std::uint8_t r = 0, g = 0, b = 0, a = 255;
-                    if (!readOnePixel(offset, r, g, b, a))
-                        return fail(err, "TGA: unexpected end of file in raw packet");
-
-                    putPixelAt(written++, r, g, b, a);
-                }
+                if (!convertRun(written, count, offset))
+                    return fail(err, "TGA: unexpected end of file in raw packet");
+                written += count;
             }
         }
 
@@ -0,0 +1,234 @@
+#include "core/asset/io/AssetIoService.h"
+#include "core/asset/io/MappedFile.h"
+
+#include "core/TaskSystem.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace asset::io
+{
+    // ------------------------------------------------------------
+    // BufferPool
+    // ------------------------------------------------------------
+    std::vector<std::uint8_t> BufferPool::acquire(std::size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // kleinster passender Puffer (Pool ist klein, linear reicht)
+            std::size_t best = m_free.size();
+            for (std::size_t i = 0; i < m_free.size(); ++i)
+            {
+                if (m_free[i].capacity() < size)
+                    continue;
+                if (best == m_free.size() || m_free[i].capacity() < m_free[best].capacity())
+                    best = i;
+            }
+
+            if (best != m_free.size())
+            {
+                std::vector<std::uint8_t> buf = std::move(m_free[best]);
+                m_free[best] = std::move(m_free.back());
+                m_free.pop_back();
+                m_pooledBytes -= buf.capacity();
+
+                buf.resize(size);
+                return buf;
+            }
+        }
+
+        std::vector<std::uint8_t> buf;
+        buf.resize(size);
+        return buf;
+    }
+
+    void BufferPool::release(std::vector<std::uint8_t>&& buf)
+    {
+        const std::size_t cap = buf.capacity();
+        if (cap == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pooledBytes + cap > m_maxPooledBytes)
+            return; // Pool voll -> Puffer wird freigegeben
+
+        buf.clear();
+        m_pooledBytes += cap;
+        m_free.emplace_back(std::move(buf));
+    }
+
+    std::size_t BufferPool::pooledBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pooledBytes;
+    }
+
+    // ------------------------------------------------------------
+    // AssetIoService
+    // ------------------------------------------------------------
+    AssetIoService::AssetIoService()
+        : AssetIoService(Settings{})
+    {
+    }
+
+    AssetIoService::AssetIoService(Settings settings, core::TaskSystem* tasks)
+        : m_settings(settings)
+        , m_tasks(tasks ? tasks : &core::TaskSystem::instance())
+    {
+    }
+
+    bool AssetIoService::readFileInto(const fs::path& p,
+                                      std::uint64_t size,
+                                      std::vector<std::uint8_t>& buf,
+                                      std::string* err)
+    {
+        std::ifstream f(p, std::ios::binary);
+        if (!f)
+        {
+            if (err) *err = "cannot open file: " + p.string();
+            return false;
+        }
+
+        buf.resize(static_cast<std::size_t>(size));
+        if (size > 0)
+        {
+            f.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(size));
+            if (!f)
+            {
+                if (err) *err = "read failed: " + p.string();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool AssetIoService::wantsMap(ReadMode mode, std::uint64_t size)
+    {
+        if (size == 0)
+            return false;
+
+        switch (mode)
+        {
+        case ReadMode::Map:  return true;
+        case ReadMode::Auto: return size >= kMapThreshold;
+        default:             return false;
+        }
+    }
+
+    bool AssetIoService::tryMap(const fs::path& p, BinaryData& out)
+    {
+        // Fehler hier sind nicht fatal: der Aufrufer fällt auf den Heap-Read zurück.
+        std::shared_ptr<MappedFile> mf = MappedFile::open(p, nullptr);
+        if (!mf)
+            return false;
+
+        const std::uint8_t* ptr = mf->data();
+        const std::size_t size = mf->size();
+        out = BinaryData::fromView(std::move(mf), ptr, size);
+        return true;
+    }
+
+    bool AssetIoService::readFile(const fs::path& p, BinaryData& out, std::string* err, ReadMode mode)
+    {
+        std::error_code ec;
+        const std::uint64_t size = fs::file_size(p, ec);
+        if (ec)
+        {
+            if (err) *err = "cannot open file: " + p.string() + " (" + ec.message() + ")";
+            return false;
+        }
+
+        if (wantsMap(mode, size) && tryMap(p, out))
+            return true;
+
+        std::vector<std::uint8_t> buf;
+        if (!readFileInto(p, size, buf, err))
+            return false;
+
+        out.assign(std::move(buf));
+        return true;
+    }
+
+    void AssetIoService::acquireBudget(std::size_t bytes)
+    {
+        if (m_settings.maxInFlightBytes == 0)
+            return;
+
+        std::unique_lock<std::mutex> lock(m_budgetMutex);
+        // Übergroße Einzeldateien dürfen laufen, sobald sonst nichts in-flight ist.
+        m_budgetCv.wait(lock, [&]
+        {
+            return m_bytesInFlight == 0 ||
+                   m_bytesInFlight + bytes <= m_settings.maxInFlightBytes;
+        });
+        m_bytesInFlight += bytes;
+    }
+
+    void AssetIoService::releaseBudget(std::size_t bytes)
+    {
+        if (m_settings.maxInFlightBytes == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_budgetMutex);
+            m_bytesInFlight -= bytes;
+        }
+        m_budgetCv.notify_all();
+    }
+
+    void AssetIoService::readBatch(const std::vector<ReadRequest>& requests, const Completion& onComplete)
+    {
+        if (requests.empty())
+            return;
+
+        const std::size_t maxInFlight = (m_settings.maxInFlight == 0)
+            ? m_tasks->workerCount() + 1
+            : m_settings.maxInFlight;
+
+        m_tasks->parallelFor(requests.size(), 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const ReadRequest& req = requests[i];
+                ReadResult result;
+
+                std::error_code ec;
+                const std::uint64_t size = fs::file_size(req.path, ec);
+                if (ec)
+                {
+                    result.ok = false;
+                    result.error = "cannot open file: " + req.path.string() + " (" + ec.message() + ")";
+                    onComplete(req, result);
+                    continue;
+                }
+
+                // Budget auch für gemappte Reads: die Completion liest/dekodiert
+                // die Seiten, die dabei resident werden
+                const std::size_t budget = static_cast<std::size_t>(size);
+                acquireBudget(budget);
+
+                if (wantsMap(req.mode, size) && tryMap(req.path, result.data))
+                {
+                    result.ok = true;
+                    onComplete(req, result);
+                    releaseBudget(budget);
+                    continue;
+                }
+
+                std::vector<std::uint8_t> buf = m_pool.acquire(budget);
+                result.ok = readFileInto(req.path, size, buf, &result.error);
+                result.data.assign(std::move(buf));
+
+                onComplete(req, result);
+
+                // nicht übernommene Puffer recyceln
+                if (!result.data.isMapped())
+                    m_pool.release(result.data.releaseBytes());
+                releaseBudget(budget);
+            }
+        }, maxInFlight);
+    }
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "data/asset/source/BinaryData.h"
+
+namespace core { class TaskSystem; }
+
+namespace asset::io
+{
+    // Wiederverwendbare Byte-Puffer für kurzlebige Reads (Sniffing/Decode).
+    // Puffer, die der Konsument nicht übernimmt, wandern zurück in den Pool.
+    class BufferPool
+    {
+    public:
+        explicit BufferPool(std::size_t maxPooledBytes = 64u * 1024u * 1024u)
+            : m_maxPooledBytes(maxPooledBytes) {}
+
+        std::vector<std::uint8_t> acquire(std::size_t size);
+        void release(std::vector<std::uint8_t>&& buf);
+
+        std::size_t pooledBytes() const;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<std::vector<std::uint8_t>> m_free;
+        std::size_t m_pooledBytes = 0;
+        std::size_t m_maxPooledBytes = 0;
+    };
+
+    enum class ReadMode
+    {
+        Copy,   // immer in einen Heap-Puffer lesen
+        Map,    // read-only Mapping (Fallback auf Copy, falls Mapping nicht möglich)
+        Auto    // Map ab AssetIoService::kMapThreshold, sonst Copy
+    };
+
+    struct ReadRequest
+    {
+        std::filesystem::path path;
+        std::size_t userIndex = 0; // frei für den Aufrufer (z.B. Slot im Ergebnis-Array)
+        ReadMode mode = ReadMode::Auto;
+    };
+
+    struct ReadResult
+    {
+        bool ok = false;
+        std::string error;
+        BinaryData data;
+    };
+
+    // Gemeinsamer Datei-I/O für alle Asset-Loader.
+    //
+    // - readFile():  synchroner Einzel-Read (1x open, 1x stat, 1x read bzw. mmap)
+    // - readBatch(): viele Reads parallel auf dem TaskSystem, begrenzt durch
+    //                maxInFlight (Requests) und maxInFlightBytes (Speicher).
+    //                Die Completion läuft auf dem Worker, der den Read gemacht hat,
+    //                und hält das Speicherbudget, bis sie zurückkehrt.
+    //
+    // Backend: portabler Thread-Pool (blockierende Reads, viele gleichzeitig).
+    // Gemappte Reads belegen keine Pool-Puffer, zählen aber mit ihrer Dateigröße
+    // gegen maxInFlightBytes (die Seiten werden in der Completion resident).
+    class AssetIoService
+    {
+    public:
+        struct Settings
+        {
+            std::size_t maxInFlight = 0;                          // 0 -> TaskSystem::workerCount() + 1
+            std::size_t maxInFlightBytes = 256u * 1024u * 1024u;  // 0 -> unbegrenzt
+        };
+
+        // Ab dieser Größe lohnt sich das Mapping gegenüber einer Heap-Kopie.
+        static constexpr std::uint64_t kMapThreshold = 64u * 1024u;
+
+        using Completion = std::function<void(const ReadRequest& req, ReadResult& result)>;
+
+        AssetIoService();
+        explicit AssetIoService(Settings settings, core::TaskSystem* tasks = nullptr);
+
+        // Blockiert, bis alle Requests gelesen und alle Completions zurückgekehrt sind.
+        void readBatch(const std::vector<ReadRequest>& requests, const Completion& onComplete);
+
+        BufferPool& bufferPool() { return m_pool; }
+
+        // Einziger synchroner Lesepfad (ersetzt die readAllBytes-Kopien der Loader).
+        static bool readFile(const std::filesystem::path& p,
+                             BinaryData& out,
+                             std::string* err,
+                             ReadMode mode = ReadMode::Auto);
+
+    private:
+        static bool wantsMap(ReadMode mode, std::uint64_t size);
+        static bool tryMap(const std::filesystem::path& p, BinaryData& out);
+
+        static bool readFileInto(const std::filesystem::path& p,
+                                 std::uint64_t size,
+                                 std::vector<std::uint8_t>& buf,
+                                 std::string* err);
+
+        void acquireBudget(std::size_t bytes);
+        void releaseBudget(std::size_t bytes);
+
+        Settings m_settings;
+        core::TaskSystem* m_tasks = nullptr;
+        BufferPool m_pool;
+
+        std::mutex m_budgetMutex;
+        std::condition_variable m_budgetCv;
+        std::size_t m_bytesInFlight = 0;
+    };
+}
@@ -0,0 +1,133 @@
+#include "core/asset/io/GatherWriter.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <climits>
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+    #include <vector>
+#endif
+
+#include <algorithm>
+#include <system_error>
+
+namespace asset::io
+{
+#if defined(_WIN32)
+
+    bool GatherWriter::write(const std::filesystem::path& outFile,
+                             std::span<const Segment> segments,
+                             std::string* err)
+    {
+        HANDLE file = CreateFileW(outFile.wstring().c_str(), GENERIC_WRITE, 0, nullptr,
+                                  CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            if (err) *err = "cannot create file: " + outFile.string();
+            return false;
+        }
+
+        bool ok = true;
+        for (const Segment& s : segments)
+        {
+            const std::uint8_t* p = s.data();
+            std::size_t left = s.size();
+
+            while (ok && left > 0)
+            {
+                const DWORD chunk = static_cast<DWORD>(std::min<std::size_t>(left, 1u << 30));
+                DWORD written = 0;
+                if (!WriteFile(file, p, chunk, &written, nullptr) || written == 0)
+                    ok = false;
+                p += written;
+                left -= written;
+            }
+
+            if (!ok)
+                break;
+        }
+
+        CloseHandle(file);
+
+        if (!ok)
+        {
+            std::error_code ec;
+            std::filesystem::remove(outFile, ec);
+            if (err) *err = "write failed: " + outFile.string();
+        }
+        return ok;
+    }
+
+#else
+
+    bool GatherWriter::write(const std::filesystem::path& outFile,
+                             std::span<const Segment> segments,
+                             std::string* err)
+    {
+        const int fd = ::open(outFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            if (err) *err = "cannot create file: " + outFile.string();
+            return false;
+        }
+
+        std::vector<iovec> iov;
+        iov.reserve(segments.size());
+        for (const Segment& s : segments)
+        {
+            if (!s.empty())
+                iov.push_back({ const_cast<std::uint8_t*>(s.data()), s.size() });
+        }
+
+        bool ok = true;
+        std::size_t first = 0;
+
+        while (ok && first < iov.size())
+        {
+            const int n = static_cast<int>(std::min<std::size_t>(iov.size() - first, IOV_MAX));
+            const ssize_t written = ::writev(fd, iov.data() + first, n);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                ok = false;
+                break;
+            }
+
+            // Teil-Write: vollständig geschriebene Segmente überspringen, Rest anpassen
+            std::size_t left = static_cast<std::size_t>(written);
+            while (first < iov.size() && left >= iov[first].iov_len)
+            {
+                left -= iov[first].iov_len;
+                ++first;
+            }
+            if (left > 0)
+            {
+                iov[first].iov_base = static_cast<std::uint8_t*>(iov[first].iov_base) + left;
+                iov[first].iov_len -= left;
+            }
+        }
+
+        if (::close(fd) != 0)
+            ok = false;
+
+        if (!ok)
+        {
+            std::error_code ec;
+            std::filesystem::remove(outFile, ec);
+            if (err) *err = "write failed: " + outFile.string();
+        }
+        return ok;
+    }
+
+#endif
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace asset::io
+{
+    // Schreibt mehrere Puffer in einem Zug in eine Datei (scatter-gather),
+    // ohne sie vorher zusammenzukopieren.
+    // - POSIX: writev (in IOV_MAX-Paketen, Teil-Writes werden fortgesetzt)
+    // - Windows: ein Handle, WriteFile pro Segment
+    // Bei Fehler wird die unvollständige Datei entfernt.
+    struct GatherWriter
+    {
+        using Segment = std::span<const std::uint8_t>;
+
+        static bool write(const std::filesystem::path& outFile,
+                          std::span<const Segment> segments,
+                          std::string* err);
+    };
+}
@@ -0,0 +1,121 @@
+#include "core/asset/io/MappedFile.h"
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace asset::io
+{
+#if defined(_WIN32)
+
+    MappedFile::~MappedFile()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(static_cast<HANDLE>(m_mapping));
+        if (m_file && m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(static_cast<HANDLE>(m_file));
+    }
+
+    std::shared_ptr<MappedFile> MappedFile::open(const std::filesystem::path& p, std::string* err)
+    {
+        std::shared_ptr<MappedFile> mf(new MappedFile());
+
+        HANDLE file = CreateFileW(p.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            if (err) *err = "cannot open file: " + p.string();
+            return nullptr;
+        }
+        mf->m_file = file;
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size))
+        {
+            if (err) *err = "cannot stat file: " + p.string();
+            return nullptr;
+        }
+        if (size.QuadPart == 0)
+            return nullptr;
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            if (err) *err = "CreateFileMapping failed: " + p.string();
+            return nullptr;
+        }
+        mf->m_mapping = mapping;
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            if (err) *err = "MapViewOfFile failed: " + p.string();
+            return nullptr;
+        }
+
+        mf->m_data = static_cast<const std::uint8_t*>(view);
+        mf->m_size = static_cast<std::size_t>(size.QuadPart);
+        return mf;
+    }
+
+#else
+
+    MappedFile::~MappedFile()
+    {
+        if (m_data)
+            munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+
+    std::shared_ptr<MappedFile> MappedFile::open(const std::filesystem::path& p, std::string* err)
+    {
+        const int fd = ::open(p.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            if (err) *err = "cannot open file: " + p.string();
+            return nullptr;
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            if (err) *err = "cannot stat file: " + p.string();
+            return nullptr;
+        }
+        if (st.st_size <= 0)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        const std::size_t size = static_cast<std::size_t>(st.st_size);
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // Mapping bleibt nach close gültig
+
+        if (view == MAP_FAILED)
+        {
+            if (err) *err = "mmap failed: " + p.string();
+            return nullptr;
+        }
+
+        std::shared_ptr<MappedFile> mf(new MappedFile());
+        mf->m_data = static_cast<const std::uint8_t*>(view);
+        mf->m_size = size;
+        return mf;
+    }
+
+#endif
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace asset::io
+{
+    // Read-only memory mapping of a whole file.
+    // Lebensdauer wird über shared_ptr geteilt (BinaryData::fromView hält sie fest).
+    class MappedFile
+    {
+    public:
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Liefert nullptr bei Fehler oder leerer Datei (leere Dateien lassen sich nicht mappen).
+        static std::shared_ptr<MappedFile> open(const std::filesystem::path& p, std::string* err);
+
+        const std::uint8_t* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+    private:
+        MappedFile() = default;
+
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0;
+
+#if defined(_WIN32)
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+    };
+}
@@ -3,39 +3,12 @@
 #include "index/AssetIndexBuilder.h"
 #include "data/asset/source/AnimationSource.h"
 #include "data/asset/source/AssetSourceBase.h"
-
-#include <fstream>
+#include "core/asset/io/AssetIoService.h"
 
 namespace fs = std::filesystem;
 
 namespace asset
 {
-    static bool readAllBytes(const fs::path& p, BinaryData& out, std::string* err)
-    {
-        std::ifstream f(p, std::ios::binary);
-        if (!f)
-        {
-            if (err) *err = "cannot open file: " + p.string();
-            return false;
-        }
-
-        f.seekg(0, std::ios::end);
-        const auto size = static_cast<size_t>(f.tellg());
-        f.seekg(0, std::ios::beg);
-
-        out.bytes.resize(size);
-        if (size > 0)
-        {
-            f.read(reinterpret_cast<char*>(out.bytes.data()), static_cast<std::streamsize>(size));
-            if (!f)
-            {
-                if (err) *err = "failed to read file: " + p.string();
-                return false;
-            }
-        }
-        return true;
-    }
-
     static std::string toLowerLocal(std::string s)
     {
         for (char& c : s)
@@ -43,7 +16,7 @@ namespace asset
         return s;
     }
 
-    bool AnimationLoader::load(AnimationSource& out, const AssetRecord& rec, std::string* outError)
+    bool AnimationLoader::prepare(AnimationSource& out, const AssetRecord& rec, std::string* outError)
     {
         out = AnimationSource{};
         out.semanticKind = rec.kind;
@@ -56,8 +29,25 @@ namespace asset
 
         out.extension = toLowerLocal(input.extension().string());
 
+        if (input.empty())
+        {
+            out.state = AssetState::Error;
+            out.errorMessage = "AnimationSource has no input path";
+            if (outError) *outError = out.errorMessage;
+            return false;
+        }
+
+        out.state = AssetState::Unloaded;
+        return true;
+    }
+
+    bool AnimationLoader::load(AnimationSource& out, const AssetRecord& rec, std::string* outError)
+    {
+        if (!prepare(out, rec, outError))
+            return false;
+
         std::string err;
-        if (!readAllBytes(input, out.bytes, &err))
+        if (!io::AssetIoService::readFile(out.sourcePath, out.bytes, &err))
         {
             out.state = AssetState::Error;
             out.errorMessage = err;
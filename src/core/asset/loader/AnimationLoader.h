@@ -10,6 +10,10 @@ namespace asset
     class AnimationLoader
     {
     public:
+        // Setzt Pfade/Extension, liest aber keine Bytes
+        // (für gebündeltes Lesen über io::AssetIoService::readBatch).
+        static bool prepare(AnimationSource& out, const AssetRecord& rec, std::string* outError = nullptr);
+
         static bool load(AnimationSource& out, const AssetRecord& rec, std::string* outError = nullptr);
     };
 }
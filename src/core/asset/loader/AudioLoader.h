@@ -10,6 +10,10 @@ namespace asset
     class AudioLoader
     {
     public:
+        // Setzt Pfade/Extension, liest aber keine Bytes
+        // (für gebündeltes Lesen über io::AssetIoService::readBatch).
+        static bool prepare(AudioSource& out, const AssetRecord& rec, std::string* outError = nullptr);
+
         static bool load(AudioSource& out, const AssetRecord& rec, std::string* outError = nullptr);
     };
 }
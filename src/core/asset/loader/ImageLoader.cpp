@@ -3,8 +3,7 @@
 #include "index/AssetIndexBuilder.h"          // AssetRecord / AssetTechKind
 #include "data/asset/source/ImageSource.h"
 #include "data/asset/source/AssetSourceBase.h"
-
-#include <fstream>
+#include "core/asset/io/AssetIoService.h"
 
 namespace fs = std::filesystem;
 
@@ -17,32 +16,6 @@ namespace asset
         return s;
     }
 
-    static bool readAllBytes(const fs::path& p, BinaryData& out, std::string* err)
-    {
-        std::ifstream f(p, std::ios::binary);
-        if (!f)
-        {
-            if (err) *err = "Cannot open file: " + p.string();
-            return false;
-        }
-
-        f.seekg(0, std::ios::end);
-        const auto size = static_cast<size_t>(f.tellg());
-        f.seekg(0, std::ios::beg);
-
-        out.bytes.resize(size);
-        if (size > 0)
-            f.read(reinterpret_cast<char*>(out.bytes.data()), static_cast<std::streamsize>(size));
-
-        if (!f.good() && size > 0)
-        {
-            if (err) *err = "Failed reading file: " + p.string();
-            return false;
-        }
-
-        return true;
-    }
-
     static ImageFormat extToFormat(const std::string& extLower)
     {
         if (extLower == ".dds") return ImageFormat::DDS;
@@ -53,7 +26,7 @@ namespace asset
         return ImageFormat::Unknown;
     }
 
-    bool ImageLoader::load(ImageSource& out, const AssetRecord& rec, std::string* outError)
+    bool ImageLoader::prepare(ImageSource& out, const AssetRecord& rec, std::string* outError)
     {
         out = ImageSource{}; // reset
 
@@ -79,9 +52,17 @@ namespace asset
 
         const std::string extLower = toLowerLocal(srcPath.extension().string());
         out.format = extToFormat(extLower);
+        out.state = AssetState::Unloaded;
+        return true;
+    }
+
+    bool ImageLoader::load(ImageSource& out, const AssetRecord& rec, std::string* outError)
+    {
+        if (!prepare(out, rec, outError))
+            return false;
 
         std::string err;
-        if (!readAllBytes(srcPath, out.bytes, &err))
+        if (!io::AssetIoService::readFile(out.sourcePath, out.bytes, &err))
         {
             out.state = AssetState::Error;
             out.errorMessage = err;
@@ -10,6 +10,10 @@ namespace asset
     class ImageLoader
     {
     public:
+        // Setzt Pfade/Format, liest aber keine Bytes
+        // (für gebündeltes Lesen über io::AssetIoService::readBatch).
+        static bool prepare(ImageSource& out, const AssetRecord& rec, std::string* outError = nullptr);
+
         static bool load(ImageSource& out, const AssetRecord& rec, std::string* outError = nullptr);
     };
 }
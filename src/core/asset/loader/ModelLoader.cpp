@@ -3,42 +3,12 @@
 #include "index/AssetIndexBuilder.h"
 #include "data/asset/source/ModelSource.h"
 #include "data/asset/source/AssetSourceBase.h"
-
-#include <fstream>
+#include "core/asset/io/AssetIoService.h"
 
 namespace fs = std::filesystem;
 
 namespace asset
 {
-    static bool readAllBytes(const fs::path& p, BinaryData& out, std::string* err)
-    {
-        std::ifstream f(p, std::ios::binary);
-        if (!f)
-        {
-            if (err) *err = "cannot open file: " + p.string();
-            return false;
-        }
-        f.seekg(0, std::ios::end);
-        const std::streamoff size = f.tellg();
-        if (size < 0)
-        {
-            if (err) *err = "invalid size: " + p.string();
-            return false;
-        }
-        f.seekg(0, std::ios::beg);
-        out.bytes.resize(static_cast<size_t>(size));
-        if (size > 0)
-        {
-            f.read(reinterpret_cast<char*>(out.bytes.data()), size);
-            if (!f)
-            {
-                if (err) *err = "read failed: " + p.string();
-                return false;
-            }
-        }
-        return true;
-    }
-
     static std::string toLowerLocal(std::string s)
     {
         for (char& c : s)
@@ -46,7 +16,7 @@ namespace asset
         return s;
     }
 
-    bool ModelLoader::load(ModelSource& out, const AssetRecord& rec, std::string* outError)
+    bool ModelLoader::prepare(ModelSource& out, const AssetRecord& rec, std::string* outError)
     {
         out = ModelSource{}; // reset
         out.relPath = rec.relPath;
@@ -61,14 +31,6 @@ namespace asset
             out.skeleton.exists = true;
             out.skeleton.path = rec.clientPath;
             out.skeleton.extension = toLowerLocal(rec.clientPath.extension().string());
-            std::string err;
-            if (!readAllBytes(rec.clientPath, out.skeleton.bytes, &err))
-            {
-                out.state = AssetState::Error;
-                out.errorMessage = err;
-                if (outError) *outError = err;
-                return false;
-            }
         }
 
         // --- Mesh from resource (preferred) ---
@@ -77,14 +39,6 @@ namespace asset
             out.mesh.exists = true;
             out.mesh.path = rec.resourcePath;
             out.mesh.extension = toLowerLocal(rec.resourcePath.extension().string());
-            std::string err;
-            if (!readAllBytes(rec.resourcePath, out.mesh.bytes, &err))
-            {
-                out.state = AssetState::Error;
-                out.errorMessage = err;
-                if (outError) *outError = err;
-                return false;
-            }
         }
 
         // If neither part exists, it's an error
@@ -97,6 +51,29 @@ namespace asset
             return false;
         }
 
+        return true;
+    }
+
+    bool ModelLoader::load(ModelSource& out, const AssetRecord& rec, std::string* outError)
+    {
+        if (!prepare(out, rec, outError))
+            return false;
+
+        for (ModelPartSource* part : { &out.skeleton, &out.mesh })
+        {
+            if (!part->exists)
+                continue;
+
+            std::string err;
+            if (!io::AssetIoService::readFile(part->path, part->bytes, &err))
+            {
+                out.state = AssetState::Error;
+                out.errorMessage = err;
+                if (outError) *outError = err;
+                return false;
+            }
+        }
+
         out.state = AssetState::Loaded;
         return true;
     }
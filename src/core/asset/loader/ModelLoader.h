@@ -10,6 +10,10 @@ namespace asset
     class ModelLoader
     {
     public:
+        // Setzt Pfade/Flags der Parts, liest aber keine Bytes
+        // (für gebündeltes Lesen über io::AssetIoService::readBatch).
+        static bool prepare(ModelSource& out, const AssetRecord& rec, std::string* outError = nullptr);
+
         static bool load(ModelSource& out, const AssetRecord& rec, std::string* outError = nullptr);
     };
 }
@@ -3,33 +3,12 @@
 #include "index/AssetIndexBuilder.h"
 #include "data/asset/source/SfxSource.h"
 #include "data/asset/source/AssetSourceBase.h"
-
-#include <fstream>
+#include "core/asset/io/AssetIoService.h"
 
 namespace fs = std::filesystem;
 
 namespace asset
 {
-    static bool readAllBytes(const fs::path& p, BinaryData& out, std::string* err)
-    {
-        std::ifstream f(p, std::ios::binary);
-        if (!f)
-        {
-            if (err) *err = "cannot open file: " + p.generic_string();
-            return false;
-        }
-
-        f.seekg(0, std::ios::end);
-        const auto size = static_cast<size_t>(f.tellg());
-        f.seekg(0, std::ios::beg);
-
-        out.bytes.resize(size);
-        if (size > 0)
-            f.read(reinterpret_cast<char*>(out.bytes.data()), static_cast<std::streamsize>(size));
-
-        return true;
-    }
-
     static std::string toLowerLocal(std::string s)
     {
         for (char& c : s)
@@ -37,7 +16,7 @@ namespace asset
         return s;
     }
 
-    bool SfxLoader::load(SfxSource& out, const AssetRecord& rec, std::string* outError)
+    bool SfxLoader::prepare(SfxSource& out, const AssetRecord& rec, std::string* outError)
     {
         out.resetBase();
         out.relPath = rec.relPath;
@@ -58,9 +37,17 @@ namespace asset
         }
 
         out.extension = toLowerLocal(out.sourcePath.extension().string());
+        out.state = AssetState::Unloaded;
+        return true;
+    }
+
+    bool SfxLoader::load(SfxSource& out, const AssetRecord& rec, std::string* outError)
+    {
+        if (!prepare(out, rec, outError))
+            return false;
 
         std::string err;
-        if (!readAllBytes(out.sourcePath, out.bytes, &err))
+        if (!io::AssetIoService::readFile(out.sourcePath, out.bytes, &err))
         {
             out.state = AssetState::Failed;
             out.errorMessage = err;
@@ -10,6 +10,10 @@ namespace asset
     class SfxLoader
     {
     public:
+        // Setzt Pfade/Extension, liest aber keine Bytes
+        // (für gebündeltes Lesen über io::AssetIoService::readBatch).
+        static bool prepare(SfxSource& out, const AssetRecord& rec, std::string* outError = nullptr);
+
         static bool load(SfxSource& out, const AssetRecord& rec, std::string* outError = nullptr);
     };
 }
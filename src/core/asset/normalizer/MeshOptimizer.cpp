@@ -0,0 +1,610 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace asset::normalizer
+{
+namespace
+{
+    using asset::normalized::NormalizedMesh;
+    using asset::normalized::Vec2;
+    using asset::normalized::Vec3;
+
+    constexpr std::uint32_t kInvalid = std::numeric_limits<std::uint32_t>::max();
+
+    // Index-Bereich [begin, begin+count) eines Primitives
+    struct Range
+    {
+        std::size_t begin = 0;
+        std::size_t count = 0;
+    };
+
+    static std::vector<Range> primitiveRanges(const std::vector<std::uint32_t>& indices,
+                                              const std::vector<asset::normalized::NormalizedPrimitive>& primitives)
+    {
+        std::vector<Range> out;
+        if (primitives.empty())
+        {
+            out.push_back({ 0, indices.size() });
+            return out;
+        }
+
+        out.reserve(primitives.size());
+        for (const auto& p : primitives)
+            out.push_back({ p.indexOffset, p.indexCount });
+        return out;
+    }
+
+    // ------------------------------------------------------------
+    // 1) Dedupe
+    // ------------------------------------------------------------
+    struct VertexKey
+    {
+        std::uint32_t w[8] = {};
+
+        bool operator==(const VertexKey& o) const { return std::memcmp(w, o.w, sizeof(w)) == 0; }
+    };
+
+    struct VertexKeyHash
+    {
+        std::size_t operator()(const VertexKey& k) const
+        {
+            std::uint64_t h = 0x9E3779B97F4A7C15ull;
+            for (std::uint32_t v : k.w)
+            {
+                h ^= v;
+                h *= 0xFF51AFD7ED558CCDull;
+                h ^= h >> 32;
+            }
+            return static_cast<std::size_t>(h);
+        }
+    };
+
+    static std::size_t dedupVertices(NormalizedMesh& mesh)
+    {
+        const std::size_t count = mesh.positions.size();
+        const bool hasNormals = mesh.hasNormals();
+        const bool hasUvs = mesh.hasUvs0();
+
+        std::unordered_map<VertexKey, std::uint32_t, VertexKeyHash> seen;
+        seen.reserve(count);
+
+        std::vector<std::uint32_t> remap(count);
+        std::uint32_t next = 0;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // bitgenau: nur wirklich identische Vertices werden zusammengelegt
+            VertexKey k;
+            std::memcpy(&k.w[0], &mesh.positions[i], sizeof(Vec3));
+            if (hasNormals) std::memcpy(&k.w[3], &mesh.normals[i], sizeof(Vec3));
+            if (hasUvs)     std::memcpy(&k.w[6], &mesh.uvs0[i], sizeof(Vec2));
+
+            const auto [it, inserted] = seen.try_emplace(k, next);
+            if (inserted)
+            {
+                // in-place kompaktieren (next <= i)
+                mesh.positions[next] = mesh.positions[i];
+                if (hasNormals) mesh.normals[next] = mesh.normals[i];
+                if (hasUvs)     mesh.uvs0[next] = mesh.uvs0[i];
+                ++next;
+            }
+            remap[i] = it->second;
+        }
+
+        for (auto& idx : mesh.indices)
+            idx = remap[idx];
+
+        mesh.positions.resize(next);
+        if (hasNormals) mesh.normals.resize(next);
+        if (hasUvs)     mesh.uvs0.resize(next);
+
+        return count - next;
+    }
+
+    // ------------------------------------------------------------
+    // 2) Vertex-Cache (Forsyth, "Linear-Speed Vertex Cache Optimisation")
+    // ------------------------------------------------------------
+    constexpr std::uint32_t kMaxCacheSize = 64;
+    constexpr std::uint32_t kValenceTable = 32;
+
+    struct ForsythScores
+    {
+        float cache[kMaxCacheSize + 3] = {};
+        float valence[kValenceTable] = {};
+
+        explicit ForsythScores(std::uint32_t cacheSize)
+        {
+            constexpr float kLastTriScore = 0.75f;
+            constexpr float kDecayPower   = 1.5f;
+            constexpr float kValenceScale = 2.0f;
+            constexpr float kValencePower = 0.5f;
+
+            for (std::uint32_t i = 0; i < cacheSize; ++i)
+            {
+                // die drei Vertices des letzten Dreiecks bekommen einen festen Wert,
+                // damit nicht immer dasselbe Dreieck "weitergedreht" wird
+                if (i < 3)
+                    cache[i] = kLastTriScore;
+                else
+                    cache[i] = std::pow(1.0f - float(i - 3) / float(cacheSize - 3), kDecayPower);
+            }
+
+            for (std::uint32_t i = 1; i < kValenceTable; ++i)
+                valence[i] = kValenceScale * std::pow(float(i), -kValencePower);
+        }
+
+        float score(std::int32_t cachePos, std::uint32_t liveTris) const
+        {
+            if (liveTris == 0)
+                return -1.0f;
+
+            const float c = cachePos >= 0 ? cache[cachePos] : 0.0f;
+            const float v = liveTris < kValenceTable
+                ? valence[liveTris]
+                : 2.0f * std::pow(float(liveTris), -0.5f);
+            return c + v;
+        }
+    };
+
+    // Arbeitsdaten werden über Primitives hinweg wiederverwendet (global indiziert)
+    struct ForsythState
+    {
+        std::vector<std::uint32_t> localOf;   // global -> lokal (kInvalid = unbenutzt)
+
+        std::vector<std::uint32_t> liveTris;
+        std::vector<std::uint32_t> adjOffset;
+        std::vector<std::uint32_t> adj;
+        std::vector<std::int32_t>  cachePos;
+        std::vector<float>         vertexScore;
+
+        std::vector<float>         triScore;
+        std::vector<std::uint8_t>  triAdded;
+    };
+
+    static void optimizeVertexCache(std::uint32_t* idx, std::size_t triCount,
+                                    std::uint32_t cacheSize, const ForsythScores& sc,
+                                    ForsythState& st, std::vector<std::uint32_t>& tmp)
+    {
+        if (triCount < 2)
+            return;
+
+        const std::size_t n = triCount * 3;
+
+        // lokale Vertex-IDs
+        std::vector<std::uint32_t> touched;
+        touched.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::uint32_t& l = st.localOf[idx[i]];
+            if (l == kInvalid)
+            {
+                l = static_cast<std::uint32_t>(touched.size());
+                touched.push_back(idx[i]);
+            }
+        }
+        const std::size_t vcount = touched.size();
+
+        tmp.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            tmp[i] = st.localOf[idx[i]];
+
+        // Adjazenz Vertex -> Dreiecke (CSR)
+        st.liveTris.assign(vcount, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            ++st.liveTris[tmp[i]];
+
+        st.adjOffset.resize(vcount + 1);
+        st.adjOffset[0] = 0;
+        for (std::size_t v = 0; v < vcount; ++v)
+            st.adjOffset[v + 1] = st.adjOffset[v] + st.liveTris[v];
+
+        st.adj.resize(n);
+        {
+            std::vector<std::uint32_t> fill(st.adjOffset.begin(), st.adjOffset.end() - 1);
+            for (std::size_t t = 0; t < triCount; ++t)
+                for (int k = 0; k < 3; ++k)
+                    st.adj[fill[tmp[t * 3 + k]]++] = static_cast<std::uint32_t>(t);
+        }
+
+        st.cachePos.assign(vcount, -1);
+        st.vertexScore.resize(vcount);
+        for (std::size_t v = 0; v < vcount; ++v)
+            st.vertexScore[v] = sc.score(-1, st.liveTris[v]);
+
+        st.triScore.resize(triCount);
+        st.triAdded.assign(triCount, 0);
+
+        std::uint32_t best = 0;
+        float bestScore = -1.0f;
+        for (std::size_t t = 0; t < triCount; ++t)
+        {
+            const float s = st.vertexScore[tmp[t * 3]] + st.vertexScore[tmp[t * 3 + 1]] + st.vertexScore[tmp[t * 3 + 2]];
+            st.triScore[t] = s;
+            if (s > bestScore)
+            {
+                bestScore = s;
+                best = static_cast<std::uint32_t>(t);
+            }
+        }
+
+        std::uint32_t cache[kMaxCacheSize + 3];
+        std::uint32_t cacheCount = 0;
+
+        // Sackgassen: zuletzt benutzte Vertices mit offenen Dreiecken bevorzugen,
+        // erst dann das nächste nicht ausgegebene Dreieck in Eingabereihenfolge
+        std::vector<std::uint32_t> deadEnd;
+        deadEnd.reserve(n);
+        std::size_t cursor = 0;
+
+        for (std::size_t out = 0; out < triCount; ++out)
+        {
+            while (bestScore < 0.0f && !deadEnd.empty())
+            {
+                const std::uint32_t v = deadEnd.back();
+                deadEnd.pop_back();
+
+                const std::uint32_t begin = st.adjOffset[v];
+                const std::uint32_t end = begin + st.liveTris[v];
+                for (std::uint32_t a = begin; a < end; ++a)
+                {
+                    const std::uint32_t t = st.adj[a];
+                    if (st.triScore[t] > bestScore)
+                    {
+                        bestScore = st.triScore[t];
+                        best = t;
+                    }
+                }
+            }
+
+            if (bestScore < 0.0f)
+            {
+                while (st.triAdded[cursor])
+                    ++cursor;
+                best = static_cast<std::uint32_t>(cursor);
+            }
+
+            const std::uint32_t* tv = &tmp[std::size_t(best) * 3];
+            st.triAdded[best] = 1;
+            for (int k = 0; k < 3; ++k)
+            {
+                idx[out * 3 + k] = touched[tv[k]];
+                deadEnd.push_back(tv[k]);
+            }
+
+            // Dreieck aus den Adjazenzlisten seiner Vertices nehmen
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = tv[k];
+                const std::uint32_t begin = st.adjOffset[v];
+                const std::uint32_t end = begin + st.liveTris[v];
+                for (std::uint32_t a = begin; a < end; ++a)
+                {
+                    if (st.adj[a] == best)
+                    {
+                        st.adj[a] = st.adj[end - 1];
+                        break;
+                    }
+                }
+                --st.liveTris[v];
+            }
+
+            // LRU: Dreiecks-Vertices nach vorn, Rest dahinter
+            std::uint32_t next[kMaxCacheSize + 3];
+            std::uint32_t nextCount = 0;
+            for (int k = 0; k < 3; ++k)
+                next[nextCount++] = tv[k];
+            for (std::uint32_t c = 0; c < cacheCount; ++c)
+            {
+                const std::uint32_t v = cache[c];
+                if (v != tv[0] && v != tv[1] && v != tv[2])
+                    next[nextCount++] = v;
+            }
+
+            // Positionen/Scores neu; herausgefallene verlieren ihren Cache-Bonus
+            for (std::uint32_t c = 0; c < nextCount; ++c)
+            {
+                const std::uint32_t v = next[c];
+                st.cachePos[v] = c < cacheSize ? static_cast<std::int32_t>(c) : -1;
+                const float ns = sc.score(st.cachePos[v], st.liveTris[v]);
+                const float delta = ns - st.vertexScore[v];
+                st.vertexScore[v] = ns;
+
+                const std::uint32_t begin = st.adjOffset[v];
+                const std::uint32_t end = begin + st.liveTris[v];
+                for (std::uint32_t a = begin; a < end; ++a)
+                    st.triScore[st.adj[a]] += delta;
+            }
+
+            cacheCount = std::min(nextCount, cacheSize);
+            std::memcpy(cache, next, cacheCount * sizeof(std::uint32_t));
+
+            // nächstes Dreieck: bestes unter den Nachbarn der Cache-Vertices
+            bestScore = -1.0f;
+            for (std::uint32_t c = 0; c < cacheCount; ++c)
+            {
+                const std::uint32_t v = cache[c];
+                const std::uint32_t begin = st.adjOffset[v];
+                const std::uint32_t end = begin + st.liveTris[v];
+                for (std::uint32_t a = begin; a < end; ++a)
+                {
+                    const std::uint32_t t = st.adj[a];
+                    if (st.triScore[t] > bestScore)
+                    {
+                        bestScore = st.triScore[t];
+                        best = t;
+                    }
+                }
+            }
+        }
+
+        for (std::uint32_t g : touched)
+            st.localOf[g] = kInvalid;
+    }
+
+    // ------------------------------------------------------------
+    // 3) Overdraw: Cluster an Cache-Kaltstarts, nach außen zeigende zuerst
+    // ------------------------------------------------------------
+    static void optimizeOverdraw(std::uint32_t* idx, std::size_t triCount,
+                                 const std::vector<Vec3>& pos,
+                                 std::vector<std::uint32_t>& tmp)
+    {
+        if (triCount < 2)
+            return;
+
+        // Cluster-Grenzen: Dreiecke, bei denen im FIFO-Cache alle drei Vertices fehlen.
+        // Dort ist der Cache ohnehin kalt -> Umsortieren kostet kaum ACMR.
+        constexpr std::uint32_t kFifo = 16;
+        std::uint32_t fifo[kFifo];
+        std::uint32_t fifoCount = 0, fifoHead = 0;
+
+        std::vector<std::size_t> clusterStart;
+        for (std::size_t t = 0; t < triCount; ++t)
+        {
+            int misses = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = idx[t * 3 + k];
+                bool hit = false;
+                for (std::uint32_t c = 0; c < fifoCount; ++c)
+                    hit |= (fifo[c] == v);
+                if (!hit)
+                {
+                    ++misses;
+                    fifo[fifoHead] = v;
+                    fifoHead = (fifoHead + 1) % kFifo;
+                    fifoCount = std::min(fifoCount + 1, kFifo);
+                }
+            }
+            if (t == 0 || misses == 3)
+                clusterStart.push_back(t);
+        }
+
+        const std::size_t clusterCount = clusterStart.size();
+        if (clusterCount < 2)
+            return;
+        clusterStart.push_back(triCount);
+
+        struct Cluster
+        {
+            std::size_t begin, end;
+            float centroid[3];
+            float normal[3];
+            float area;
+            float key;
+        };
+        std::vector<Cluster> clusters(clusterCount);
+
+        float meshCentroid[3] = {};
+        float meshArea = 0.0f;
+
+        for (std::size_t c = 0; c < clusterCount; ++c)
+        {
+            Cluster& cl = clusters[c];
+            cl = { clusterStart[c], clusterStart[c + 1], {}, {}, 0.0f, 0.0f };
+
+            for (std::size_t t = cl.begin; t < cl.end; ++t)
+            {
+                const Vec3& a = pos[idx[t * 3]];
+                const Vec3& b = pos[idx[t * 3 + 1]];
+                const Vec3& d = pos[idx[t * 3 + 2]];
+
+                const float e1[3] = { b.x - a.x, b.y - a.y, b.z - a.z };
+                const float e2[3] = { d.x - a.x, d.y - a.y, d.z - a.z };
+                const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1],
+                                     e1[2] * e2[0] - e1[0] * e2[2],
+                                     e1[0] * e2[1] - e1[1] * e2[0] };
+                const float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+                const float ctr[3] = { (a.x + b.x + d.x) / 3.0f, (a.y + b.y + d.y) / 3.0f, (a.z + b.z + d.z) / 3.0f };
+                for (int k = 0; k < 3; ++k)
+                {
+                    cl.centroid[k] += ctr[k] * area;
+                    cl.normal[k] += n[k];
+                }
+                cl.area += area;
+            }
+
+            for (int k = 0; k < 3; ++k)
+                meshCentroid[k] += cl.centroid[k];
+            meshArea += cl.area;
+
+            if (cl.area > 0.0f)
+                for (int k = 0; k < 3; ++k)
+                    cl.centroid[k] /= cl.area;
+        }
+
+        if (meshArea <= 0.0f)
+            return;
+        for (int k = 0; k < 3; ++k)
+            meshCentroid[k] /= meshArea;
+
+        for (Cluster& cl : clusters)
+        {
+            const float len = std::sqrt(cl.normal[0] * cl.normal[0] + cl.normal[1] * cl.normal[1] + cl.normal[2] * cl.normal[2]);
+            float key = 0.0f;
+            if (len > 0.0f)
+                for (int k = 0; k < 3; ++k)
+                    key += (cl.centroid[k] - meshCentroid[k]) * cl.normal[k] / len;
+            cl.key = key;
+        }
+
+        std::stable_sort(clusters.begin(), clusters.end(),
+                         [](const Cluster& a, const Cluster& b) { return a.key > b.key; });
+
+        tmp.assign(idx, idx + triCount * 3);
+        std::size_t out = 0;
+        for (const Cluster& cl : clusters)
+        {
+            const std::size_t n = (cl.end - cl.begin) * 3;
+            std::memcpy(idx + out, tmp.data() + cl.begin * 3, n * sizeof(std::uint32_t));
+            out += n;
+        }
+    }
+
+    // ------------------------------------------------------------
+    // 4) Vertex-Fetch: Reihenfolge der ersten Verwendung
+    // ------------------------------------------------------------
+    template<typename T>
+    static void permute(std::vector<T>& v, const std::vector<std::uint32_t>& remap, std::size_t newCount)
+    {
+        std::vector<T> out(newCount);
+        for (std::size_t i = 0; i < v.size(); ++i)
+            if (remap[i] != kInvalid)
+                out[remap[i]] = v[i];
+        v.swap(out);
+    }
+
+    static void optimizeVertexFetch(NormalizedMesh& mesh)
+    {
+        const std::size_t count = mesh.positions.size();
+        const bool hasNormals = mesh.hasNormals();
+        const bool hasUvs = mesh.hasUvs0();
+
+        std::vector<std::uint32_t> remap(count, kInvalid);
+        std::uint32_t next = 0;
+        for (auto& idx : mesh.indices)
+        {
+            if (remap[idx] == kInvalid)
+                remap[idx] = next++;
+            idx = remap[idx];
+        }
+
+        permute(mesh.positions, remap, next);
+        if (hasNormals) permute(mesh.normals, remap, next);
+        if (hasUvs)     permute(mesh.uvs0, remap, next);
+    }
+}
+
+void MeshOptimizer::optimizeIndices(std::vector<std::uint32_t>& indices,
+                                    const std::vector<asset::normalized::NormalizedPrimitive>& primitives,
+                                    const std::vector<asset::normalized::Vec3>& positions,
+                                    const Options& opts)
+{
+    if (!opts.optimizeVertexCache && !opts.optimizeOverdraw)
+        return;
+
+    const std::uint32_t cacheSize = std::clamp<std::uint32_t>(opts.cacheSize, 4, kMaxCacheSize);
+    const ForsythScores scores(cacheSize);
+
+    ForsythState st;
+    st.localOf.assign(positions.size(), kInvalid);
+    std::vector<std::uint32_t> tmp;
+
+    for (const Range& r : primitiveRanges(indices, primitives))
+    {
+        std::uint32_t* idx = indices.data() + r.begin;
+        const std::size_t triCount = r.count / 3;
+
+        if (opts.optimizeVertexCache)
+            optimizeVertexCache(idx, triCount, cacheSize, scores, st, tmp);
+        if (opts.optimizeOverdraw)
+            optimizeOverdraw(idx, triCount, positions, tmp);
+    }
+}
+
+float MeshOptimizer::acmr(const std::vector<std::uint32_t>& indices,
+                          std::size_t vertexCount,
+                          std::uint32_t cacheSize)
+{
+    if (indices.size() < 3 || cacheSize == 0)
+        return 0.0f;
+
+    // FIFO wie in typischer Hardware: Zeitstempel pro Vertex statt Ringsuche
+    std::vector<std::uint64_t> stamp(vertexCount, 0);
+    std::uint64_t time = cacheSize + 1;
+    std::size_t misses = 0;
+
+    for (std::uint32_t v : indices)
+    {
+        if (v >= vertexCount)
+            continue;
+        if (time - stamp[v] > cacheSize)
+        {
+            stamp[v] = time++;
+            ++misses;
+        }
+    }
+
+    return float(misses) / float(indices.size() / 3);
+}
+
+bool MeshOptimizer::optimize(asset::normalized::NormalizedMesh& mesh,
+                             const Options& opts,
+                             Stats* stats,
+                             std::string* outError)
+{
+    const std::size_t vcount = mesh.positions.size();
+
+    if (mesh.indices.size() % 3 != 0)
+    {
+        if (outError) *outError = "MeshOptimizer: indices not multiple of 3.";
+        return false;
+    }
+    for (std::uint32_t idx : mesh.indices)
+    {
+        if (idx >= vcount)
+        {
+            if (outError) *outError = "MeshOptimizer: index out of range.";
+            return false;
+        }
+    }
+
+    const std::vector<Range> ranges = primitiveRanges(mesh.indices, mesh.primitives);
+    for (const Range& r : ranges)
+    {
+        if (r.count % 3 != 0 || r.begin + r.count > mesh.indices.size())
+        {
+            if (outError) *outError = "MeshOptimizer: primitive index range invalid.";
+            return false;
+        }
+    }
+
+    if (stats)
+    {
+        *stats = {};
+        stats->verticesBefore = vcount;
+        stats->acmrBefore = acmr(mesh.indices, vcount);
+    }
+
+    if (opts.dedupVertices)
+        dedupVertices(mesh);
+
+    optimizeIndices(mesh.indices, mesh.primitives, mesh.positions, opts);
+
+    if (opts.optimizeVertexFetch)
+        optimizeVertexFetch(mesh);
+
+    if (stats)
+    {
+        stats->verticesAfter = mesh.positions.size();
+        stats->acmrAfter = acmr(mesh.indices, mesh.positions.size());
+    }
+
+    return true;
+}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "data/asset/normalized/NormalizedMesh.h"
+
+namespace asset::normalizer
+{
+    // Optionale Nachbearbeitung nach der Normalisierung (Reihenfolge wie hier):
+    //  1. Vertex-Dedupe (bitgenauer Hash über Position/Normale/UV)
+    //  2. Dreiecksreihenfolge pro NormalizedPrimitive für den Post-Transform-Cache (Forsyth)
+    //  3. Overdraw: Cluster an Cache-"Kaltstarts" nach außen zeigend zuerst (Sander et al.)
+    //  4. Vertex-Reihenfolge nach erster Verwendung (Fetch-Lokalität), unbenutzte fallen weg
+    // Geometrie und Primitive-Grenzen bleiben unverändert, nur Reihenfolge/Indizes ändern sich.
+    struct MeshOptimizer
+    {
+        struct Options
+        {
+            bool dedupVertices       = true;
+            bool optimizeVertexCache = true;
+            bool optimizeOverdraw    = true;
+            bool optimizeVertexFetch = true;
+
+            // Modellierte Cache-Größe für die Forsyth-Bewertung (LRU)
+            std::uint32_t cacheSize = 32;
+        };
+
+        struct Stats
+        {
+            std::size_t verticesBefore = 0;
+            std::size_t verticesAfter  = 0;
+
+            // Average Cache Miss Ratio (FIFO, 16 Einträge): Misses pro Dreieck, 0.5..3.0
+            float acmrBefore = 0.0f;
+            float acmrAfter  = 0.0f;
+        };
+
+        static bool optimize(asset::normalized::NormalizedMesh& mesh,
+                             const Options& opts,
+                             Stats* stats = nullptr,
+                             std::string* outError = nullptr);
+
+        // Nur Schritte 2+3 auf einem Index-Buffer (Vertices bleiben unangetastet),
+        // z.B. für LOD-Stufen, die sich die Vertex-Arrays des Basis-Meshes teilen.
+        static void optimizeIndices(std::vector<std::uint32_t>& indices,
+                                    const std::vector<asset::normalized::NormalizedPrimitive>& primitives,
+                                    const std::vector<asset::normalized::Vec3>& positions,
+                                    const Options& opts);
+
+        static float acmr(const std::vector<std::uint32_t>& indices,
+                          std::size_t vertexCount,
+                          std::uint32_t cacheSize = 16);
+    };
+}
@@ -0,0 +1,404 @@
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+namespace asset::normalizer
+{
+namespace
+{
+    using asset::normalized::NormalizedPrimitive;
+    using asset::normalized::Vec3;
+
+    constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+
+    // Symmetrische 4x4-Quadrik (10 Koeffizienten)
+    struct Quadric
+    {
+        double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+        double b0 = 0, b1 = 0, b2 = 0, c = 0;
+
+        static Quadric plane(double nx, double ny, double nz, double d)
+        {
+            Quadric q;
+            q.a00 = nx * nx; q.a01 = nx * ny; q.a02 = nx * nz;
+            q.a11 = ny * ny; q.a12 = ny * nz; q.a22 = nz * nz;
+            q.b0 = nx * d; q.b1 = ny * d; q.b2 = nz * d;
+            q.c = d * d;
+            return q;
+        }
+
+        Quadric& operator+=(const Quadric& o)
+        {
+            a00 += o.a00; a01 += o.a01; a02 += o.a02;
+            a11 += o.a11; a12 += o.a12; a22 += o.a22;
+            b0 += o.b0; b1 += o.b1; b2 += o.b2;
+            c += o.c;
+            return *this;
+        }
+
+        // Summe der quadrierten Ebenenabstände
+        double error(const Vec3& p) const
+        {
+            const double x = p.x, y = p.y, z = p.z;
+            const double e =
+                a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z +
+                a11 * y * y + 2 * a12 * y * z + a22 * z * z +
+                2 * (b0 * x + b1 * y + b2 * z) + c;
+            return e > 0 ? e : 0;
+        }
+    };
+
+    static void triNormal(const Vec3& a, const Vec3& b, const Vec3& c, double n[3])
+    {
+        const double e1[3] = { double(b.x) - a.x, double(b.y) - a.y, double(b.z) - a.z };
+        const double e2[3] = { double(c.x) - a.x, double(c.y) - a.y, double(c.z) - a.z };
+        n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+    }
+
+    struct Candidate
+    {
+        double cost;
+        std::uint32_t from, to;
+        std::uint32_t stampFrom, stampTo;
+
+        bool operator<(const Candidate& o) const { return cost > o.cost; } // min-heap
+    };
+
+    struct PosKeyHash
+    {
+        std::size_t operator()(const Vec3& p) const
+        {
+            std::uint32_t w[3];
+            std::memcpy(w, &p, sizeof(w));
+            std::uint64_t h = 0x9E3779B97F4A7C15ull;
+            for (std::uint32_t v : w)
+            {
+                h ^= v;
+                h *= 0xFF51AFD7ED558CCDull;
+                h ^= h >> 32;
+            }
+            return static_cast<std::size_t>(h);
+        }
+    };
+
+    struct PosKeyEqual
+    {
+        bool operator()(const Vec3& a, const Vec3& b) const { return std::memcmp(&a, &b, sizeof(Vec3)) == 0; }
+    };
+}
+
+float MeshSimplifier::simplify(std::vector<std::uint32_t>& indices,
+                               std::vector<NormalizedPrimitive>& primitives,
+                               const std::vector<Vec3>& positions,
+                               std::size_t targetTriangles,
+                               float maxError)
+{
+    const std::size_t triCount = indices.size() / 3;
+    const std::size_t vcount = positions.size();
+    if (triCount <= targetTriangles || triCount == 0)
+        return 0.0f;
+
+    // Primitive pro Dreieck (leere primitives -> ein einziges)
+    std::vector<std::uint32_t> triPrim(triCount, 0);
+    for (std::size_t p = 0; p < primitives.size(); ++p)
+    {
+        const std::size_t b = primitives[p].indexOffset / 3;
+        const std::size_t e = b + primitives[p].indexCount / 3;
+        for (std::size_t t = b; t < e && t < triCount; ++t)
+            triPrim[t] = static_cast<std::uint32_t>(p);
+    }
+
+    // Positions-IDs: Nähte sind mehrere Vertices auf derselben Position
+    std::vector<std::uint32_t> posId(vcount);
+    std::vector<std::uint32_t> posUsers;
+    {
+        std::unordered_map<Vec3, std::uint32_t, PosKeyHash, PosKeyEqual> ids;
+        ids.reserve(vcount);
+        std::vector<std::uint8_t> used(vcount, 0);
+        for (std::uint32_t v : indices)
+            used[v] = 1;
+
+        for (std::size_t v = 0; v < vcount; ++v)
+        {
+            const auto [it, inserted] = ids.try_emplace(positions[v], static_cast<std::uint32_t>(ids.size()));
+            posId[v] = it->second;
+            if (inserted)
+                posUsers.push_back(0);
+            posUsers[it->second] += used[v];
+        }
+    }
+
+    // Adjazenz Vertex -> Dreiecke
+    std::vector<std::vector<std::uint32_t>> vtris(vcount);
+    for (std::size_t t = 0; t < triCount; ++t)
+        for (int k = 0; k < 3; ++k)
+            vtris[indices[t * 3 + k]].push_back(static_cast<std::uint32_t>(t));
+
+    // Sperren: Naht, mehrere Primitives, offener Rand (Kanten auf Positionsebene)
+    std::vector<std::uint8_t> locked(vcount, 0);
+    {
+        std::unordered_map<std::uint64_t, std::uint32_t> edgeUse;
+        edgeUse.reserve(triCount * 3);
+        auto edgeKey = [&](std::uint32_t a, std::uint32_t b)
+        {
+            std::uint32_t pa = posId[a], pb = posId[b];
+            if (pa > pb) std::swap(pa, pb);
+            return (std::uint64_t(pa) << 32) | pb;
+        };
+
+        for (std::size_t t = 0; t < triCount; ++t)
+            for (int k = 0; k < 3; ++k)
+                ++edgeUse[edgeKey(indices[t * 3 + k], indices[t * 3 + (k + 1) % 3])];
+
+        for (std::size_t t = 0; t < triCount; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t a = indices[t * 3 + k];
+                const std::uint32_t b = indices[t * 3 + (k + 1) % 3];
+                if (edgeUse[edgeKey(a, b)] == 1)
+                    locked[a] = locked[b] = 1;
+            }
+        }
+
+        for (std::size_t v = 0; v < vcount; ++v)
+        {
+            if (posUsers[posId[v]] > 1)
+                locked[v] = 1;
+
+            for (std::uint32_t t : vtris[v])
+                if (triPrim[t] != triPrim[vtris[v][0]])
+                    locked[v] = 1;
+        }
+    }
+
+    // Quadriken aus den Dreiecksebenen
+    std::vector<Quadric> quadric(vcount);
+    for (std::size_t t = 0; t < triCount; ++t)
+    {
+        const std::uint32_t* tv = &indices[t * 3];
+        double n[3];
+        triNormal(positions[tv[0]], positions[tv[1]], positions[tv[2]], n);
+        const double len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (len <= 0)
+            continue;
+        n[0] /= len; n[1] /= len; n[2] /= len;
+        const Vec3& p = positions[tv[0]];
+        const Quadric q = Quadric::plane(n[0], n[1], n[2], -(n[0] * p.x + n[1] * p.y + n[2] * p.z));
+        for (int k = 0; k < 3; ++k)
+            quadric[tv[k]] += q;
+    }
+
+    std::vector<std::uint8_t> triAlive(triCount, 1);
+    std::vector<std::uint8_t> removed(vcount, 0);
+    std::vector<std::uint32_t> stamp(vcount, 0);
+
+    std::priority_queue<Candidate> heap;
+    auto pushEdgesOf = [&](std::uint32_t v)
+    {
+        for (std::uint32_t t : vtris[v])
+        {
+            if (!triAlive[t])
+                continue;
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t u = indices[t * 3 + k];
+                if (u == v)
+                    continue;
+
+                // beide Richtungen; gesperrte Vertices wandern nie
+                if (!locked[v])
+                {
+                    Quadric q = quadric[v]; q += quadric[u];
+                    heap.push({ q.error(positions[u]), v, u, stamp[v], stamp[u] });
+                }
+                if (!locked[u])
+                {
+                    Quadric q = quadric[u]; q += quadric[v];
+                    heap.push({ q.error(positions[v]), u, v, stamp[u], stamp[v] });
+                }
+            }
+        }
+    };
+
+    for (std::uint32_t v = 0; v < vcount; ++v)
+        if (!locked[v] && !vtris[v].empty())
+            pushEdgesOf(v);
+
+    const double maxCost = double(maxError) * double(maxError);
+    double worst = 0.0;
+    std::size_t alive = triCount;
+
+    while (alive > targetTriangles && !heap.empty())
+    {
+        const Candidate c = heap.top();
+        heap.pop();
+
+        if (c.cost > maxCost)
+            break;
+        if (removed[c.from] || removed[c.to] || stamp[c.from] != c.stampFrom || stamp[c.to] != c.stampTo)
+            continue;
+
+        // Umklappen / Degenerieren der verbleibenden Dreiecke prüfen
+        const Vec3& target = positions[c.to];
+        bool ok = true;
+        for (std::uint32_t t : vtris[c.from])
+        {
+            if (!triAlive[t])
+                continue;
+            const std::uint32_t* tv = &indices[std::size_t(t) * 3];
+            if (tv[0] == c.to || tv[1] == c.to || tv[2] == c.to)
+                continue;
+
+            Vec3 p[3] = { positions[tv[0]], positions[tv[1]], positions[tv[2]] };
+            double before[3], after[3];
+            triNormal(p[0], p[1], p[2], before);
+            for (int k = 0; k < 3; ++k)
+                if (tv[k] == c.from)
+                    p[k] = target;
+            triNormal(p[0], p[1], p[2], after);
+
+            const double dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+            const double la = after[0] * after[0] + after[1] * after[1] + after[2] * after[2];
+            const double lb = before[0] * before[0] + before[1] * before[1] + before[2] * before[2];
+            // Normale darf nicht kippen oder fast senkrecht wegdrehen (sonst Splitter)
+            if (dot <= 0.25 * std::sqrt(la * lb) || la <= lb * 1e-6)
+            {
+                ok = false;
+                break;
+            }
+        }
+        if (!ok)
+            continue;
+
+        // Collapse from -> to
+        for (std::uint32_t t : vtris[c.from])
+        {
+            if (!triAlive[t])
+                continue;
+            std::uint32_t* tv = &indices[std::size_t(t) * 3];
+            if (tv[0] == c.to || tv[1] == c.to || tv[2] == c.to)
+            {
+                triAlive[t] = 0;
+                --alive;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k)
+                if (tv[k] == c.from)
+                    tv[k] = c.to;
+            vtris[c.to].push_back(t);
+        }
+
+        removed[c.from] = 1;
+        vtris[c.from].clear();
+        quadric[c.to] += quadric[c.from];
+        ++stamp[c.to];
+        worst = std::max(worst, c.cost);
+
+        // tote Dreiecke aus der Liste des Ziels entfernen; nur Kanten an "to" haben
+        // neue Kosten (alte Kandidaten dort sind über stamp[to] ungültig)
+        auto& lt = vtris[c.to];
+        lt.erase(std::remove_if(lt.begin(), lt.end(), [&](std::uint32_t t) { return !triAlive[t]; }), lt.end());
+        pushEdgesOf(c.to);
+    }
+
+    // Kompaktieren, Primitive-Reihenfolge bleibt
+    std::vector<std::uint32_t> out;
+    out.reserve(alive * 3);
+
+    if (primitives.empty())
+    {
+        for (std::size_t t = 0; t < triCount; ++t)
+            if (triAlive[t])
+                out.insert(out.end(), &indices[t * 3], &indices[t * 3] + 3);
+    }
+    else
+    {
+        for (auto& p : primitives)
+        {
+            const std::size_t b = p.indexOffset / 3;
+            const std::size_t e = b + p.indexCount / 3;
+            p.indexOffset = static_cast<std::uint32_t>(out.size());
+            for (std::size_t t = b; t < e; ++t)
+                if (triAlive[t])
+                    out.insert(out.end(), &indices[t * 3], &indices[t * 3] + 3);
+            p.indexCount = static_cast<std::uint32_t>(out.size()) - p.indexOffset;
+        }
+    }
+
+    indices.swap(out);
+    return static_cast<float>(std::sqrt(worst));
+}
+
+bool MeshSimplifier::buildLods(asset::normalized::NormalizedMesh& mesh,
+                               const Options& opts,
+                               std::string* outError)
+{
+    mesh.lods.clear();
+
+    if (mesh.positions.empty() || mesh.indices.empty() || mesh.indices.size() % 3 != 0)
+    {
+        if (outError) *outError = "MeshSimplifier: mesh has no triangles.";
+        return false;
+    }
+    for (std::uint32_t idx : mesh.indices)
+    {
+        if (idx >= mesh.positions.size())
+        {
+            if (outError) *outError = "MeshSimplifier: index out of range.";
+            return false;
+        }
+    }
+
+    // Fehlergrenze relativ zur größten Ausdehnung
+    Vec3 mn = mesh.positions[0], mx = mesh.positions[0];
+    for (const auto& p : mesh.positions)
+    {
+        mn.x = std::min(mn.x, p.x); mn.y = std::min(mn.y, p.y); mn.z = std::min(mn.z, p.z);
+        mx.x = std::max(mx.x, p.x); mx.y = std::max(mx.y, p.y); mx.z = std::max(mx.z, p.z);
+    }
+    const float extent = std::max({ mx.x - mn.x, mx.y - mn.y, mx.z - mn.z, 1e-6f });
+
+    const std::size_t baseTris = mesh.indices.size() / 3;
+
+    std::vector<std::uint32_t> indices = mesh.indices;
+    std::vector<NormalizedPrimitive> prims = mesh.primitives;
+    std::size_t prevTris = baseTris;
+
+    MeshOptimizer::Options cacheOpts;
+    cacheOpts.dedupVertices = false;
+    cacheOpts.optimizeVertexFetch = false;
+
+    for (float ratio : opts.ratios)
+    {
+        const std::size_t target = static_cast<std::size_t>(std::max(0.0f, ratio) * float(baseTris));
+        const float err = simplify(indices, prims, mesh.positions, target, opts.maxError * extent);
+
+        const std::size_t tris = indices.size() / 3;
+        if (tris == 0 || float(tris) > float(prevTris) * opts.minReduction)
+            break;
+
+        asset::normalized::NormalizedLod lod;
+        lod.indices = indices;
+        lod.primitives = prims;
+        lod.triangleRatio = float(tris) / float(baseTris);
+        lod.error = err / extent;
+
+        if (opts.optimizeIndices)
+            MeshOptimizer::optimizeIndices(lod.indices, lod.primitives, mesh.positions, cacheOpts);
+
+        mesh.lods.push_back(std::move(lod));
+        prevTris = tris;
+    }
+
+    return true;
+}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "data/asset/normalized/NormalizedMesh.h"
+
+namespace asset::normalizer
+{
+    // LOD-Kette per Edge-Collapse mit Quadrik-Fehlermetrik (Garland/Heckbert).
+    //
+    // - Half-Edge-Collapse auf vorhandene Vertices: es entstehen keine neuen
+    //   Vertices, alle Stufen teilen sich positions/normals/uvs0 des Basis-Meshes
+    //   (im GLB ein gemeinsamer Vertex-Buffer, nur die Indizes sind pro Stufe).
+    // - Gesperrt bleiben offene Ränder, UV-/Normalen-Nähte (mehrere Vertices auf
+    //   derselben Position) und Vertices, die sich Primitives teilen – damit
+    //   reißen weder Silhouette noch Textur-Nähte auf.
+    // - Jede Stufe wird aus der vorherigen erzeugt; Collapses, die Dreiecke
+    //   umklappen würden, werden verworfen.
+    struct MeshSimplifier
+    {
+        struct Options
+        {
+            // Ziel-Dreiecksanteil je Stufe relativ zum Basis-Mesh (absteigend)
+            std::vector<float> ratios = { 0.5f, 0.25f, 0.125f };
+
+            // Abbruch, wenn der Fehler diesen Anteil der Mesh-Ausdehnung übersteigt
+            float maxError = 0.02f;
+
+            // Stufe verwerfen (und Kette beenden), wenn sie kaum kleiner ist als die vorige
+            float minReduction = 0.9f;
+
+            // Index-Reihenfolge jeder Stufe für den Vertex-Cache optimieren
+            bool optimizeIndices = true;
+        };
+
+        // Füllt mesh.lods (vorhandene werden ersetzt). Ergebnis kann kürzer als
+        // opts.ratios sein, wenn die Fehlergrenze oder gesperrte Vertices greifen.
+        static bool buildLods(asset::normalized::NormalizedMesh& mesh,
+                              const Options& opts,
+                              std::string* outError = nullptr);
+
+        // Eine Stufe: vereinfacht indices/primitives in-place auf ~targetTriangles.
+        // Liefert den erreichten Fehler (absolut, Abstandseinheit).
+        static float simplify(std::vector<std::uint32_t>& indices,
+                              std::vector<asset::normalized::NormalizedPrimitive>& primitives,
+                              const std::vector<asset::normalized::Vec3>& positions,
+                              std::size_t targetTriangles,
+                              float maxError);
+    };
+}
@@ -2,6 +2,27 @@
 
 namespace asset::normalizer
 {
+    bool ModelNormalizer::normalizeMesh(
+        asset::normalized::NormalizedMesh& out,
+        const asset::O3DParsed& src,
+        const Options& opts,
+        MeshOptimizer::Stats* stats,
+        std::string* outError
+    )
+    {
+        if (!normalizeMesh(out, src, outError))
+            return false;
+
+        if (opts.optimize && !MeshOptimizer::optimize(out, opts.optimizer, stats, outError))
+            return false;
+
+        // nach dem Optimieren: LODs referenzieren die endgültige Vertex-Reihenfolge
+        if (opts.buildLods && !MeshSimplifier::buildLods(out, opts.lods, outError))
+            return false;
+
+        return true;
+    }
+
     bool ModelNormalizer::normalizeMesh(
         asset::normalized::NormalizedMesh& out,
         const asset::O3DParsed& src,
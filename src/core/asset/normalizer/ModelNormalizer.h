@@ -5,15 +5,36 @@
 #include "data/asset/normalized/NormalizedMesh.h"
 #include "asset/parser/ModelParser.h"
 #include "data/asset/parsed/O3DParsed.h"
+#include "asset/normalizer/MeshOptimizer.h"
+#include "asset/normalizer/MeshSimplifier.h"
 
 namespace asset::normalizer
 {
     class ModelNormalizer
     {
     public:
+        struct Options
+        {
+            // Nachbearbeitung (Dedupe, Vertex-Cache, Overdraw, Fetch-Reihenfolge)
+            bool optimize = false;
+            MeshOptimizer::Options optimizer;
+
+            // LOD-Kette (QEM) nach der Optimierung, z.B. wenn DrawCallSpec::usesLOD gesetzt ist
+            bool buildLods = false;
+            MeshSimplifier::Options lods;
+        };
+
+        static bool normalizeMesh(
+            asset::normalized::NormalizedMesh& out,
+            const asset::O3DParsed& src,
+            std::string* outError = nullptr
+        );
+
         static bool normalizeMesh(
             asset::normalized::NormalizedMesh& out,
             const asset::O3DParsed& src,
+            const Options& opts,
+            MeshOptimizer::Stats* stats = nullptr,
             std::string* outError = nullptr
         );
     };
@@ -10,33 +10,42 @@
 #include "asset/parser/o3d/MeshParamBlockReader.h"
 #include "asset/parser/o3d/PoolDirectoryReader.h"
 #include "asset/parser/o3d/VertexBufferReader.h"
+#include "asset/parser/o3d/IndexBufferReader.h"
 #include <algorithm>
 #include <utility>
 
 namespace
 {
+using Stats = asset::parser::ModelParser::Stats;
+
+static void noteError(Stats& st, const std::string& msg)
+{
+    if (st.firstError.empty())
+        st.firstError = msg;
+}
+
 static void fillPart(asset::O3DParsedPart& out,
                      const asset::O3DDecodedPart& in,
-                     const char* name)
+                     const char* name,
+                     const asset::parser::ModelParser::Options& opts,
+                     Stats& st)
 {
     out = {};
 
     if (!in.exists)
-    {
-        core::Log::info(std::string("[ModelParser] Part missing: ") + name);
         return;
-    }
+
+    ++st.parts;
 
     out.exists       = true;
     out.extension    = in.extension;
     out.sizeBytes    = in.sizeBytes;
-    out.raw          = in.raw;
     out.signatureHex = in.signatureHex;
+    if (opts.keepRaw)
+        out.raw = in.raw;
 
-    core::Log::info(
-        std::string("[ModelParser] Part detected name=") + name +
-        " size=" + std::to_string(out.sizeBytes)
-        );
+    // alle Reader arbeiten direkt auf den decodierten Bytes
+    const std::vector<std::uint8_t>& raw = in.raw;
 
     // ============================================================
     // HEADER
@@ -45,12 +54,10 @@ static void fillPart(asset::O3DParsedPart& out,
     std::string headerErr;
 
     if (!asset::parser::o3d::HeaderReader::read(
-            header, out.raw, std::nullopt, &headerErr))
+            header, raw, std::nullopt, &headerErr))
     {
-        core::Log::error(
-            "[ModelParser] HeaderReader failed part=" +
-            std::string(name) + " err=" + headerErr
-            );
+        ++st.partsFailed;
+        noteError(st, std::string(name) + ": " + headerErr);
         return;
     }
 
@@ -58,33 +65,21 @@ static void fillPart(asset::O3DParsedPart& out,
     out.headerNameLower = header.embeddedFileNameLower;
     out.headerCursor    = header.cursorAfterHeader;
 
-    core::Log::info(
-        "[ModelParser] Header OK part=" + std::string(name) +
-        " ver=" + std::to_string(header.version) +
-        " cursor=" + std::to_string(header.cursorAfterHeader)
-        );
-
     // ============================================================
     // OBJECTS
     // ============================================================
     asset::parser::o3d::ObjectReadResult objRes;
     std::string objErr;
 
-    if (!asset::parser::o3d::ObjectReader::read(objRes, out.raw, header, &objErr))
+    if (!asset::parser::o3d::ObjectReader::read(objRes, raw, header, &objErr))
     {
-        core::Log::error(
-            "[ModelParser] ObjectReader failed part=" +
-            std::string(name) + " err=" + objErr
-            );
+        ++st.partsFailed;
+        noteError(st, std::string(name) + ": " + objErr);
         return;
     }
 
-    core::Log::info(
-        "[ModelParser] ObjectReader OK groupCount=" +
-        std::to_string(objRes.groupCount) +
-        " cursorAfterObjects=" +
-        std::to_string(objRes.cursorAfterObjects)
-        );
+    for (const auto& grp : objRes.groups)
+        st.objects += static_cast<std::uint32_t>(grp.objects.size());
 
     // ============================================================
     // POOL DIRECTORY (nur meshPoolStart merken)
@@ -94,7 +89,7 @@ static void fillPart(asset::O3DParsedPart& out,
 
     asset::parser::o3d::PoolDirectoryReader::read(
         dir,
-        out.raw,
+        raw,
         objRes.cursorAfterObjects,
         header,
         &dirErr
@@ -102,31 +97,27 @@ static void fillPart(asset::O3DParsedPart& out,
 
     if (!dir.found || dir.meshPoolStart == 0)
     {
-        core::Log::pipelineInfo(
-            "[ModelParser] PoolDir NOT FOUND or meshPoolStart invalid"
-            );
+        ++st.partsFailed;
+        noteError(st, std::string(name) + ": PoolDir not found or meshPoolStart invalid");
         return;
     }
 
     out.meshPoolStart = dir.meshPoolStart;
 
-    core::Log::pipelineInfo(
-        "[ModelParser] PoolDir APPLY | meshPoolStart=" +
-        std::to_string(out.meshPoolStart)
-        );
-
+#ifdef O3D_DEBUG_VERBOSE_PARSER
     // ============================================================
-    // MESH POOL PROBE (Packed Mesh Headers) – optional/logging
+    // MESH POOL PROBE (Packed Mesh Headers) – nur Logging
     // ============================================================
     asset::parser::o3d::MeshReadResult meshRes;
     std::string meshErr;
     asset::parser::o3d::MeshReader::read(
         meshRes,
-        out.raw,
+        raw,
         out.meshPoolStart, // Start = meshPoolStart
         &dir,
         &meshErr
         );
+#endif
 
     // ============================================================
     // MeshParamBlocks – ALLE sammeln, KEIN APPLY hier
@@ -147,12 +138,14 @@ static void fillPart(asset::O3DParsedPart& out,
             if (!isMeshObj)
                 continue;
 
+            ++st.meshObjects;
+
             asset::parser::o3d::MeshParamBlockResult pb;
             std::string pbErr;
 
             const bool ok = asset::parser::o3d::MeshParamBlockReader::read(
                 pb,
-                out.raw,
+                raw,
                 obj.cursorAfterMatrix,
                 obj.cursorAfterParams,
                 out.meshPoolStart,
@@ -162,15 +155,21 @@ static void fillPart(asset::O3DParsedPart& out,
 
             if (!ok)
             {
+                ++st.paramFailed;
+#ifdef O3D_DEBUG_VERBOSE_PARSER
                 core::Log::pipelineInfo(
                     std::string("[ModelParser] MeshParam FAILED (mesh-object) | at=") +
                     std::to_string(obj.cursorAfterMatrix) + " err=" + pbErr
                     );
+#endif
                 continue;
             }
 
-            out.meshParamBlocks.push_back(pb);
+            ++st.paramBlocks;
+            if (pb.isRenderable)
+                ++st.renderBlocks;
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
             core::Log::pipelineInfo(
                 std::string("[ModelParser] MeshParam FOUND | ") +
                 (pb.isRenderable ? "RENDER" : "DUMMY") +
@@ -180,18 +179,145 @@ static void fillPart(asset::O3DParsedPart& out,
                 " stride=" + std::to_string(pb.block.vertexStride) +
                 " subMeshes=" + std::to_string(pb.subMeshes.size())
                 );
+#endif
+
+            out.meshParamBlocks.push_back(std::move(pb));
         }
     }
 
-    core::Log::pipelineInfo(
-        std::string("[ModelParser] MeshParamBlock TOTAL = ") +
-        std::to_string(out.meshParamBlocks.size())
-        );
+    // ============================================================
+    // VB/IB – deterministisch aus den MeshParamBlock-Feldern
+    // ============================================================
+    out.meshBuffers.clear();
+
+    for (std::size_t i = 0; i < out.meshParamBlocks.size(); ++i)
+    {
+        const auto& pb = out.meshParamBlocks[i];
+        if (!pb.isRenderable)
+            continue;
+
+        asset::parser::o3d::VertexBufferResult vb;
+        std::string vbErr;
+        if (!asset::parser::o3d::VertexBufferReader::readFromBlock(
+                vb, raw, pb.block, out.meshPoolStart, &vbErr))
+        {
+            ++st.vbFailed;
+
+            // Diagnose: was hätte die Stride-Heuristik an dieser Stelle gefunden?
+            asset::parser::o3d::VertexBufferResult diag;
+            std::string diagErr;
+            asset::parser::o3d::VertexBufferReader::read(
+                diag, raw, out.meshPoolStart + pb.block.vertexOffset, &diagErr);
+
+            noteError(st,
+                std::string(name) + ": VB pbAt=" + std::to_string(pb.paramBlockStartAbs) +
+                " " + vbErr +
+                " | heuristic=" + (diag.found
+                    ? "stride " + std::to_string(diag.vertexStride) + " vc " + std::to_string(diag.vertexCount)
+                    : "none"));
+            continue;
+        }
+
+        if (!vb.layoutFromFvf)
+            ++st.fvfMismatch;
+
+        asset::parser::o3d::IndexBufferResult ib;
+        std::string ibErr;
+        if (!asset::parser::o3d::IndexBufferReader::read(
+                ib, raw, pb.block, out.meshPoolStart, &ibErr))
+        {
+            ++st.ibFailed;
+            noteError(st, std::string(name) + ": IB pbAt=" + std::to_string(pb.paramBlockStartAbs) + " " + ibErr);
+            continue;
+        }
+
+        asset::O3DMeshBuffers mb;
+        mb.blockIndex    = i;
+        mb.layout        = vb.layout;
+        mb.layoutFromFvf = vb.layoutFromFvf;
+        mb.vertexCount   = pb.block.vertexCount;
+        mb.vertexStride  = pb.block.vertexStride;
+        mb.vertexBytes   = std::move(vb.raw);
+        mb.indices       = std::move(ib.indices);
+
+        if (out.meshBuffers.empty())
+        {
+            out.hasVertexBuffer    = true;
+            out.vertexBufferCursor = vb.vertexDataStart;
+
+            out.hasIndexBuffer    = true;
+            out.indexBufferCursor = ib.indexDataStart;
+            out.indexStride       = sizeof(std::uint16_t);
+            out.indexIsU32        = false;
+
+            out.meshParamCursor = pb.paramBlockStartAbs;
+            out.vertexCount     = pb.block.vertexCount;
+            out.indexCount      = pb.block.indexCount;
+            out.vertexStride    = pb.block.vertexStride;
+            out.vertexOffsetRel = pb.block.vertexOffset;
+            out.indexOffsetRel  = pb.block.indexOffset;
+            out.primitiveType   = pb.block.primitiveType;
+            out.materialIndex   = pb.block.materialIndex;
+            out.vertexStartAbs  = vb.vertexDataStart;
+            out.indexStartAbs   = ib.indexDataStart;
+            out.indexOffset     = ib.indexDataStart;
+        }
+
+        out.meshBuffers.push_back(std::move(mb));
+        ++st.meshBuffers;
+    }
 }
 }
 namespace asset::parser
 {
+    void ModelParser::Stats::add(const Stats& o)
+    {
+        parts        += o.parts;
+        partsFailed  += o.partsFailed;
+        objects      += o.objects;
+        meshObjects  += o.meshObjects;
+        paramBlocks  += o.paramBlocks;
+        paramFailed  += o.paramFailed;
+        renderBlocks += o.renderBlocks;
+        meshBuffers  += o.meshBuffers;
+        vbFailed     += o.vbFailed;
+        ibFailed     += o.ibFailed;
+        fvfMismatch  += o.fvfMismatch;
+
+        if (firstError.empty())
+            firstError = o.firstError;
+    }
+
+    std::string ModelParser::Stats::summary() const
+    {
+        std::string s =
+            "parts=" + std::to_string(parts) +
+            " partsFailed=" + std::to_string(partsFailed) +
+            " objects=" + std::to_string(objects) +
+            " meshObjects=" + std::to_string(meshObjects) +
+            " paramBlocks=" + std::to_string(paramBlocks) +
+            " paramFailed=" + std::to_string(paramFailed) +
+            " render=" + std::to_string(renderBlocks) +
+            " buffers=" + std::to_string(meshBuffers) +
+            " vbFailed=" + std::to_string(vbFailed) +
+            " ibFailed=" + std::to_string(ibFailed) +
+            " fvfMismatch=" + std::to_string(fvfMismatch);
+
+        if (!firstError.empty())
+            s += " firstError=" + firstError;
+        return s;
+    }
+
     bool ModelParser::parse(asset::O3DParsed& out, const asset::O3DDecoded& in, std::string* err)
+    {
+        return parse(out, in, Options{}, nullptr, err);
+    }
+
+    bool ModelParser::parse(asset::O3DParsed& out,
+                            const asset::O3DDecoded& in,
+                            const Options& opts,
+                            Stats* stats,
+                            std::string* err)
     {
         out = {};
 
@@ -201,8 +327,12 @@ namespace asset::parser
             return false;
         }
 
-        fillPart(out.skeleton, in.skeleton, "skeleton");
-        fillPart(out.mesh, in.mesh, "mesh");
+        Stats local;
+        Stats& st = stats ? *stats : local;
+        st = {};
+
+        fillPart(out.skeleton, in.skeleton, "skeleton", opts, st);
+        fillPart(out.mesh, in.mesh, "mesh", opts, st);
         return true;
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
 namespace asset { struct O3DDecoded; struct O3DParsed; }
@@ -8,7 +9,41 @@ namespace asset::parser
     class ModelParser
     {
     public:
+        struct Options
+        {
+            // false -> O3DParsedPart::raw bleibt leer (Bytes liegen weiter in O3DDecoded)
+            bool keepRaw = true;
+        };
+
+        // Zähler statt Log-Zeilen pro Objekt/Block; der Aufrufer loggt einmal pro Modell.
+        // Einzelne Zeilen pro Objekt gibt es nur mit O3D_DEBUG_VERBOSE_PARSER.
+        struct Stats
+        {
+            std::uint32_t parts        = 0;  // vorhandene Parts (skeleton/mesh)
+            std::uint32_t partsFailed  = 0;  // Header/ObjectReader/PoolDir gescheitert
+            std::uint32_t objects      = 0;
+            std::uint32_t meshObjects  = 0;  // Kandidaten, die vor dem MeshPool enden
+            std::uint32_t paramBlocks  = 0;
+            std::uint32_t paramFailed  = 0;
+            std::uint32_t renderBlocks = 0;
+            std::uint32_t meshBuffers  = 0;
+            std::uint32_t vbFailed     = 0;
+            std::uint32_t ibFailed     = 0;
+            std::uint32_t fvfMismatch  = 0;
+
+            std::string firstError;          // erster Fehler (Details), sonst leer
+
+            void add(const Stats& o);
+            std::string summary() const;
+        };
+
         // Strukturelle Analyse: Header/Chunks/Blöcke erkennen – keine Interpretation.
         static bool parse(asset::O3DParsed& out, const asset::O3DDecoded& in, std::string* outError = nullptr);
+
+        static bool parse(asset::O3DParsed& out,
+                          const asset::O3DDecoded& in,
+                          const Options& opts,
+                          Stats* stats,
+                          std::string* outError = nullptr);
     };
 }
@@ -16,20 +16,12 @@ static std::string toLowerCopy(std::string s)
 
 static bool readVec3(asset::decode::BinaryReader& br, Vec3& out)
 {
-    auto x = br.readLE<float>();
-    auto y = br.readLE<float>();
-    auto z = br.readLE<float>();
-    if (!x || !y || !z) return false;
-    out.x = *x; out.y = *y; out.z = *z;
+    float v[3];
+    if (!br.readArray(v)) return false;
+    out.x = v[0]; out.y = v[1]; out.z = v[2];
     return true;
 }
 
-static bool skip(asset::decode::BinaryReader& br, std::size_t n)
-{
-    const std::size_t pos = br.tell();
-    return br.seek(pos + n);
-}
-
 bool HeaderReader::read(O3DHeader& out,
                         const std::vector<std::uint8_t>& bytes,
                         const std::optional<std::string>& expectedFileNameLower,
@@ -44,7 +36,7 @@ bool HeaderReader::read(O3DHeader& out,
         return false;
     }
 
-    asset::decode::BinaryReader br(reinterpret_cast<const std::vector<unsigned char>&>(bytes));
+    asset::decode::BinaryReader br(bytes);
 
     // --- GameSource ---
     // resFp.Read(&cLen, 1, 1);
@@ -65,8 +57,8 @@ bool HeaderReader::read(O3DHeader& out,
     }
 
     // resFp.Read(buff, cLen, 1);
-    auto nameBytes = br.readBytes(nameLen);
-    if (nameBytes.size() != nameLen)
+    const auto nameBytes = br.readSpan(nameLen);
+    if (!nameBytes)
     {
         if (outError) *outError = "HeaderReader: cannot read embedded filename bytes.";
         core::Log::pipelineError("HeaderReader: cannot read embedded filename bytes.");
@@ -76,9 +68,9 @@ bool HeaderReader::read(O3DHeader& out,
     // for j: buff[j] ^= 0xCD;
     std::string embedded;
     embedded.resize(nameLen);
-    for (std::size_t i = 0; i < nameBytes.size(); ++i)
+    for (std::size_t i = 0; i < nameBytes->size(); ++i)
     {
-        embedded[i] = static_cast<char>(nameBytes[i] ^ 0xCD);
+        embedded[i] = static_cast<char>((*nameBytes)[i] ^ 0xCD);
     }
 
     // GameSource lowercases internal filename; wir normalisieren ebenfalls
@@ -162,7 +154,7 @@ bool HeaderReader::read(O3DHeader& out,
     out.scrollV = *sv;
 
     // resFp.Seek(16, SEEK_CUR); // reserved
-    if (!skip(br, 16))
+    if (!br.skip(16))
     {
         if (outError) *outError = "HeaderReader: cannot skip reserved(16).";
         core::Log::pipelineError("HeaderReader: cannot skip reserved(16).");
@@ -260,8 +252,9 @@ bool HeaderReader::read(O3DHeader& out,
     out.hasBones = (out.maxBone > 0);
 
     // ============================
-    // 🔥 PIPELINE DUMP (header summary)
+    // 🔥 PIPELINE DUMP (header summary) – nur verbose, sonst zählt ModelParser
     // ============================
+#ifdef O3D_DEBUG_VERBOSE_PARSER
     core::Log::pipelineInfo(
         "[HEADER] name=" + out.embeddedFileNameLower +
         " ver=" + std::to_string(out.version) +
@@ -269,6 +262,7 @@ bool HeaderReader::read(O3DHeader& out,
         " poolSize=" + std::to_string(out.poolSize) +
         " cursor=" + std::to_string(out.cursorAfterHeader)
         );
+#endif
 
 #ifdef O3D_DEBUG_VERBOSE_HEADER
     core::Log::pipelineInfo(" serialId=" + std::to_string(out.serialId));
@@ -284,10 +278,12 @@ bool HeaderReader::read(O3DHeader& out,
     core::Log::pipelineInfo(" hasBones=" + std::string(out.hasBones ? "1" : "0"));
 #endif
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
     if (out.version >= 22)
         core::Log::pipelineInfo(" hasForce34=1");
     else
         core::Log::pipelineInfo(" hasForce34=0");
+#endif
 
     if (out.hasBones)
     {
@@ -295,8 +291,10 @@ bool HeaderReader::read(O3DHeader& out,
         out.hasMotion = (out.maxFrame > 0);
         out.cursorAfterHeader = br.tell();
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
         core::Log::pipelineInfo(" hasMotion=" + std::string(out.hasMotion ? "1" : "0"));
         core::Log::pipelineInfo(" cursorAfterHeader=" + std::to_string(out.cursorAfterHeader));
+#endif
         return true;
     }
 
@@ -312,8 +310,10 @@ bool HeaderReader::read(O3DHeader& out,
 
     out.cursorAfterHeader = br.tell();
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
     core::Log::pipelineInfo(" poolSize=" + std::to_string(out.poolSize));
     core::Log::pipelineInfo(" cursorAfterHeader=" + std::to_string(out.cursorAfterHeader));
+#endif
 
     return true;
 }
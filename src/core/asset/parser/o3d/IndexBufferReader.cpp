@@ -1 +1,56 @@
-//WIP
\ No newline at end of file
+#include "IndexBufferReader.h"
+#include "MeshParamBlockReader.h"
+#include "asset/decoder/BinaryReader.h"
+
+namespace asset::parser::o3d
+{
+bool IndexBufferReader::read(IndexBufferResult& out,
+                             const std::vector<std::uint8_t>& bytes,
+                             const MeshParamBlock& block,
+                             std::size_t meshPoolStart,
+                             std::string* outError)
+{
+    out = {};
+
+    if (block.indexCount == 0)
+    {
+        if (outError) *outError = "IndexBufferReader: block has no indices.";
+        return false;
+    }
+
+    const std::uint64_t start = static_cast<std::uint64_t>(meshPoolStart) + block.indexOffset;
+    const std::uint64_t size  = static_cast<std::uint64_t>(block.indexCount) * sizeof(std::uint16_t);
+    if (start > bytes.size() || size > bytes.size() - start)
+    {
+        if (outError)
+            *outError = "IndexBufferReader: index range out of file (start=" + std::to_string(start) +
+                        " bytes=" + std::to_string(size) + " file=" + std::to_string(bytes.size()) + ")";
+        return false;
+    }
+
+    asset::decode::BinaryReader br(bytes);
+    br.seek(static_cast<std::size_t>(start));
+
+    out.indices.resize(block.indexCount);
+    br.readArray(out.indices.data(), out.indices.size());
+
+    std::uint32_t maxIndex = 0;
+    for (std::uint16_t i : out.indices)
+        maxIndex = i > maxIndex ? i : maxIndex;
+
+    if (maxIndex >= block.vertexCount)
+    {
+        if (outError)
+            *outError = "IndexBufferReader: index " + std::to_string(maxIndex) +
+                        " >= vertexCount " + std::to_string(block.vertexCount);
+        out.indices.clear();
+        return false;
+    }
+
+    out.found = true;
+    out.indexDataStart = static_cast<std::size_t>(start);
+    out.indexCount = block.indexCount;
+    out.maxIndex = maxIndex;
+    return true;
+}
+}
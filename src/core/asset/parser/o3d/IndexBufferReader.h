@@ -1 +1,33 @@
-//WIP
\ No newline at end of file
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <string>
+
+namespace asset::parser::o3d
+{
+struct MeshParamBlock;
+
+struct IndexBufferResult
+{
+    bool found = false;
+
+    std::size_t indexDataStart = 0;
+    std::size_t indexCount     = 0;
+    std::uint32_t maxIndex     = 0;
+
+    std::vector<std::uint16_t> indices; // O3D: immer 16 Bit (D3DFMT_INDEX16)
+};
+
+class IndexBufferReader
+{
+public:
+    // Liest block.indexCount Indizes ab meshPoolStart + block.indexOffset in einem Durchgang
+    // und prüft jeden Index gegen block.vertexCount.
+    static bool read(IndexBufferResult& out,
+                     const std::vector<std::uint8_t>& bytes,
+                     const MeshParamBlock& block,
+                     std::size_t meshPoolStart,
+                     std::string* outError);
+};
+}
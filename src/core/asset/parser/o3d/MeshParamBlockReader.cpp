@@ -4,17 +4,10 @@
 #include <iomanip>
 
 #include "Log.h"
+#include "asset/decoder/BinaryReader.h"
 
 namespace asset::parser::o3d
 {
-static uint32_t readU32LE(const std::vector<uint8_t>& raw, std::size_t off)
-{
-    return (uint32_t)raw[off + 0]
-           | ((uint32_t)raw[off + 1] << 8)
-           | ((uint32_t)raw[off + 2] << 16)
-           | ((uint32_t)raw[off + 3] << 24);
-}
-
 static std::string hex36(const std::vector<uint8_t>& raw, std::size_t off)
 {
     std::ostringstream ss;
@@ -27,21 +20,23 @@ static std::string hex36(const std::vector<uint8_t>& raw, std::size_t off)
 
 static bool readBlockAt(const std::vector<uint8_t>& raw, std::size_t off, MeshParamBlock& p, std::string* err)
 {
-    if (off + 36 > raw.size())
+    asset::decode::BinaryReader br(raw);
+    std::uint32_t v[9];
+    if (!br.seek(off) || !br.readArray(v))
     {
         if (err) *err = "MeshParamBlock: out of range (need 36 bytes).";
         return false;
     }
 
-    p.vertexCount   = readU32LE(raw, off + 0x00);
-    p.indexCount    = readU32LE(raw, off + 0x04);
-    p.vertexStride  = readU32LE(raw, off + 0x08);
-    p.vertexOffset  = readU32LE(raw, off + 0x0C);
-    p.indexOffset   = readU32LE(raw, off + 0x10);
-    p.primitiveType = readU32LE(raw, off + 0x14);
-    p.vertexFormat  = readU32LE(raw, off + 0x18);
-    p.materialIndex = readU32LE(raw, off + 0x1C);
-    p.unkExtra      = readU32LE(raw, off + 0x20);
+    p.vertexCount   = v[0];
+    p.indexCount    = v[1];
+    p.vertexStride  = v[2];
+    p.vertexOffset  = v[3];
+    p.indexOffset   = v[4];
+    p.primitiveType = v[5];
+    p.vertexFormat  = v[6];
+    p.materialIndex = v[7];
+    p.unkExtra      = v[8];
     return true;
 }
 
@@ -117,15 +112,18 @@ static void readSubMeshes(
         out.block.indexOffset +
         out.block.indexCount * 2;
 
-    const std::size_t maxEnd = raw.size();
+    asset::decode::BinaryReader br(raw);
+    if (!br.seek(cursor))
+        return;
 
-    while (cursor + 16 <= maxEnd)
+    std::uint32_t v[4];
+    while (br.readArray(v))
     {
         SubMesh sm{};
-        sm.indexStart     = readU32LE(raw, cursor + 0);
-        sm.indexCount     = readU32LE(raw, cursor + 4);
-        sm.materialIndex  = readU32LE(raw, cursor + 8);
-        sm.primitiveType  = readU32LE(raw, cursor + 12);
+        sm.indexStart     = v[0];
+        sm.indexCount     = v[1];
+        sm.materialIndex  = v[2];
+        sm.primitiveType  = v[3];
 
         // Plausibilitätscheck
         if (sm.indexCount == 0)
@@ -135,7 +133,6 @@ static void readSubMeshes(
             break;
 
         out.subMeshes.push_back(sm);
-        cursor += 16;
     }
 }
 
@@ -212,6 +209,7 @@ bool MeshParamBlockReader::read(
             out.block = p;
             readSubMeshes(out, raw, meshPoolStart);
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
             core::Log::pipelineInfo(
                 "[MeshParamBlock] SubMeshes count=" + std::to_string(out.subMeshes.size())
                 );
@@ -227,6 +225,7 @@ bool MeshParamBlockReader::read(
                     " prim=" + std::to_string(sm.primitiveType)
                     );
             }
+#endif
             return true;
         }
     }
@@ -279,6 +278,7 @@ bool MeshParamBlockReader::read(
 
             readSubMeshes(out, raw, meshPoolStart);
 
+#ifdef O3D_DEBUG_VERBOSE_PARSER
             core::Log::pipelineInfo(
                 "[MeshParamBlock] SubMeshes count=" + std::to_string(out.subMeshes.size())
                 );
@@ -294,6 +294,7 @@ bool MeshParamBlockReader::read(
                     " prim=" + std::to_string(sm.primitiveType)
                     );
             }
+#endif
             return true;
         }
     }
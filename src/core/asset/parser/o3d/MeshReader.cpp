@@ -8,14 +8,6 @@
 
 namespace asset::parser::o3d
 {
-static uint32_t readU32LE(const std::vector<uint8_t>& raw, std::size_t off)
-{
-    return (uint32_t)raw[off + 0]
-           | ((uint32_t)raw[off + 1] << 8)
-           | ((uint32_t)raw[off + 2] << 16)
-           | ((uint32_t)raw[off + 3] << 24);
-}
-
 bool MeshReader::read(MeshReadResult& out,
                       const std::vector<std::uint8_t>& bytes,
                       std::size_t startCursor,
@@ -41,14 +33,19 @@ bool MeshReader::read(MeshReadResult& out,
     const std::size_t scanEnd   = std::min(startCursor + (std::size_t)4096, bytes.size());
 
     int found = 0;
+    asset::decode::BinaryReader br(bytes);
 
     for (std::size_t off = scanBegin; off + 16 <= scanEnd; ++off)
     {
         // wir erlauben absichtlich unaligned (Babykargo hatte 1-Byte shift)
-        uint32_t vc   = readU32LE(bytes, off + 0);
-        uint32_t unk  = readU32LE(bytes, off + 4);
-        uint32_t fc   = readU32LE(bytes, off + 8);
-        uint32_t ic   = readU32LE(bytes, off + 12);
+        uint32_t h[4];
+        if (!br.seek(off) || !br.readArray(h))
+            break;
+
+        const uint32_t vc  = h[0];
+        const uint32_t unk = h[1];
+        const uint32_t fc  = h[2];
+        const uint32_t ic  = h[3];
 
         if (vc == 0 || fc == 0 || ic == 0)
             continue;
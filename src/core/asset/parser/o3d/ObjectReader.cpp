@@ -6,23 +6,9 @@
 
 #include "asset/decoder/BinaryReader.h"
 
-#include "ObjectReader.h"
-#include "Log.h"
-
-#include <sstream>
-#include <iomanip>
-
-#include "asset/decoder/BinaryReader.h"
-
 namespace asset::parser::o3d
 {
 
-static bool align4(asset::decode::BinaryReader& br)
-{
-    const std::size_t pos = br.tell();
-    const std::size_t aligned = (pos + 3u) & ~std::size_t(3u);
-    return br.seek(aligned);
-}
 bool ObjectReader::read(ObjectReadResult& out,
                         const std::vector<std::uint8_t>& bytes,
                         const O3DHeader& header,
@@ -30,8 +16,7 @@ bool ObjectReader::read(ObjectReadResult& out,
 {
     out = {};
 
-    asset::decode::BinaryReader br(
-        reinterpret_cast<const std::vector<unsigned char>&>(bytes));
+    asset::decode::BinaryReader br(bytes);
 
     if (!br.seek(header.cursorAfterHeader))
     {
@@ -58,12 +43,6 @@ bool ObjectReader::read(ObjectReadResult& out,
 
     out.groups.resize((std::size_t)out.groupCount);
 
-    auto align4 = [&]() -> bool {
-        const std::size_t pos = br.tell();
-        const std::size_t aligned = (pos + 3u) & ~std::size_t(3u);
-        return br.seek(aligned);
-    };
-
     const bool force34 = (header.hasForce34 != 0);
     const int  floatCount = force34 ? 12 : 16;
 
@@ -96,7 +75,7 @@ bool ObjectReader::read(ObjectReadResult& out,
             auto& obj = grp.objects[(std::size_t)o];
 
             // wichtig: align VOR dem Start-Cursor fürs Objekt setzen
-            if (!align4())
+            if (!br.align(4))
             {
                 if (outError)
                     *outError = std::string("ObjectReader: align4 failed group=")
@@ -118,18 +97,13 @@ bool ObjectReader::read(ObjectReadResult& out,
             obj.unk0 = *unk0Opt;
 
             // ---- MATRIX ----
-            for (int i = 0; i < floatCount; ++i)
+            if (!br.readArray(obj.matrix, (std::size_t)floatCount))
             {
-                auto f = br.readLE<float>();
-                if (!f)
-                {
-                    if (outError)
-                        *outError = std::string("ObjectReader: cannot read matrix[")
-                                    + std::to_string(i) + "] group=" + std::to_string(g)
-                                    + " obj=" + std::to_string(o);
-                    return false;
-                }
-                obj.matrix[i] = *f;
+                if (outError)
+                    *outError = std::string("ObjectReader: cannot read matrix[")
+                                + std::to_string(floatCount) + "] group=" + std::to_string(g)
+                                + " obj=" + std::to_string(o);
+                return false;
             }
 
             if (force34)
@@ -155,18 +129,12 @@ bool ObjectReader::read(ObjectReadResult& out,
             obj.unkA = *unkAOpt;
             obj.unkB = *unkBOpt;
 
-            for (int i = 0; i < 6; ++i)
+            if (!br.readArray(obj.params))
             {
-                auto fOpt = br.readLE<float>();
-                if (!fOpt)
-                {
-                    if (outError)
-                        *outError = std::string("ObjectReader: cannot read params[")
-                                    + std::to_string(i) + "] group=" + std::to_string(g)
-                                    + " obj=" + std::to_string(o);
-                    return false;
-                }
-                obj.params[i] = *fOpt;
+                if (outError)
+                    *outError = std::string("ObjectReader: cannot read params[6] group=")
+                                + std::to_string(g) + " obj=" + std::to_string(o);
+                return false;
             }
 
             auto poolOpt = br.readLE<std::uint32_t>();
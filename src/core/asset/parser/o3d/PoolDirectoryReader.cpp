@@ -7,49 +7,16 @@
 
 namespace asset::parser::o3d
 {
-struct Candidate
+// Ein Directory-Eintrag ist gültig, wenn startCursor + rel im File liegt und 4-aligned ist.
+static bool validEntry(const asset::decode::BinaryReader& br, std::size_t startCursor, std::size_t at,
+                       std::uint32_t& rel, std::size_t& abs)
 {
-    bool found = false;
-    int score = -1;
-    std::size_t dirCursor = 0;
-    std::vector<std::uint32_t> rel;
-    std::vector<std::size_t> abs;
-};
-
-static bool readU32(const std::vector<std::uint8_t>& b, std::size_t at, std::uint32_t& out)
-{
-    if (at + 4 > b.size()) return false;
-    out =  (std::uint32_t)b[at]
-          | ((std::uint32_t)b[at+1] << 8)
-          | ((std::uint32_t)b[at+2] << 16)
-          | ((std::uint32_t)b[at+3] << 24);
-    return true;
-}
-
-static Candidate tryFixed(const std::vector<std::uint8_t>& bytes,
-                          std::size_t startCursor,
-                          std::size_t dirCursor,
-                          std::size_t count)
-{
-    Candidate c;
-    c.dirCursor = dirCursor;
-
-    for (std::size_t i = 0; i < count; ++i)
-    {
-        std::uint32_t rel;
-        if (!readU32(bytes, dirCursor + i * 4, rel)) return c;
-
-        std::size_t abs = startCursor + rel;
-        if (abs >= bytes.size()) return c;
-        if ((abs & 3) != 0) return c;
-
-        c.rel.push_back(rel);
-        c.abs.push_back(abs);
-    }
+    const auto relOpt = br.peekAt<std::uint32_t>(at);
+    if (!relOpt) return false;
 
-    c.found = true;
-    c.score = (int)count * 10;
-    return c;
+    rel = *relOpt;
+    abs = startCursor + rel;
+    return abs < br.size() && (abs & 3) == 0;
 }
 
 bool PoolDirectoryReader::read(PoolDirectoryResult& out,
@@ -64,26 +31,47 @@ bool PoolDirectoryReader::read(PoolDirectoryResult& out,
     if (header.poolSize <= 0)
         return true;
 
-    Candidate best;
+    // Erster Cursor (4er-Raster ab startCursor) mit poolSize gültigen Einträgen in Folge.
+    // Alle Kandidaten liegen auf demselben Raster -> ein linearer Durchlauf mit
+    // Lauflänge statt poolSize Reads pro Cursor (früher quadratisch).
+    const std::size_t count = static_cast<std::size_t>(header.poolSize);
+    const asset::decode::BinaryReader br(bytes);
 
-    for (std::size_t cur = startCursor; cur + header.poolSize * 4 < bytes.size(); cur += 4)
+    std::size_t run = 0;
+    std::size_t dirCursor = 0;
+    bool found = false;
+
+    for (std::size_t at = startCursor; at + 4 <= bytes.size(); at += 4)
     {
-        Candidate c = tryFixed(bytes, startCursor, cur, header.poolSize);
-        if (c.found && c.score > best.score)
-            best = c;
+        std::uint32_t rel = 0;
+        std::size_t abs = 0;
+        run = validEntry(br, startCursor, at, rel, abs) ? run + 1 : 0;
+
+        if (run >= count)
+        {
+            const std::size_t cur = at + 4 - count * 4;
+            if (cur + count * 4 >= bytes.size())
+                break;
+
+            dirCursor = cur;
+            found = true;
+            break;
+        }
     }
 
-    if (!best.found)
+    if (!found)
         return true;
 
     out.found = true;
-    out.dirCursor = best.dirCursor;
-    out.dirAfterCursor = best.dirCursor + best.rel.size() * 4;
-    out.relValues = best.rel;
-    out.absCursors = best.abs;
+    out.dirCursor = dirCursor;
+    out.dirAfterCursor = dirCursor + count * 4;
+    out.relValues.resize(count);
+    out.absCursors.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+        validEntry(br, startCursor, dirCursor + i * 4, out.relValues[i], out.absCursors[i]);
 
     // Phase 1: erster gültiger Pool
-    out.meshPoolStart = best.abs.empty() ? 0 : best.abs[0];
+    out.meshPoolStart = out.absCursors.empty() ? 0 : out.absCursors[0];
 
     // core::Log::pipelineInfo("[POOL-DIR] FOUND dir=" +
     //                         std::to_string(out.dirCursor) +
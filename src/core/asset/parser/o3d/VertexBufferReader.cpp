@@ -1,4 +1,5 @@
 #include "VertexBufferReader.h"
+#include "MeshParamBlockReader.h"
 #include "Log.h"
 #include "asset/decoder/BinaryReader.h"
 
@@ -9,26 +10,20 @@ namespace asset::parser::o3d
 {
 static bool isFinite(float v) { return std::isfinite(v) != 0; }
 
-static bool readF32(const std::vector<std::uint8_t>& bytes, std::size_t off, float& out)
+static bool readVec3At(const asset::decode::BinaryReader& br, std::size_t off, float& x, float& y, float& z)
 {
-    if (off + 4 > bytes.size()) return false;
-    std::uint32_t u =
-        (std::uint32_t)bytes[off + 0] |
-        ((std::uint32_t)bytes[off + 1] << 8) |
-        ((std::uint32_t)bytes[off + 2] << 16) |
-        ((std::uint32_t)bytes[off + 3] << 24);
-    float f;
-    std::memcpy(&f, &u, 4);
-    out = f;
+    const auto vx = br.peekAt<float>(off + 0);
+    const auto vy = br.peekAt<float>(off + 4);
+    const auto vz = br.peekAt<float>(off + 8);
+    if (!vx || !vy || !vz) return false;
+    x = *vx; y = *vy; z = *vz;
     return true;
 }
 
-static int scoreAsPositionTriplet(const std::vector<std::uint8_t>& bytes, std::size_t off)
+static int scoreAsPositionTriplet(const asset::decode::BinaryReader& br, std::size_t off)
 {
     float x=0,y=0,z=0;
-    if (!readF32(bytes, off + 0, x)) return -999;
-    if (!readF32(bytes, off + 4, y)) return -999;
-    if (!readF32(bytes, off + 8, z)) return -999;
+    if (!readVec3At(br, off, x, y, z)) return -999;
 
     if (!isFinite(x) || !isFinite(y) || !isFinite(z)) return -999;
 
@@ -53,6 +48,110 @@ static std::size_t clampAdd(std::size_t a, std::size_t b, std::size_t maxv)
     return a + b;
 }
 
+bool VertexBufferReader::layoutFromFvf(std::uint32_t fvf, VertexLayout& out)
+{
+    // D3DFVF-Bits (d3d9types.h)
+    constexpr std::uint32_t kPositionMask = 0x400E;
+    constexpr std::uint32_t kNormal       = 0x010;
+    constexpr std::uint32_t kPSize        = 0x020;
+    constexpr std::uint32_t kDiffuse      = 0x040;
+    constexpr std::uint32_t kSpecular     = 0x080;
+    constexpr std::uint32_t kTexCountMask = 0xF00;
+    constexpr std::uint32_t kLastBetaU4   = 0x1000;
+
+    out = {};
+    out.fvf = fvf;
+
+    int off = 0;
+    switch (fvf & kPositionMask)
+    {
+    case 0x002:  off = 12; break;                                   // XYZ
+    case 0x004:  off = 16; break;                                   // XYZRHW
+    case 0x4002: off = 16; break;                                   // XYZW
+    case 0x006: case 0x008: case 0x00A: case 0x00C: case 0x00E:     // XYZB1..5
+        out.blendWeightCount = static_cast<int>(((fvf & kPositionMask) - 0x004) / 2);
+        out.blendWeightOffset = 12;
+        off = 12 + out.blendWeightCount * 4;
+        break;
+    default:
+        return false;
+    }
+
+    out.lastBetaUByte4 = (fvf & kLastBetaU4) != 0 && out.blendWeightCount > 0;
+
+    if (fvf & kNormal)   { out.normalOffset = off;   off += 12; }
+    if (fvf & kPSize)    { off += 4; }
+    if (fvf & kDiffuse)  { out.diffuseOffset = off;  off += 4; }
+    if (fvf & kSpecular) { out.specularOffset = off; off += 4; }
+
+    out.texCoordCount = static_cast<int>((fvf & kTexCountMask) >> 8);
+    if (out.texCoordCount > 8)
+        return false;
+
+    for (int i = 0; i < out.texCoordCount; ++i)
+    {
+        // D3DFVF_TEXCOORDSIZEn: 0 -> 2, 1 -> 3, 2 -> 4, 3 -> 1 Floats
+        static const int kSizes[4] = { 2, 3, 4, 1 };
+        out.texCoordSize[i] = kSizes[(fvf >> (16 + i * 2)) & 3];
+        out.texCoordOffset[i] = off;
+        off += out.texCoordSize[i] * 4;
+    }
+
+    out.stride = static_cast<std::uint32_t>(off);
+    return true;
+}
+
+bool VertexBufferReader::readFromBlock(VertexBufferResult& out,
+                                       const std::vector<std::uint8_t>& bytes,
+                                       const MeshParamBlock& block,
+                                       std::size_t meshPoolStart,
+                                       std::string* outError)
+{
+    out = {};
+
+    if (block.vertexCount == 0 || block.vertexStride < 12)
+    {
+        if (outError) *outError = "VertexBufferReader: block has no vertices or stride < 12.";
+        return false;
+    }
+
+    // Größen vorab (64 Bit, kein Überlauf bei kaputten Blöcken)
+    const std::uint64_t start = static_cast<std::uint64_t>(meshPoolStart) + block.vertexOffset;
+    const std::uint64_t size  = static_cast<std::uint64_t>(block.vertexCount) * block.vertexStride;
+    if (start > bytes.size() || size > bytes.size() - start)
+    {
+        if (outError)
+            *outError = "VertexBufferReader: vertex range out of file (start=" + std::to_string(start) +
+                        " bytes=" + std::to_string(size) + " file=" + std::to_string(bytes.size()) + ")";
+        return false;
+    }
+
+    asset::decode::BinaryReader br(bytes);
+    br.seek(static_cast<std::size_t>(start));
+    const auto span = br.readSpan(static_cast<std::size_t>(size));
+
+    VertexLayout layout;
+    if (layoutFromFvf(block.vertexFormat, layout) && layout.stride == block.vertexStride)
+    {
+        out.layoutFromFvf = true;
+        out.layout = layout;
+    }
+    else
+    {
+        // FVF unbekannt/abweichend: nur Position am Anfang ist sicher
+        out.layout = VertexLayout{};
+        out.layout.fvf = block.vertexFormat;
+        out.layout.stride = block.vertexStride;
+    }
+
+    out.found = true;
+    out.vertexDataStart = static_cast<std::size_t>(start);
+    out.vertexStride = block.vertexStride;
+    out.vertexCount = block.vertexCount;
+    out.raw.assign(span->begin(), span->end());
+    return true;
+}
+
 bool VertexBufferReader::read(VertexBufferResult& out,
                               const std::vector<std::uint8_t>& bytes,
                               std::size_t startCursor,
@@ -66,6 +165,8 @@ bool VertexBufferReader::read(VertexBufferResult& out,
         return false;
     }
 
+    const asset::decode::BinaryReader br(bytes);
+
     core::Log::pipelineInfo("[VB]");
     core::Log::pipelineInfo(" startCursor=" + std::to_string(startCursor));
 
@@ -92,16 +193,16 @@ bool VertexBufferReader::read(VertexBufferResult& out,
 
             if (v2 + 12 > bytes.size()) continue;
 
-            int s0 = scoreAsPositionTriplet(bytes, v0);
-            int s1 = scoreAsPositionTriplet(bytes, v1);
-            int s2 = scoreAsPositionTriplet(bytes, v2);
+            int s0 = scoreAsPositionTriplet(br, v0);
+            int s1 = scoreAsPositionTriplet(br, v1);
+            int s2 = scoreAsPositionTriplet(br, v2);
 
             if (s0 < 5 || s1 < 5 || s2 < 5) continue;
 
             // Bonus wenn Positionen sich ändern (nicht 3x gleich)
             float x0=0,y0=0,z0=0,x1=0,y1=0,z1=0;
-            readF32(bytes, v0+0, x0); readF32(bytes, v0+4, y0); readF32(bytes, v0+8, z0);
-            readF32(bytes, v1+0, x1); readF32(bytes, v1+4, y1); readF32(bytes, v1+8, z1);
+            readVec3At(br, v0, x0, y0, z0);
+            readVec3At(br, v1, x1, y1, z1);
 
             int deltaBonus = (x0!=x1 || y0!=y1 || z0!=z1) ? 10 : 0;
 
@@ -136,7 +237,7 @@ bool VertexBufferReader::read(VertexBufferResult& out,
     {
         if (cur + 12 > bytes.size()) break;
 
-        int s = scoreAsPositionTriplet(bytes, cur);
+        int s = scoreAsPositionTriplet(br, cur);
         if (s < 5) break;
 
         ++count;
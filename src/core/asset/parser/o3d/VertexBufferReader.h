@@ -6,6 +6,28 @@
 
 namespace asset::parser::o3d
 {
+struct MeshParamBlock;
+
+// Attribut-Offsets innerhalb eines Vertex (aus D3DFVF), -1 = nicht vorhanden
+struct VertexLayout
+{
+    std::uint32_t fvf    = 0;
+    std::uint32_t stride = 0;
+
+    int positionOffset    = 0;
+    int blendWeightCount  = 0;     // XYZB1..XYZB5 (inkl. evtl. Index-DWORD)
+    int blendWeightOffset = -1;
+    bool lastBetaUByte4   = false; // letztes "Weight" sind 4 Bone-Indizes (UBYTE4)
+
+    int normalOffset   = -1;
+    int diffuseOffset  = -1;
+    int specularOffset = -1;
+
+    int texCoordCount = 0;
+    int texCoordOffset[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+    int texCoordSize[8]   = {};    // Floats pro Set (1..4)
+};
+
 struct VertexBufferResult
 {
     bool found = false;
@@ -14,12 +36,28 @@ struct VertexBufferResult
     std::size_t vertexStride    = 0;
     std::size_t vertexCount     = 0;
 
+    // true -> layout stammt aus dem FVF und passt zum Stride des Blocks
+    bool layoutFromFvf = false;
+    VertexLayout layout;
+
     std::vector<std::uint8_t> raw; // vertexCount * vertexStride
 };
 
 class VertexBufferReader
 {
 public:
+    // Formatgetrieben: Start/Stride/Count direkt aus dem MeshParamBlock,
+    // Größen werden vorab geprüft, ein einziger begrenzter Read.
+    static bool readFromBlock(VertexBufferResult& out,
+                              const std::vector<std::uint8_t>& bytes,
+                              const MeshParamBlock& block,
+                              std::size_t meshPoolStart,
+                              std::string* outError);
+
+    static bool layoutFromFvf(std::uint32_t fvf, VertexLayout& out);
+
+    // Heuristik (Stride-Raten um startCursor) – nur noch Diagnose-Fallback,
+    // wenn readFromBlock scheitert.
     static bool read(VertexBufferResult& out,
                      const std::vector<std::uint8_t>& bytes,
                      std::size_t startCursor,
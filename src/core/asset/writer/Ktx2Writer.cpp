@@ -0,0 +1,333 @@
+#include "core/asset/writer/Ktx2Writer.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    // VkFormat (Vulkan-Spezifikation)
+    constexpr std::uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+    constexpr std::uint32_t VK_FORMAT_BC1_RGBA_SRGB_BLOCK  = 134;
+    constexpr std::uint32_t VK_FORMAT_BC2_UNORM_BLOCK      = 135;
+    constexpr std::uint32_t VK_FORMAT_BC2_SRGB_BLOCK       = 136;
+    constexpr std::uint32_t VK_FORMAT_BC3_UNORM_BLOCK      = 137;
+    constexpr std::uint32_t VK_FORMAT_BC3_SRGB_BLOCK       = 138;
+    constexpr std::uint32_t VK_FORMAT_BC4_UNORM_BLOCK      = 139;
+    constexpr std::uint32_t VK_FORMAT_BC4_SNORM_BLOCK      = 140;
+    constexpr std::uint32_t VK_FORMAT_BC5_UNORM_BLOCK      = 141;
+    constexpr std::uint32_t VK_FORMAT_BC5_SNORM_BLOCK      = 142;
+
+    // Khronos Data Format (Basic Descriptor Block)
+    constexpr std::uint8_t KHR_DF_MODEL_BC1A = 128;
+    constexpr std::uint8_t KHR_DF_MODEL_BC2  = 129;
+    constexpr std::uint8_t KHR_DF_MODEL_BC3  = 130;
+    constexpr std::uint8_t KHR_DF_MODEL_BC4  = 131;
+    constexpr std::uint8_t KHR_DF_MODEL_BC5  = 132;
+
+    constexpr std::uint8_t KHR_DF_PRIMARIES_BT709   = 1;
+    constexpr std::uint8_t KHR_DF_TRANSFER_LINEAR   = 1;
+    constexpr std::uint8_t KHR_DF_TRANSFER_SRGB     = 2;
+    constexpr std::uint8_t KHR_DF_FLAG_ALPHA_PREMULTIPLIED = 1;
+
+    constexpr std::uint8_t KHR_DF_CHANNEL_BC1A_ALPHAPRESENT = 1;
+    constexpr std::uint8_t KHR_DF_CHANNEL_COLOR = 0;
+    constexpr std::uint8_t KHR_DF_CHANNEL_RED   = 0;
+    constexpr std::uint8_t KHR_DF_CHANNEL_GREEN = 1;
+    constexpr std::uint8_t KHR_DF_CHANNEL_ALPHA = 15;
+
+    constexpr std::uint8_t KHR_DF_SAMPLE_DATATYPE_LINEAR = 0x10;
+    constexpr std::uint8_t KHR_DF_SAMPLE_DATATYPE_SIGNED = 0x40;
+
+    constexpr std::uint8_t kKtx2Identifier[12] =
+    {
+        0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'
+    };
+
+    constexpr std::size_t kHeaderBytes = 12 + 9 * 4 + 4 * 4 + 2 * 8; // 80
+    constexpr std::size_t kLevelIndexEntryBytes = 3 * 8;
+
+    struct Sample
+    {
+        std::uint8_t channel = 0;
+        std::uint8_t qualifiers = 0;
+        std::uint16_t bitOffset = 0;
+    };
+
+    // Schreibt little endian in einen vorab auf Endgröße gebrachten Puffer.
+    // Läuft ein Feld über das Ende, wird nichts geschrieben und ok() ist false.
+    class ByteWriter
+    {
+    public:
+        explicit ByteWriter(std::vector<std::uint8_t>& b) : m_b(b) {}
+
+        void u8(std::uint8_t v)   { put(v); }
+        void u16(std::uint16_t v) { put(v); }
+        void u32(std::uint32_t v) { put(v); }
+        void u64(std::uint64_t v) { put(v); }
+
+        void bytes(const void* src, std::size_t n)
+        {
+            if (!reserve(n)) return;
+            if (n) std::memcpy(m_b.data() + m_at, src, n);
+            m_at += n;
+        }
+
+        void zeros(std::size_t n)
+        {
+            if (!reserve(n)) return;
+            std::memset(m_b.data() + m_at, 0, n);
+            m_at += n;
+        }
+
+        bool ok() const { return !m_overflow && m_at == m_b.size(); }
+
+    private:
+        template <typename T>
+        void put(T v)
+        {
+            std::uint8_t le[sizeof(T)];
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+                le[i] = (std::uint8_t)(v >> (8 * i));
+            bytes(le, sizeof(T));
+        }
+
+        bool reserve(std::size_t n)
+        {
+            if (m_overflow || n > m_b.size() - m_at)
+            {
+                m_overflow = true;
+                return false;
+            }
+            return true;
+        }
+
+        std::vector<std::uint8_t>& m_b;
+        std::size_t m_at = 0;
+        bool m_overflow = false;
+    };
+
+    static std::uint32_t vkFormatFor(asset::DdsBlockFormat f, bool srgb, bool snorm)
+    {
+        switch (f)
+        {
+        case asset::DdsBlockFormat::BC1: return srgb ? VK_FORMAT_BC1_RGBA_SRGB_BLOCK : VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case asset::DdsBlockFormat::BC2: return srgb ? VK_FORMAT_BC2_SRGB_BLOCK : VK_FORMAT_BC2_UNORM_BLOCK;
+        case asset::DdsBlockFormat::BC3: return srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+        case asset::DdsBlockFormat::BC4: return snorm ? VK_FORMAT_BC4_SNORM_BLOCK : VK_FORMAT_BC4_UNORM_BLOCK;
+        case asset::DdsBlockFormat::BC5: return snorm ? VK_FORMAT_BC5_SNORM_BLOCK : VK_FORMAT_BC5_UNORM_BLOCK;
+        }
+        return 0;
+    }
+
+    // Data Format Descriptor (dfdTotalSize + ein Basic Descriptor Block)
+    static bool buildDfd(std::vector<std::uint8_t>& b, const asset::DdsPayloadInfo& info, bool srgb, bool snorm)
+    {
+        std::uint8_t model = KHR_DF_MODEL_BC1A;
+        std::vector<Sample> samples;
+
+        // DXT1 kann 1-Bit-Alpha tragen (DdsDecoder dekodiert c0 <= c1 transparent)
+        switch (info.format)
+        {
+        case asset::DdsBlockFormat::BC1:
+            model = KHR_DF_MODEL_BC1A;
+            samples.push_back({ KHR_DF_CHANNEL_BC1A_ALPHAPRESENT, 0, 0 });
+            break;
+        case asset::DdsBlockFormat::BC2:
+        case asset::DdsBlockFormat::BC3:
+            model = (info.format == asset::DdsBlockFormat::BC2) ? KHR_DF_MODEL_BC2 : KHR_DF_MODEL_BC3;
+            // Alpha ist auch bei sRGB linear
+            samples.push_back({ KHR_DF_CHANNEL_ALPHA, srgb ? KHR_DF_SAMPLE_DATATYPE_LINEAR : (std::uint8_t)0, 0 });
+            samples.push_back({ KHR_DF_CHANNEL_COLOR, 0, 64 });
+            break;
+        case asset::DdsBlockFormat::BC4:
+            model = KHR_DF_MODEL_BC4;
+            samples.push_back({ KHR_DF_CHANNEL_RED, 0, 0 });
+            break;
+        case asset::DdsBlockFormat::BC5:
+            model = KHR_DF_MODEL_BC5;
+            samples.push_back({ KHR_DF_CHANNEL_RED, 0, 0 });
+            samples.push_back({ KHR_DF_CHANNEL_GREEN, 0, 64 });
+            break;
+        }
+
+        const std::uint16_t blockSize = (std::uint16_t)(24 + 16 * samples.size());
+
+        b.resize(4u + blockSize);
+        ByteWriter w(b);
+
+        w.u32(4u + blockSize);              // dfdTotalSize
+        w.u32(0);                           // vendorId = KHRONOS, descriptorType = BASICFORMAT
+        w.u16(2);                           // versionNumber (KDF 1.3)
+        w.u16(blockSize);
+
+        w.u8(model);
+        w.u8(KHR_DF_PRIMARIES_BT709);
+        w.u8(srgb ? KHR_DF_TRANSFER_SRGB : KHR_DF_TRANSFER_LINEAR);
+        w.u8(info.premultipliedAlpha ? KHR_DF_FLAG_ALPHA_PREMULTIPLIED : (std::uint8_t)0);
+
+        w.u8(3); w.u8(3); w.u8(0); w.u8(0);                       // texelBlockDimension (4x4x1x1, minus 1)
+        w.u8((std::uint8_t)info.blockBytes);                      // bytesPlane0
+        w.zeros(7);
+
+        for (const Sample& s : samples)
+        {
+            const std::uint8_t qualifiers = (std::uint8_t)(s.qualifiers | (snorm ? KHR_DF_SAMPLE_DATATYPE_SIGNED : 0));
+
+            w.u16(s.bitOffset);
+            w.u8(63);                                             // bitLength - 1
+            w.u8((std::uint8_t)(s.channel | qualifiers));
+            w.u32(0);                                             // samplePosition 0..3
+            w.u32(snorm ? 0x80000000u : 0u);                      // sampleLower
+            w.u32(snorm ? 0x7FFFFFFFu : 0xFFFFFFFFu);             // sampleUpper
+        }
+        return w.ok();
+    }
+
+    static bool buildKeyValue(std::vector<std::uint8_t>& b, const char* key, const char* value)
+    {
+        const std::size_t keyLen = std::strlen(key) + 1;
+        const std::size_t valueLen = std::strlen(value) + 1;
+        const std::size_t pairLen = keyLen + valueLen;
+
+        b.resize((4 + pairLen + 3) / 4 * 4);
+        ByteWriter w(b);
+
+        w.u32((std::uint32_t)pairLen);
+        w.bytes(key, keyLen);
+        w.bytes(value, valueLen);
+        w.zeros(b.size() - 4 - pairLen);
+        return w.ok();
+    }
+}
+
+namespace asset::writer
+{
+    bool Ktx2Writer::writeFromDds(
+        const asset::DdsPayloadInfo& info,
+        std::span<const std::uint8_t> ddsBytes,
+        const std::filesystem::path& outFile,
+        bool legacySrgb,
+        std::string* outError)
+    {
+        if (info.mips.empty() || info.width <= 0 || info.height <= 0)
+        {
+            if (outError) *outError = "Ktx2Writer: no mip levels.";
+            return false;
+        }
+
+        for (const auto& mip : info.mips)
+        {
+            if (mip.offset + mip.size > ddsBytes.size())
+            {
+                if (outError) *outError = "Ktx2Writer: mip range outside of DDS bytes.";
+                return false;
+            }
+        }
+
+        const bool colorFormat =
+            info.format == asset::DdsBlockFormat::BC1 ||
+            info.format == asset::DdsBlockFormat::BC2 ||
+            info.format == asset::DdsBlockFormat::BC3;
+
+        const bool srgb = colorFormat && (info.colorSpaceKnown ? info.srgb : legacySrgb);
+        const bool snorm = !colorFormat && info.snorm;
+
+        const std::uint32_t levelCount = (std::uint32_t)info.mips.size();
+
+        // ---- Metadaten-Block (alles vor den Mip-Daten) ----
+        std::vector<std::uint8_t> dfd;
+        std::vector<std::uint8_t> kvd;
+        if (!buildDfd(dfd, info, srgb, snorm) ||
+            !buildKeyValue(kvd, "KTXwriter", "Flyff-Resource-Framework"))
+        {
+            if (outError) *outError = "Ktx2Writer: metadata layout mismatch.";
+            return false;
+        }
+
+        const std::size_t levelIndexOffset = kHeaderBytes;
+        const std::size_t dfdOffset = levelIndexOffset + levelCount * kLevelIndexEntryBytes;
+        const std::size_t kvdOffset = dfdOffset + dfd.size();
+        const std::size_t metaEnd = kvdOffset + kvd.size();
+
+        // Mip-Daten: kleinste Stufe zuerst, jede auf lcm(Blockgröße, 4) ausgerichtet
+        const std::size_t alignment = (std::size_t)info.blockBytes; // 8 oder 16, beide Vielfache von 4
+
+        std::vector<std::uint64_t> levelOffsets(levelCount, 0);
+        std::size_t cursor = metaEnd;
+        for (std::size_t i = levelCount; i-- > 0;)
+        {
+            cursor = (cursor + alignment - 1) / alignment * alignment;
+            levelOffsets[i] = cursor;
+            cursor += info.mips[i].size;
+        }
+
+        std::vector<std::uint8_t> head(metaEnd);
+        ByteWriter w(head);
+
+        w.bytes(kKtx2Identifier, sizeof(kKtx2Identifier));
+        w.u32(vkFormatFor(info.format, srgb, snorm));
+        w.u32(1);                                   // typeSize (1 für blockkomprimiert)
+        w.u32((std::uint32_t)info.width);
+        w.u32((std::uint32_t)info.height);
+        w.u32(0);                                   // pixelDepth
+        w.u32(0);                                   // layerCount
+        w.u32(1);                                   // faceCount
+        w.u32(levelCount);
+        w.u32(0);                                   // supercompressionScheme
+
+        w.u32((std::uint32_t)dfdOffset);
+        w.u32((std::uint32_t)dfd.size());
+        w.u32((std::uint32_t)kvdOffset);
+        w.u32((std::uint32_t)kvd.size());
+        w.u64(0);                                   // sgdByteOffset
+        w.u64(0);                                   // sgdByteLength
+
+        for (std::uint32_t i = 0; i < levelCount; ++i)
+        {
+            w.u64(levelOffsets[i]);
+            w.u64(info.mips[i].size);
+            w.u64(info.mips[i].size);               // uncompressedByteLength
+        }
+
+        w.bytes(dfd.data(), dfd.size());
+        w.bytes(kvd.data(), kvd.size());
+
+        if (!w.ok())
+        {
+            if (outError) *outError = "Ktx2Writer: header layout mismatch.";
+            return false;
+        }
+
+        // ---- Schreiben: Metadaten, dann Blöcke direkt aus den DDS-Bytes ----
+        std::ofstream f(outFile, std::ios::binary);
+        if (!f)
+        {
+            if (outError) *outError = "Ktx2Writer: cannot open for write: " + outFile.string();
+            return false;
+        }
+
+        f.write(reinterpret_cast<const char*>(head.data()), (std::streamsize)head.size());
+
+        static const char zeros[16] = {};
+        std::size_t written = head.size();
+
+        for (std::size_t i = levelCount; i-- > 0;)
+        {
+            const std::size_t pad = (std::size_t)levelOffsets[i] - written;
+            f.write(zeros, (std::streamsize)pad);
+
+            const auto& mip = info.mips[i];
+            f.write(reinterpret_cast<const char*>(ddsBytes.data() + mip.offset), (std::streamsize)mip.size);
+            written += pad + mip.size;
+        }
+
+        if (!f)
+        {
+            if (outError) *outError = "Ktx2Writer: write failed: " + outFile.string();
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+#include "data/asset/decoded/DecodedImageData.h"
+
+namespace asset::writer
+{
+    // KTX2-Container für BC1-BC5 ohne Decode: Blöcke und Mips werden
+    // unverändert aus der DDS übernommen, nur Header/DFD/Level-Index
+    // werden neu geschrieben.
+    class Ktx2Writer
+    {
+    public:
+        // legacySrgb: Farbraum für DDS ohne DX10-Header (BC1-BC3 Farbtexturen).
+        // BC4/BC5 sind Datenkanäle und immer linear.
+        static bool writeFromDds(
+            const asset::DdsPayloadInfo& info,
+            std::span<const std::uint8_t> ddsBytes,
+            const std::filesystem::path& outFile,
+            bool legacySrgb,
+            std::string* outError = nullptr
+        );
+    };
+}
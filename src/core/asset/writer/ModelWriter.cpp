@@ -1,275 +1,724 @@
 #include "core/asset/writer/ModelWriter.h"
+#include "core/asset/io/GatherWriter.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <vector>
-#include <algorithm>
-
-// tinygltf implementation must live in exactly ONE .cpp
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_USE_CPP14
-#include "tiny_gltf.h"
 
 namespace
 {
-    static void appendBytes(std::vector<unsigned char>& dst, const void* src, size_t size)
+    using asset::normalized::Vec2;
+    using asset::normalized::Vec3;
+
+    static_assert(sizeof(Vec3) == 12 && sizeof(Vec2) == 8, "Vec2/Vec3 must be tightly packed floats");
+
+    constexpr std::uint32_t kGlbMagic   = 0x46546C67; // "glTF"
+    constexpr std::uint32_t kGlbVersion = 2;
+    constexpr std::uint32_t kChunkJson  = 0x4E4F534A; // "JSON"
+    constexpr std::uint32_t kChunkBin   = 0x004E4942; // "BIN\0"
+
+    constexpr int kComponentShort  = 5122;
+    constexpr int kComponentUShort = 5123;
+    constexpr int kComponentUInt   = 5125;
+    constexpr int kComponentFloat  = 5126;
+    constexpr int kTargetArray     = 34962;
+    constexpr int kTargetElements  = 34963;
+    constexpr int kModeTriangles   = 4;
+
+    using Segment = asset::io::GatherWriter::Segment;
+
+    static const std::uint8_t kZeros[4] = {};
+
+    static Segment bytesOf(const void* p, std::size_t n)
     {
-        const auto* p = reinterpret_cast<const unsigned char*>(src);
-        dst.insert(dst.end(), p, p + size);
+        return Segment(static_cast<const std::uint8_t*>(p), n);
     }
 
-    static void align4(std::vector<unsigned char>& dst)
+    // Minimaler JSON-Builder (nur was glTF hier braucht)
+    struct Json
+    {
+        std::string s;
+        bool finite = true;   // false -> NaN/Inf gesehen, Ausgabe ist ungültig
+
+        Json& raw(const char* t) { s += t; return *this; }
+
+        Json& num(std::uint64_t v)
+        {
+            char buf[24];
+            const auto r = std::to_chars(buf, buf + sizeof(buf), v);
+            s.append(buf, r.ptr);
+            return *this;
+        }
+
+        // kürzeste Darstellung, die exakt zurückgelesen wird (min/max müssen stimmen).
+        // JSON kennt kein nan/inf: merken, der Aufrufer bricht ab.
+        Json& num(float v)
+        {
+            if (!std::isfinite(v))
+            {
+                finite = false;
+                s += '0';
+                return *this;
+            }
+
+            char buf[32];
+            const auto r = std::to_chars(buf, buf + sizeof(buf), v);
+            s.append(buf, r.ptr);
+            return *this;
+        }
+
+        Json& vec3(const float v[3])
+        {
+            return raw("[").num(v[0]).raw(",").num(v[1]).raw(",").num(v[2]).raw("]");
+        }
+
+        Json& str(const std::string& v)
+        {
+            s += '"';
+            for (const char c : v)
+            {
+                switch (c)
+                {
+                case '"':  s += "\\\""; break;
+                case '\\': s += "\\\\"; break;
+                case '\n': s += "\\n";  break;
+                case '\r': s += "\\r";  break;
+                case '\t': s += "\\t";  break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        static const char* hex = "0123456789abcdef";
+                        s += "\\u00";
+                        s += hex[(c >> 4) & 0xF];
+                        s += hex[c & 0xF];
+                    }
+                    else
+                    {
+                        s += c;
+                    }
+                }
+            }
+            s += '"';
+            return *this;
+        }
+    };
+
+    struct View
+    {
+        std::size_t offset = 0;
+        std::size_t size   = 0;
+        std::uint32_t stride = 0;   // 0 = tightly packed
+        int target = 0;
+    };
+
+    struct Accessor
+    {
+        int view = 0;
+        std::size_t byteOffset = 0;
+        int componentType = 0;
+        bool normalized = false;
+        std::size_t count = 0;
+        const char* type = "SCALAR";
+
+        bool hasBounds = false;
+        float min[3] = {};
+        float max[3] = {};
+    };
+
+    // Vorab berechnetes Layout: BufferViews/Accessors + BIN-Segmente in Dateireihenfolge.
+    // Die Segmente zeigen auf Mesh-Arrays bzw. Scratch-Puffer – kopiert wird erst beim Schreiben.
+    struct GlbPlan
+    {
+        std::vector<View> views;
+        std::vector<Accessor> accessors;
+        std::vector<Segment> bin;
+        std::size_t binSize = 0;
+
+        int addView(const void* data, std::size_t size, std::uint32_t stride, int target)
+        {
+            views.push_back({ binSize, size, stride, target });
+            bin.push_back(bytesOf(data, size));
+            binSize += size;
+
+            // jeder View beginnt 4-Byte-aligned
+            const std::size_t pad = (4 - binSize % 4) % 4;
+            if (pad)
+            {
+                bin.push_back(bytesOf(kZeros, pad));
+                binSize += pad;
+            }
+            return static_cast<int>(views.size() - 1);
+        }
+
+        int addAccessor(const Accessor& a)
+        {
+            accessors.push_back(a);
+            return static_cast<int>(accessors.size() - 1);
+        }
+    };
+
+    struct Attributes
+    {
+        int position = -1;
+        int normal   = -1;
+        int uv0      = -1;
+
+        bool quantized = false;
+        float translation[3] = {};
+        float scale = 1.0f;
+    };
+
+    static void bounds(const std::vector<Vec3>& pos, float mn[3], float mx[3])
     {
-        while (dst.size() % 4) dst.push_back(0);
+        mn[0] = mx[0] = pos[0].x; mn[1] = mx[1] = pos[0].y; mn[2] = mx[2] = pos[0].z;
+        for (const auto& p : pos)
+        {
+            mn[0] = std::min(mn[0], p.x); mn[1] = std::min(mn[1], p.y); mn[2] = std::min(mn[2], p.z);
+            mx[0] = std::max(mx[0], p.x); mx[1] = std::max(mx[1], p.y); mx[2] = std::max(mx[2], p.z);
+        }
     }
 
-    static int addView(tinygltf::Model& model, size_t offset, size_t size, int target)
+    // float-Arrays direkt aus dem Mesh (keine Kopie)
+    static Attributes planSeparate(GlbPlan& plan, const asset::normalized::NormalizedMesh& mesh)
     {
-        tinygltf::BufferView v;
-        v.buffer     = 0;
-        v.byteOffset = static_cast<int>(offset);
-        v.byteLength = static_cast<int>(size);
-        v.target     = target;
-        model.bufferViews.push_back(std::move(v));
-        return static_cast<int>(model.bufferViews.size() - 1);
+        Attributes at;
+
+        Accessor pos;
+        pos.view = plan.addView(mesh.positions.data(), mesh.positions.size() * sizeof(Vec3), 0, kTargetArray);
+        pos.componentType = kComponentFloat;
+        pos.count = mesh.positions.size();
+        pos.type = "VEC3";
+        pos.hasBounds = true;
+        bounds(mesh.positions, pos.min, pos.max);
+        at.position = plan.addAccessor(pos);
+
+        if (mesh.hasNormals())
+        {
+            Accessor a;
+            a.view = plan.addView(mesh.normals.data(), mesh.normals.size() * sizeof(Vec3), 0, kTargetArray);
+            a.componentType = kComponentFloat;
+            a.count = mesh.normals.size();
+            a.type = "VEC3";
+            at.normal = plan.addAccessor(a);
+        }
+
+        if (mesh.hasUvs0())
+        {
+            Accessor a;
+            a.view = plan.addView(mesh.uvs0.data(), mesh.uvs0.size() * sizeof(Vec2), 0, kTargetArray);
+            a.componentType = kComponentFloat;
+            a.count = mesh.uvs0.size();
+            a.type = "VEC2";
+            at.uv0 = plan.addAccessor(a);
+        }
+
+        return at;
     }
 
-    static int addAcc(tinygltf::Model& model, int view, int comp, int type, int count, int byteOffset = 0)
+    static std::int16_t quantizeSnorm16(float v)
     {
-        tinygltf::Accessor a;
-        a.bufferView    = view;
-        a.byteOffset    = byteOffset;
-        a.componentType = comp;
-        a.type          = type;
-        a.count         = count;
-        model.accessors.push_back(std::move(a));
-        return static_cast<int>(model.accessors.size() - 1);
+        v = std::clamp(v, -1.0f, 1.0f);
+        return static_cast<std::int16_t>(std::lround(v * 32767.0f));
     }
 
-    static void setMinMaxVec3(tinygltf::Accessor& acc, const std::vector<asset::normalized::Vec3>& pos)
+    // Ein interleavter Buffer: [pos int16x3 + pad][nrm int16x3 + pad][uv uint16x2 | float2]
+    static Attributes planInterleavedQuantized(GlbPlan& plan,
+                                               const asset::normalized::NormalizedMesh& mesh,
+                                               std::vector<std::uint8_t>& scratch)
     {
-        if (pos.empty())
-            return;
+        Attributes at;
+        at.quantized = true;
 
-        float minx = pos[0].x, miny = pos[0].y, minz = pos[0].z;
-        float maxx = pos[0].x, maxy = pos[0].y, maxz = pos[0].z;
+        const std::size_t count = mesh.positions.size();
+        const bool hasNormals = mesh.hasNormals();
+        const bool hasUvs = mesh.hasUvs0();
 
-        for (const auto& p : pos)
+        bool uvUnorm = hasUvs;
+        if (hasUvs)
+        {
+            for (const auto& uv : mesh.uvs0)
+            {
+                if (!(uv.x >= 0.0f && uv.x <= 1.0f && uv.y >= 0.0f && uv.y <= 1.0f))
+                {
+                    uvUnorm = false;
+                    break;
+                }
+            }
+        }
+
+        const std::uint32_t posOff = 0;
+        const std::uint32_t nrmOff = 8;
+        const std::uint32_t uvOff  = hasNormals ? 16 : 8;
+        const std::uint32_t stride = uvOff + (hasUvs ? (uvUnorm ? 4 : 8) : 0);
+
+        // Positionen: uniform skaliert um die Bounding-Box-Mitte (uniform, damit Normalen stimmen)
+        float mn[3], mx[3];
+        bounds(mesh.positions, mn, mx);
+
+        float extent = 0.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            at.translation[i] = (mn[i] + mx[i]) * 0.5f;
+            extent = std::max(extent, (mx[i] - mn[i]) * 0.5f);
+        }
+        at.scale = extent > 0.0f ? extent / 32767.0f : 1.0f;
+        const float inv = 1.0f / at.scale;
+
+        scratch.assign(count * stride, 0);
+
+        float qmn[3] = {  32767.0f,  32767.0f,  32767.0f };
+        float qmx[3] = { -32767.0f, -32767.0f, -32767.0f };
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint8_t* v = scratch.data() + i * stride;
+
+            const Vec3& p = mesh.positions[i];
+            const float src[3] = { p.x, p.y, p.z };
+            std::int16_t q[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                const long r = std::lround((src[c] - at.translation[c]) * inv);
+                q[c] = static_cast<std::int16_t>(std::clamp(r, -32767L, 32767L));
+                qmn[c] = std::min(qmn[c], float(q[c]));
+                qmx[c] = std::max(qmx[c], float(q[c]));
+            }
+            std::memcpy(v + posOff, q, sizeof(q));
+
+            if (hasNormals)
+            {
+                const Vec3& n = mesh.normals[i];
+                const std::int16_t qn[3] = { quantizeSnorm16(n.x), quantizeSnorm16(n.y), quantizeSnorm16(n.z) };
+                std::memcpy(v + nrmOff, qn, sizeof(qn));
+            }
+
+            if (hasUvs)
+            {
+                const Vec2& uv = mesh.uvs0[i];
+                if (uvUnorm)
+                {
+                    const std::uint16_t qt[2] = {
+                        static_cast<std::uint16_t>(std::lround(uv.x * 65535.0f)),
+                        static_cast<std::uint16_t>(std::lround(uv.y * 65535.0f)) };
+                    std::memcpy(v + uvOff, qt, sizeof(qt));
+                }
+                else
+                {
+                    std::memcpy(v + uvOff, &uv, sizeof(Vec2));
+                }
+            }
+        }
+
+        const int view = plan.addView(scratch.data(), scratch.size(), stride, kTargetArray);
+
+        Accessor pos;
+        pos.view = view;
+        pos.byteOffset = posOff;
+        pos.componentType = kComponentShort;
+        pos.count = count;
+        pos.type = "VEC3";
+        pos.hasBounds = true;
+        std::memcpy(pos.min, qmn, sizeof(qmn));
+        std::memcpy(pos.max, qmx, sizeof(qmx));
+        at.position = plan.addAccessor(pos);
+
+        if (hasNormals)
+        {
+            Accessor a;
+            a.view = view;
+            a.byteOffset = nrmOff;
+            a.componentType = kComponentShort;
+            a.normalized = true;
+            a.count = count;
+            a.type = "VEC3";
+            at.normal = plan.addAccessor(a);
+        }
+
+        if (hasUvs)
         {
-            minx = std::min(minx, p.x); miny = std::min(miny, p.y); minz = std::min(minz, p.z);
-            maxx = std::max(maxx, p.x); maxy = std::max(maxy, p.y); maxz = std::max(maxz, p.z);
+            Accessor a;
+            a.view = view;
+            a.byteOffset = uvOff;
+            a.componentType = uvUnorm ? kComponentUShort : kComponentFloat;
+            a.normalized = uvUnorm;
+            a.count = count;
+            a.type = "VEC2";
+            at.uv0 = plan.addAccessor(a);
         }
 
-        acc.minValues = { minx, miny, minz };
-        acc.maxValues = { maxx, maxy, maxz };
+        return at;
     }
-}
 
-namespace asset::writer
-{
-    bool ModelWriter::writeGlb(const asset::normalized::NormalizedMesh& mesh,
-                              const std::filesystem::path& outFile,
-                              std::string* outError)
+    static void putU32(std::uint8_t* dst, std::uint32_t v)
     {
-        if (mesh.positions.empty())
+        // GLB ist little endian
+        dst[0] = std::uint8_t(v);
+        dst[1] = std::uint8_t(v >> 8);
+        dst[2] = std::uint8_t(v >> 16);
+        dst[3] = std::uint8_t(v >> 24);
+    }
+
+    using asset::normalized::NormalizedPrimitive;
+    using Options = asset::writer::ModelWriter::Options;
+
+    // Ein Index-Buffer mit seinen Primitives (Basis oder LOD-Stufe)
+    struct IndexSet
+    {
+        const std::vector<std::uint32_t>* indices = nullptr;
+        const NormalizedPrimitive* prims = nullptr;
+        std::size_t primCount = 0;
+
+        int firstAccessor = 0;   // ein Index-Accessor pro Primitive
+    };
+
+    static bool makeIndexSet(IndexSet& out,
+                             const std::vector<std::uint32_t>& indices,
+                             const std::vector<NormalizedPrimitive>& prims,
+                             NormalizedPrimitive& autoPrim,
+                             std::string* outError)
+    {
+        if (!indices.empty() && (indices.size() % 3) != 0)
         {
-            if (outError) *outError = "ModelWriter: mesh.positions empty.";
+            if (outError) *outError = "ModelWriter: indices not multiple of 3.";
             return false;
         }
-        if (!mesh.indices.empty() && (mesh.indices.size() % 3) != 0)
+        if (indices.empty())
         {
-            if (outError) *outError = "ModelWriter: indices not multiple of 3.";
+            // es gibt immer mindestens ein Primitive (AutoPrim), das Indizes braucht
+            if (outError) *outError = "ModelWriter: mesh.indices missing but primitives exist.";
             return false;
         }
 
-        // If no primitives were provided, create one primitive for whole index buffer.
-        std::vector<asset::normalized::NormalizedPrimitive> prims = mesh.primitives;
-        if (prims.empty())
+        // Keine Primitives -> ein Primitive über den ganzen Index-Buffer (ohne Kopie)
+        autoPrim = {};
+        autoPrim.indexOffset  = 0;
+        autoPrim.indexCount   = static_cast<std::uint32_t>(indices.size());
+        autoPrim.materialSlot = 0;
+        autoPrim.debugName    = "AutoPrim";
+
+        out.indices = &indices;
+        out.prims = prims.empty() ? &autoPrim : prims.data();
+        out.primCount = prims.empty() ? 1 : prims.size();
+
+        for (std::size_t i = 0; i < out.primCount; ++i)
         {
-            asset::normalized::NormalizedPrimitive p;
-            p.indexOffset = 0;
-            p.indexCount  = static_cast<uint32_t>(mesh.indices.size());
-            p.materialSlot = 0;
-            p.debugName = "AutoPrim";
-            prims.push_back(std::move(p));
+            const auto& p = out.prims[i];
+            const std::uint64_t end = std::uint64_t(p.indexOffset) + std::uint64_t(p.indexCount);
+            if (end > indices.size())
+            {
+                if (outError) *outError = "ModelWriter: primitive index range out of bounds.";
+                return false;
+            }
         }
+        return true;
+    }
 
-        // material count = max(materialSlot)+1 (at least 1)
-        int maxSlot = 0;
-        for (const auto& p : prims) maxSlot = std::max(maxSlot, p.materialSlot);
-        const int materialCount = std::max(1, maxSlot + 1);
-
-        tinygltf::Model model;
-        tinygltf::Scene scene;
-        scene.name = "Scene";
+    // Index-View + Accessoren; uint16 nur, wenn jeder Index < vertexCount < 65536
+    // (65535 ist Restart-Wert und damit tabu)
+    static void planIndices(GlbPlan& plan, IndexSet& set, std::size_t vertexCount, bool narrowIndices,
+                            std::vector<std::uint16_t>& scratch)
+    {
+        const std::vector<std::uint32_t>& indices = *set.indices;
 
-        // --------------------------
-        // Buffers (positions/normals/uvs/indices)
-        // --------------------------
-        tinygltf::Buffer buffer;
-        buffer.data.reserve(1024 * 16);
+        bool narrow = narrowIndices && vertexCount < 65536;
+        if (narrow)
+        {
+            scratch.resize(indices.size());
+            for (std::size_t i = 0; i < indices.size() && narrow; ++i)
+            {
+                narrow = indices[i] < vertexCount;
+                scratch[i] = static_cast<std::uint16_t>(indices[i]);
+            }
+            if (!narrow)
+                scratch.clear();
+        }
 
-        const size_t posOff = buffer.data.size();
-        appendBytes(buffer.data, mesh.positions.data(), mesh.positions.size() * sizeof(asset::normalized::Vec3));
+        const std::size_t indexSize = narrow ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+        const int view = narrow
+            ? plan.addView(scratch.data(), scratch.size() * indexSize, 0, kTargetElements)
+            : plan.addView(indices.data(), indices.size() * indexSize, 0, kTargetElements);
 
-        size_t nrmOff = 0;
-        if (mesh.hasNormals())
+        set.firstAccessor = static_cast<int>(plan.accessors.size());
+        for (std::size_t i = 0; i < set.primCount; ++i)
         {
-            nrmOff = buffer.data.size();
-            appendBytes(buffer.data, mesh.normals.data(), mesh.normals.size() * sizeof(asset::normalized::Vec3));
+            // pro Primitive eigener Index-Accessor via byteOffset in den gemeinsamen View
+            Accessor a;
+            a.view = view;
+            a.byteOffset = std::size_t(set.prims[i].indexOffset) * indexSize;
+            a.componentType = narrow ? kComponentUShort : kComponentUInt;
+            a.count = set.prims[i].indexCount;
+            plan.addAccessor(a);
         }
+    }
 
-        size_t uvOff = 0;
-        if (mesh.hasUvs0())
+    static void jsonMesh(Json& j, const std::string& name, const Attributes& at, const IndexSet& set)
+    {
+        j.raw("{\"name\":").str(name).raw(",\"primitives\":[");
+        for (std::size_t i = 0; i < set.primCount; ++i)
         {
-            uvOff = buffer.data.size();
-            appendBytes(buffer.data, mesh.uvs0.data(), mesh.uvs0.size() * sizeof(asset::normalized::Vec2));
+            j.raw(i ? ",{" : "{")
+             .raw("\"attributes\":{\"POSITION\":").num(std::uint64_t(at.position));
+            if (at.normal >= 0) j.raw(",\"NORMAL\":").num(std::uint64_t(at.normal));
+            if (at.uv0    >= 0) j.raw(",\"TEXCOORD_0\":").num(std::uint64_t(at.uv0));
+            j.raw("},\"indices\":").num(std::uint64_t(set.firstAccessor + i))
+             .raw(",\"material\":").num(std::uint64_t(set.prims[i].materialSlot >= 0 ? set.prims[i].materialSlot : 0))
+             .raw(",\"mode\":").num(std::uint64_t(kModeTriangles))
+             .raw("}");
         }
+        j.raw("]}");
+    }
+
+    static void jsonNodeTransform(Json& j, const Attributes& at)
+    {
+        if (!at.quantized)
+            return;
+        const float scale[3] = { at.scale, at.scale, at.scale };
+        j.raw(",\"translation\":").vec3(at.translation)
+         .raw(",\"scale\":").vec3(scale);
+    }
 
-        align4(buffer.data);
+    static bool writeGlbFile(const asset::normalized::NormalizedMesh& mesh,
+                             const std::vector<std::uint32_t>& indices,
+                             const std::vector<NormalizedPrimitive>& primitives,
+                             const std::vector<asset::normalized::NormalizedLod>* lods,
+                             const std::filesystem::path& outFile,
+                             const Options& opts,
+                             std::string* outError)
+    {
+        const std::size_t lodCount = lods ? lods->size() : 0;
 
-        const size_t idxOff = buffer.data.size();
-        if (!mesh.indices.empty())
-            appendBytes(buffer.data, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+        // Basis + LOD-Stufen
+        std::vector<IndexSet> sets(1 + lodCount);
+        std::vector<NormalizedPrimitive> autoPrims(1 + lodCount);
 
-        model.buffers.push_back(std::move(buffer));
+        if (!makeIndexSet(sets[0], indices, primitives, autoPrims[0], outError))
+            return false;
+        for (std::size_t l = 0; l < lodCount; ++l)
+            if (!makeIndexSet(sets[1 + l], (*lods)[l].indices, (*lods)[l].primitives, autoPrims[1 + l], outError))
+                return false;
+
+        int maxSlot = 0;
+        for (const IndexSet& set : sets)
+            for (std::size_t i = 0; i < set.primCount; ++i)
+                maxSlot = std::max(maxSlot, set.prims[i].materialSlot);
+        const int materialCount = std::max(1, maxSlot + 1);
 
         // --------------------------
-        // BufferViews
+        // Layout: Vertex-Views (gemeinsam für alle Stufen), dann Index-Views
         // --------------------------
-        const int posView = addView(model, posOff, mesh.positions.size() * sizeof(asset::normalized::Vec3),
-                                    TINYGLTF_TARGET_ARRAY_BUFFER);
-
-        int nrmView = -1;
-        if (mesh.hasNormals())
-            nrmView = addView(model, nrmOff, mesh.normals.size() * sizeof(asset::normalized::Vec3),
-                              TINYGLTF_TARGET_ARRAY_BUFFER);
+        GlbPlan plan;
+        std::vector<std::uint8_t> vertexScratch;
+        std::vector<std::vector<std::uint16_t>> indexScratch(sets.size());
 
-        int uvView = -1;
-        if (mesh.hasUvs0())
-            uvView = addView(model, uvOff, mesh.uvs0.size() * sizeof(asset::normalized::Vec2),
-                             TINYGLTF_TARGET_ARRAY_BUFFER);
+        const Attributes at = (opts.vertexMode == asset::writer::ModelWriter::VertexMode::InterleavedQuantized)
+            ? planInterleavedQuantized(plan, mesh, vertexScratch)
+            : planSeparate(plan, mesh);
 
-        int idxView = -1;
-        if (!mesh.indices.empty())
-            idxView = addView(model, idxOff, mesh.indices.size() * sizeof(uint32_t),
-                              TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+        for (std::size_t s = 0; s < sets.size(); ++s)
+            planIndices(plan, sets[s], mesh.positions.size(), opts.narrowIndices, indexScratch[s]);
 
         // --------------------------
-        // Accessors (shared attrib)
+        // JSON
         // --------------------------
-        const int posAcc = addAcc(model, posView,
-                                  TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3,
-                                  static_cast<int>(mesh.positions.size()));
-        setMinMaxVec3(model.accessors[posAcc], mesh.positions);
+        Json j;
+        j.s.reserve(1024 + (1 + lodCount) * 256);
 
-        int nrmAcc = -1;
-        if (mesh.hasNormals())
+        j.raw("{\"asset\":{\"version\":\"2.0\",\"generator\":\"FlyFF_Framework\"}");
+        if (at.quantized || lodCount)
         {
-            nrmAcc = addAcc(model, nrmView,
-                            TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3,
-                            static_cast<int>(mesh.normals.size()));
+            j.raw(",\"extensionsUsed\":[");
+            if (at.quantized) j.raw("\"KHR_mesh_quantization\"");
+            if (lodCount)     j.raw(at.quantized ? ",\"MSFT_lod\"" : "\"MSFT_lod\"");
+            j.raw("]");
         }
+        if (at.quantized)
+            j.raw(",\"extensionsRequired\":[\"KHR_mesh_quantization\"]");
 
-        int uvAcc = -1;
-        if (mesh.hasUvs0())
+        j.raw(",\"scene\":0,\"scenes\":[{\"name\":\"Scene\",\"nodes\":[0]}]");
+
+        // Node 0 = Basis; MSFT_lod verweist auf Nodes 1..n (nicht Teil der Szene)
+        j.raw(",\"nodes\":[{\"name\":\"Node\",\"mesh\":0");
+        jsonNodeTransform(j, at);
+        if (lodCount)
         {
-            uvAcc = addAcc(model, uvView,
-                           TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC2,
-                           static_cast<int>(mesh.uvs0.size()));
+            j.raw(",\"extensions\":{\"MSFT_lod\":{\"ids\":[");
+            for (std::size_t l = 0; l < lodCount; ++l)
+                j.raw(l ? "," : "").num(std::uint64_t(1 + l));
+            j.raw("]}}");
+
+            // Schwellen: Stufe k ab halbem Dreiecksanteil der nächsten Stufe, letzte bis 0
+            j.raw(",\"extras\":{\"MSFT_screencoverage\":[");
+            for (std::size_t k = 0; k <= lodCount; ++k)
+            {
+                const float coverage = (k < lodCount) ? 0.5f * (*lods)[k].triangleRatio : 0.0f;
+                j.raw(k ? "," : "").num(coverage);
+            }
+            j.raw("]}");
         }
+        j.raw("}");
+        for (std::size_t l = 0; l < lodCount; ++l)
+        {
+            j.raw(",{\"name\":\"Node_LOD").num(std::uint64_t(1 + l))
+             .raw("\",\"mesh\":").num(std::uint64_t(1 + l));
+            jsonNodeTransform(j, at);
+            j.raw("}");
+        }
+        j.raw("]");
+
+        const std::string meshName = mesh.name.empty() ? std::string("Mesh") : mesh.name;
+        j.raw(",\"meshes\":[");
+        jsonMesh(j, meshName, at, sets[0]);
+        for (std::size_t l = 0; l < lodCount; ++l)
+        {
+            j.raw(",");
+            jsonMesh(j, meshName + "_LOD" + std::to_string(1 + l), at, sets[1 + l]);
+        }
+        j.raw("]");
 
-        // --------------------------
         // Materials (placeholder – textures später)
-        // --------------------------
-        model.materials.reserve(materialCount);
+        j.raw(",\"materials\":[");
         for (int i = 0; i < materialCount; ++i)
         {
-            tinygltf::Material m;
-            m.name = "Mat_" + std::to_string(i);
-            m.pbrMetallicRoughness.baseColorFactor = {1.0, 1.0, 1.0, 1.0};
-            m.pbrMetallicRoughness.metallicFactor  = 0.0;
-            m.pbrMetallicRoughness.roughnessFactor = 1.0;
-            model.materials.push_back(std::move(m));
+            j.raw(i ? ",{" : "{")
+             .raw("\"name\":\"Mat_").num(std::uint64_t(i))
+             .raw("\",\"pbrMetallicRoughness\":{\"baseColorFactor\":[1,1,1,1],\"metallicFactor\":0,\"roughnessFactor\":1}}");
         }
+        j.raw("]");
 
-        // --------------------------
-        // Mesh + Primitives (per primitive: own index accessor via byteOffset)
-        // --------------------------
-        tinygltf::Mesh gltfMesh;
-        gltfMesh.name = mesh.name.empty() ? "Mesh" : mesh.name;
-
-        for (const auto& p : prims)
+        j.raw(",\"accessors\":[");
+        for (std::size_t i = 0; i < plan.accessors.size(); ++i)
         {
-            if (idxView < 0 || mesh.indices.empty())
-            {
-                if (outError) *outError = "ModelWriter: mesh.indices missing but primitives exist.";
-                return false;
-            }
-
-            // validate range
-            const uint64_t end = uint64_t(p.indexOffset) + uint64_t(p.indexCount);
-            if (end > mesh.indices.size())
-            {
-                if (outError) *outError = "ModelWriter: primitive index range out of bounds.";
-                return false;
-            }
-
-            const int idxAcc = addAcc(model, idxView,
-                                      TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT, TINYGLTF_TYPE_SCALAR,
-                                      static_cast<int>(p.indexCount),
-                                      static_cast<int>(p.indexOffset * sizeof(uint32_t)));
+            const Accessor& a = plan.accessors[i];
+            j.raw(i ? ",{" : "{")
+             .raw("\"bufferView\":").num(std::uint64_t(a.view));
+            if (a.byteOffset)
+                j.raw(",\"byteOffset\":").num(std::uint64_t(a.byteOffset));
+            j.raw(",\"componentType\":").num(std::uint64_t(a.componentType));
+            if (a.normalized)
+                j.raw(",\"normalized\":true");
+            j.raw(",\"count\":").num(std::uint64_t(a.count))
+             .raw(",\"type\":\"").raw(a.type).raw("\"");
+            if (a.hasBounds)
+                j.raw(",\"min\":").vec3(a.min).raw(",\"max\":").vec3(a.max);
+            j.raw("}");
+        }
+        j.raw("]");
 
-            tinygltf::Primitive prim;
-            prim.mode     = TINYGLTF_MODE_TRIANGLES;
-            prim.indices  = idxAcc;
-            prim.material = (p.materialSlot >= 0) ? p.materialSlot : 0;
+        j.raw(",\"bufferViews\":[");
+        for (std::size_t i = 0; i < plan.views.size(); ++i)
+        {
+            const View& v = plan.views[i];
+            j.raw(i ? ",{" : "{")
+             .raw("\"buffer\":0,\"byteOffset\":").num(std::uint64_t(v.offset))
+             .raw(",\"byteLength\":").num(std::uint64_t(v.size));
+            if (v.stride)
+                j.raw(",\"byteStride\":").num(std::uint64_t(v.stride));
+            j.raw(",\"target\":").num(std::uint64_t(v.target))
+             .raw("}");
+        }
+        j.raw("]");
 
-            prim.attributes["POSITION"] = posAcc;
-            if (nrmAcc >= 0) prim.attributes["NORMAL"] = nrmAcc;
-            if (uvAcc  >= 0) prim.attributes["TEXCOORD_0"] = uvAcc;
+        j.raw(",\"buffers\":[{\"byteLength\":").num(std::uint64_t(plan.binSize)).raw("}]}");
 
-            gltfMesh.primitives.push_back(std::move(prim));
+        if (!j.finite)
+        {
+            if (outError) *outError = "ModelWriter: non-finite value in glTF JSON (accessor bounds or node transform).";
+            return false;
         }
 
-        model.meshes.push_back(std::move(gltfMesh));
+        // JSON mit Leerzeichen auffüllen (BIN ist durch addView bereits 4-Byte-aligned)
+        while (j.s.size() % 4) j.s += ' ';
 
-        // Node + Scene
-        tinygltf::Node node;
-        node.name = "Node";
-        node.mesh = 0;
-        model.nodes.push_back(std::move(node));
+        const std::uint64_t total = 12 + 8 + j.s.size() + 8 + plan.binSize;
+        if (total > 0xFFFFFFFFull)
+        {
+            if (outError) *outError = "ModelWriter: GLB exceeds 4 GiB.";
+            return false;
+        }
 
-        scene.nodes.push_back(0);
-        model.scenes.push_back(std::move(scene));
-        model.defaultScene = 0;
+        std::uint8_t head[20];   // GLB-Header + JSON-Chunk-Header
+        putU32(head + 0,  kGlbMagic);
+        putU32(head + 4,  kGlbVersion);
+        putU32(head + 8,  static_cast<std::uint32_t>(total));
+        putU32(head + 12, static_cast<std::uint32_t>(j.s.size()));
+        putU32(head + 16, kChunkJson);
 
-        // Write
-        tinygltf::TinyGLTF gltf;
-        std::string err, warn;
-        const bool ok = gltf.WriteGltfSceneToFile(
-            &model,
-            outFile.string(),
-            /*embedImages*/ true,
-            /*embedBuffers*/ true,
-            /*prettyPrint*/ false,
-            /*writeBinary*/ true
-        );
+        std::uint8_t binHead[8];
+        putU32(binHead + 0, static_cast<std::uint32_t>(plan.binSize));
+        putU32(binHead + 4, kChunkBin);
 
-        if (!warn.empty())
+        // --------------------------
+        // Scatter-Gather: Header | JSON | BIN-Header | BIN-Segmente
+        // --------------------------
+        std::vector<Segment> seg;
+        seg.reserve(3 + plan.bin.size());
+        seg.push_back(bytesOf(head, sizeof(head)));
+        seg.push_back(bytesOf(j.s.data(), j.s.size()));
+        seg.push_back(bytesOf(binHead, sizeof(binHead)));
+        seg.insert(seg.end(), plan.bin.begin(), plan.bin.end());
+
+        std::string ioErr;
+        if (!asset::io::GatherWriter::write(outFile, seg, &ioErr))
         {
-            // optional: warning in error string
+            if (outError) *outError = "ModelWriter: " + ioErr;
+            return false;
         }
-        if (!ok)
+
+        return true;
+    }
+}
+
+namespace asset::writer
+{
+    bool ModelWriter::writeGlb(const asset::normalized::NormalizedMesh& mesh,
+                              const std::filesystem::path& outFile,
+                              std::string* outError)
+    {
+        return writeGlb(mesh, outFile, Options{}, outError);
+    }
+
+    bool ModelWriter::writeGlb(const asset::normalized::NormalizedMesh& mesh,
+                              const std::filesystem::path& outFile,
+                              const Options& opts,
+                              std::string* outError)
+    {
+        if (mesh.positions.empty())
         {
-            if (outError)
-                *outError = "ModelWriter: WriteGltfSceneToFile failed. err=" + err + " warn=" + warn;
+            if (outError) *outError = "ModelWriter: mesh.positions empty.";
             return false;
         }
-        if (!err.empty())
+
+        // NaN fällt durch std::min/max in bounds() und wäre in JSON/Quantisierung ungültig
+        for (const auto& p : mesh.positions)
         {
-            // tinygltf may still write but report non-fatal err; treat as failure if you want
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z))
+            {
+                if (outError) *outError = "ModelWriter: non-finite vertex position.";
+                return false;
+            }
         }
 
+        const bool hasLods = !mesh.lods.empty() && opts.lodOutput != LodOutput::None;
+
+        if (!hasLods || opts.lodOutput == LodOutput::MsftLod)
+            return writeGlbFile(mesh, mesh.indices, mesh.primitives, hasLods ? &mesh.lods : nullptr,
+                                outFile, opts, outError);
+
+        // SiblingFiles: jede Stufe als eigenständiges GLB (Vertex-Arrays des Basis-Meshes)
+        if (!writeGlbFile(mesh, mesh.indices, mesh.primitives, nullptr, outFile, opts, outError))
+            return false;
+
+        for (std::size_t l = 0; l < mesh.lods.size(); ++l)
+        {
+            std::filesystem::path lodFile = outFile;
+            lodFile.replace_filename(outFile.stem().string() + "_lod" + std::to_string(l + 1) + outFile.extension().string());
+
+            if (!writeGlbFile(mesh, mesh.lods[l].indices, mesh.lods[l].primitives, nullptr, lodFile, opts, outError))
+                return false;
+        }
         return true;
     }
 }
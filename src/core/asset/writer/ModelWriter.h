@@ -7,12 +7,52 @@
 
 namespace asset::writer
 {
+    // Eigener GLB-Writer (glTF 2.0 binary), ohne tinygltf::Model als Zwischenstufe.
+    // Das Buffer-Layout wird vorab berechnet; JSON-Chunk und BIN-Chunk gehen per
+    // Scatter-Gather direkt aus den NormalizedMesh-Arrays in die Datei.
     class ModelWriter
     {
     public:
+        enum class VertexMode
+        {
+            // je Attribut ein float-Accessor (verlustfrei, keine Kopie)
+            Separate,
+
+            // ein interleavter Vertex-Buffer mit KHR_mesh_quantization:
+            // Position int16 (Dequantisierung über Node-Translation/-Scale),
+            // Normalen int16 normalisiert, UVs uint16 normalisiert – UVs
+            // außerhalb [0,1] (Tiling) bleiben float
+            InterleavedQuantized
+        };
+
+        // Ausgabe von NormalizedMesh::lods
+        enum class LodOutput
+        {
+            None,          // nur das Basis-Mesh
+            MsftLod,       // eine Datei: Nodes mit MSFT_lod + MSFT_screencoverage, gemeinsamer Vertex-Buffer
+            SiblingFiles   // <name>_lod1.glb, <name>_lod2.glb, ... neben der Basisdatei
+        };
+
+        struct Options
+        {
+            VertexMode vertexMode = VertexMode::Separate;
+
+            // uint16-Indizes, wenn alle Vertices in 16 Bit adressierbar sind
+            bool narrowIndices = false;
+
+            LodOutput lodOutput = LodOutput::MsftLod;
+        };
+
+        static bool writeGlb(
+            const asset::normalized::NormalizedMesh& mesh,
+            const std::filesystem::path& outFile,
+            std::string* outError = nullptr
+        );
+
         static bool writeGlb(
             const asset::normalized::NormalizedMesh& mesh,
             const std::filesystem::path& outFile,
+            const Options& opts,
             std::string* outError = nullptr
         );
     };
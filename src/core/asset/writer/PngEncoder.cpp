@@ -0,0 +1,925 @@
+#include "core/asset/writer/PngEncoder.h"
+
+#include "core/TaskSystem.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    // ------------------------------------------------------------
+    // CRC-32 (PNG-Chunks) / Adler-32 (zlib)
+    // ------------------------------------------------------------
+    const std::array<std::uint32_t, 256>& crcTable()
+    {
+        static const std::array<std::uint32_t, 256> table = []
+        {
+            std::array<std::uint32_t, 256> t{};
+            for (std::uint32_t n = 0; n < 256; ++n)
+            {
+                std::uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                t[n] = c;
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    std::uint32_t crc32Update(std::uint32_t crc, const std::uint8_t* p, std::size_t n)
+    {
+        const auto& t = crcTable();
+        crc = ~crc;
+        for (std::size_t i = 0; i < n; ++i)
+            crc = t[(crc ^ p[i]) & 0xFFu] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    constexpr std::uint32_t kAdlerBase = 65521u;
+
+    std::uint32_t adler32(const std::uint8_t* p, std::size_t n)
+    {
+        std::uint32_t a = 1, b = 0;
+        while (n > 0)
+        {
+            // 5552: größter Block ohne Überlauf von b vor dem Modulo
+            const std::size_t blk = std::min<std::size_t>(n, 5552);
+            for (std::size_t i = 0; i < blk; ++i)
+            {
+                a += p[i];
+                b += a;
+            }
+            a %= kAdlerBase;
+            b %= kAdlerBase;
+            p += blk;
+            n -= blk;
+        }
+        return (b << 16) | a;
+    }
+
+    // Adler-32 von A||B aus adler(A), adler(B) und len(B) (wie zlib adler32_combine)
+    std::uint32_t adler32Combine(std::uint32_t a1, std::uint32_t a2, std::size_t len2)
+    {
+        const std::uint32_t rem = (std::uint32_t)(len2 % kAdlerBase);
+        std::uint32_t sum1 = a1 & 0xFFFFu;
+        std::uint32_t sum2 = (std::uint32_t)(((std::uint64_t)rem * sum1) % kAdlerBase);
+        sum1 += (a2 & 0xFFFFu) + kAdlerBase - 1;
+        sum2 += (a1 >> 16) + (a2 >> 16) + kAdlerBase - rem;
+        if (sum1 >= kAdlerBase) sum1 -= kAdlerBase;
+        if (sum1 >= kAdlerBase) sum1 -= kAdlerBase;
+        if (sum2 >= (kAdlerBase << 1)) sum2 -= (kAdlerBase << 1);
+        if (sum2 >= kAdlerBase) sum2 -= kAdlerBase;
+        return sum1 | (sum2 << 16);
+    }
+
+    // ------------------------------------------------------------
+    // Bit-Ausgabe (LSB zuerst, wie Deflate)
+    // ------------------------------------------------------------
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(std::vector<std::uint8_t>& out) : m_out(out) {}
+
+        void put(std::uint32_t bits, int count)
+        {
+            m_acc |= (std::uint64_t)bits << m_count;
+            m_count += count;
+            while (m_count >= 8)
+            {
+                m_out.push_back((std::uint8_t)m_acc);
+                m_acc >>= 8;
+                m_count -= 8;
+            }
+        }
+
+        void alignToByte()
+        {
+            if (m_count > 0)
+                put(0, 8 - m_count);
+        }
+
+        void putBytes(const std::uint8_t* p, std::size_t n)
+        {
+            // nur nach alignToByte()
+            m_out.insert(m_out.end(), p, p + n);
+        }
+
+    private:
+        std::vector<std::uint8_t>& m_out;
+        std::uint64_t m_acc = 0;
+        int m_count = 0;
+    };
+
+    // ------------------------------------------------------------
+    // Deflate-Tabellen
+    // ------------------------------------------------------------
+    constexpr std::uint16_t kLenBase[29] =
+    {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    constexpr std::uint8_t kLenExtra[29] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    constexpr std::uint16_t kDistBase[30] =
+    {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+    };
+    constexpr std::uint8_t kDistExtra[30] =
+    {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+    constexpr std::uint8_t kCodeLengthOrder[19] =
+    {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+    };
+
+    constexpr int kMinMatch = 3;
+    constexpr int kMaxMatch = 258;
+    constexpr int kWindowSize = 32768;
+    constexpr int kHashBits = 15;
+
+    // Match-Länge (3..258) -> Index in kLenBase
+    const std::array<std::uint8_t, 259>& lengthCodeTable()
+    {
+        static const std::array<std::uint8_t, 259> table = []
+        {
+            std::array<std::uint8_t, 259> t{};
+            for (int code = 0; code < 29; ++code)
+            {
+                const int end = (code == 28) ? 259 : kLenBase[code + 1];
+                for (int len = kLenBase[code]; len < end && len <= 258; ++len)
+                    t[len] = (std::uint8_t)code;
+            }
+            t[258] = 28;
+            return t;
+        }();
+        return table;
+    }
+
+    int distanceCode(int dist)
+    {
+        return (int)(std::upper_bound(std::begin(kDistBase), std::end(kDistBase), (std::uint16_t)dist) - std::begin(kDistBase)) - 1;
+    }
+
+    std::uint32_t reverseBits(std::uint32_t code, int len)
+    {
+        std::uint32_t r = 0;
+        for (int i = 0; i < len; ++i)
+        {
+            r = (r << 1) | (code & 1u);
+            code >>= 1;
+        }
+        return r;
+    }
+
+    // Huffman-Längen mit Längenlimit. Bei Überlauf werden die Häufigkeiten
+    // halbiert (bleiben > 0) und neu gebaut - einfach und für PNG ausreichend.
+    void buildCodeLengths(const std::uint32_t* freq, int n, int maxBits, std::uint8_t* lens)
+    {
+        std::fill(lens, lens + n, (std::uint8_t)0);
+
+        std::vector<std::uint32_t> f(freq, freq + n);
+
+        for (;;)
+        {
+            std::vector<int> syms;
+            for (int i = 0; i < n; ++i)
+                if (f[i] > 0)
+                    syms.push_back(i);
+
+            if (syms.empty())
+                return;
+
+            if (syms.size() == 1)
+            {
+                lens[syms[0]] = 1;
+                return;
+            }
+
+            std::stable_sort(syms.begin(), syms.end(), [&](int a, int b) { return f[a] < f[b]; });
+
+            // Zwei-Queue-Verfahren: Blätter sortiert, innere Knoten entstehen sortiert
+            const int leafCount = (int)syms.size();
+            std::vector<std::uint64_t> weight(2 * leafCount - 1);
+            std::vector<int> parent(2 * leafCount - 1, -1);
+
+            for (int i = 0; i < leafCount; ++i)
+                weight[i] = f[syms[i]];
+
+            int nextLeaf = 0;
+            int nextInner = leafCount;
+            int innerEnd = leafCount;
+
+            auto takeMin = [&]() -> int
+            {
+                if (nextLeaf < leafCount && (nextInner >= innerEnd || weight[nextLeaf] <= weight[nextInner]))
+                    return nextLeaf++;
+                return nextInner++;
+            };
+
+            for (int k = 0; k < leafCount - 1; ++k)
+            {
+                const int a = takeMin();
+                const int b = takeMin();
+                weight[innerEnd] = weight[a] + weight[b];
+                parent[a] = innerEnd;
+                parent[b] = innerEnd;
+                ++innerEnd;
+            }
+
+            // Tiefen: Wurzel ist der letzte innere Knoten, Eltern haben höhere Indizes
+            std::vector<int> depth(2 * leafCount - 1, 0);
+            int maxDepth = 0;
+            for (int i = innerEnd - 2; i >= 0; --i)
+            {
+                depth[i] = depth[parent[i]] + 1;
+                if (i < leafCount)
+                    maxDepth = std::max(maxDepth, depth[i]);
+            }
+
+            if (maxDepth <= maxBits)
+            {
+                for (int i = 0; i < leafCount; ++i)
+                    lens[syms[i]] = (std::uint8_t)depth[i];
+                return;
+            }
+
+            for (auto& v : f)
+                if (v > 0)
+                    v = (v >> 1) | 1u;
+        }
+    }
+
+    // Kanonische Codes (bereits bitgespiegelt für LSB-first)
+    void buildCodes(const std::uint8_t* lens, int n, std::uint32_t* codes)
+    {
+        int blCount[16] = {};
+        for (int i = 0; i < n; ++i)
+            blCount[lens[i]]++;
+        blCount[0] = 0;
+
+        std::uint32_t nextCode[16] = {};
+        std::uint32_t code = 0;
+        for (int bits = 1; bits < 16; ++bits)
+        {
+            code = (code + blCount[bits - 1]) << 1;
+            nextCode[bits] = code;
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            const int len = lens[i];
+            codes[i] = len ? reverseBits(nextCode[len]++, len) : 0;
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Deflate (ein Block-Bereich, unabhängig von anderen Bereichen)
+    // ------------------------------------------------------------
+    struct Token
+    {
+        std::uint16_t litLen; // Literal (dist == 0) oder Match-Länge
+        std::uint16_t dist;
+    };
+
+    struct DeflateScratch
+    {
+        std::vector<std::int32_t> head;
+        std::vector<std::int32_t> prev;
+        std::vector<Token> tokens;
+    };
+
+    constexpr std::size_t kMaxTokensPerBlock = 1u << 15;
+
+    void writeStored(BitWriter& bw, const std::uint8_t* p, std::size_t n, bool final)
+    {
+        do
+        {
+            const std::size_t len = std::min<std::size_t>(n, 65535u);
+            const bool last = final && (len == n);
+
+            bw.put(last ? 1u : 0u, 1);
+            bw.put(0, 2);
+            bw.alignToByte();
+
+            const std::uint8_t hdr[4] =
+            {
+                (std::uint8_t)len, (std::uint8_t)(len >> 8),
+                (std::uint8_t)~len, (std::uint8_t)(~len >> 8)
+            };
+            bw.putBytes(hdr, 4);
+            bw.putBytes(p, len);
+
+            p += len;
+            n -= len;
+        } while (n > 0);
+    }
+
+    // Ein Block mit dynamischen Huffman-Codes; fällt auf stored zurück,
+    // wenn das kleiner ist (z.B. Rauschen).
+    void writeBlock(BitWriter& bw,
+                    const std::vector<Token>& toks,
+                    const std::uint8_t* src, std::size_t srcLen,
+                    bool final)
+    {
+        const auto& lenCode = lengthCodeTable();
+
+        std::uint32_t litFreq[286] = {};
+        std::uint32_t distFreq[30] = {};
+
+        for (const Token& t : toks)
+        {
+            if (t.dist == 0)
+            {
+                litFreq[t.litLen]++;
+            }
+            else
+            {
+                litFreq[257 + lenCode[t.litLen]]++;
+                distFreq[distanceCode(t.dist)]++;
+            }
+        }
+        litFreq[256] = 1;
+
+        bool anyDist = false;
+        for (std::uint32_t v : distFreq)
+            anyDist |= (v != 0);
+        if (!anyDist)
+            distFreq[0] = 1;
+
+        std::uint8_t litLens[286];
+        std::uint8_t distLens[30];
+        buildCodeLengths(litFreq, 286, 15, litLens);
+        buildCodeLengths(distFreq, 30, 15, distLens);
+
+        int hlit = 286;
+        while (hlit > 257 && litLens[hlit - 1] == 0) --hlit;
+        int hdist = 30;
+        while (hdist > 1 && distLens[hdist - 1] == 0) --hdist;
+
+        // Code-Längen lauflängenkodieren (16/17/18)
+        std::uint8_t all[286 + 30];
+        std::memcpy(all, litLens, (std::size_t)hlit);
+        std::memcpy(all + hlit, distLens, (std::size_t)hdist);
+        const int total = hlit + hdist;
+
+        struct ClSym { std::uint8_t sym; std::uint8_t extra; };
+        std::vector<ClSym> cl;
+        cl.reserve((std::size_t)total);
+
+        for (int i = 0; i < total;)
+        {
+            const std::uint8_t v = all[i];
+            int run = 1;
+            while (i + run < total && all[i + run] == v)
+                ++run;
+
+            if (v == 0 && run >= 3)
+            {
+                int r = run;
+                while (r >= 11) { const int n = std::min(r, 138); cl.push_back({ 18, (std::uint8_t)(n - 11) }); r -= n; }
+                if (r >= 3)     { cl.push_back({ 17, (std::uint8_t)(r - 3) }); r = 0; }
+                while (r-- > 0)   cl.push_back({ 0, 0 });
+            }
+            else if (v != 0 && run >= 4)
+            {
+                cl.push_back({ v, 0 });
+                int r = run - 1;
+                while (r >= 3) { const int n = std::min(r, 6); cl.push_back({ 16, (std::uint8_t)(n - 3) }); r -= n; }
+                while (r-- > 0)  cl.push_back({ v, 0 });
+            }
+            else
+            {
+                for (int k = 0; k < run; ++k)
+                    cl.push_back({ v, 0 });
+            }
+            i += run;
+        }
+
+        std::uint32_t clFreq[19] = {};
+        for (const ClSym& c : cl)
+            clFreq[c.sym]++;
+
+        std::uint8_t clLens[19];
+        buildCodeLengths(clFreq, 19, 7, clLens);
+
+        int hclen = 19;
+        while (hclen > 4 && clLens[kCodeLengthOrder[hclen - 1]] == 0) --hclen;
+
+        // Größe schätzen und gegen stored vergleichen
+        std::uint64_t bits = 3 + 5 + 5 + 4 + (std::uint64_t)hclen * 3;
+        for (const ClSym& c : cl)
+            bits += clLens[c.sym] + (c.sym == 16 ? 2 : c.sym == 17 ? 3 : c.sym == 18 ? 7 : 0);
+        for (int s = 0; s < 286; ++s)
+            bits += (std::uint64_t)litFreq[s] * litLens[s];
+        for (int s = 0; s < 30; ++s)
+            bits += (std::uint64_t)distFreq[s] * distLens[s];
+        for (int c = 0; c < 29; ++c)
+            bits += (std::uint64_t)litFreq[257 + c] * kLenExtra[c];
+        for (int c = 0; c < 30; ++c)
+            bits += (std::uint64_t)distFreq[c] * kDistExtra[c];
+
+        const std::uint64_t storedBits = ((std::uint64_t)srcLen + 5u * (srcLen / 65535u + 1u)) * 8u;
+        if (storedBits < bits)
+        {
+            writeStored(bw, src, srcLen, final);
+            return;
+        }
+
+        std::uint32_t litCodes[286], distCodes[30], clCodes[19];
+        buildCodes(litLens, 286, litCodes);
+        buildCodes(distLens, 30, distCodes);
+        buildCodes(clLens, 19, clCodes);
+
+        bw.put(final ? 1u : 0u, 1);
+        bw.put(2, 2); // BTYPE = dynamic
+        bw.put((std::uint32_t)(hlit - 257), 5);
+        bw.put((std::uint32_t)(hdist - 1), 5);
+        bw.put((std::uint32_t)(hclen - 4), 4);
+        for (int i = 0; i < hclen; ++i)
+            bw.put(clLens[kCodeLengthOrder[i]], 3);
+
+        for (const ClSym& c : cl)
+        {
+            bw.put(clCodes[c.sym], clLens[c.sym]);
+            if (c.sym == 16) bw.put(c.extra, 2);
+            else if (c.sym == 17) bw.put(c.extra, 3);
+            else if (c.sym == 18) bw.put(c.extra, 7);
+        }
+
+        for (const Token& t : toks)
+        {
+            if (t.dist == 0)
+            {
+                bw.put(litCodes[t.litLen], litLens[t.litLen]);
+                continue;
+            }
+
+            const int lc = lenCode[t.litLen];
+            bw.put(litCodes[257 + lc], litLens[257 + lc]);
+            if (kLenExtra[lc])
+                bw.put((std::uint32_t)(t.litLen - kLenBase[lc]), kLenExtra[lc]);
+
+            const int dc = distanceCode(t.dist);
+            bw.put(distCodes[dc], distLens[dc]);
+            if (kDistExtra[dc])
+                bw.put((std::uint32_t)(t.dist - kDistBase[dc]), kDistExtra[dc]);
+        }
+
+        bw.put(litCodes[256], litLens[256]);
+    }
+
+    inline std::uint32_t hash3(const std::uint8_t* p)
+    {
+        const std::uint32_t v = (std::uint32_t)p[0] | ((std::uint32_t)p[1] << 8) | ((std::uint32_t)p[2] << 16);
+        return (v * 2654435761u) >> (32 - kHashBits);
+    }
+
+    inline int matchLength(const std::uint8_t* a, const std::uint8_t* b, int maxLen)
+    {
+        int len = 0;
+        while (len < maxLen && a[len] == b[len])
+            ++len;
+        return len;
+    }
+
+    // Komprimiert [p, p+n) als eigenständige Block-Folge. Nicht-finale
+    // Bereiche enden mit einem leeren stored block (byte-aligned), damit
+    // die Bereiche direkt hintereinandergehängt werden können.
+    void deflateRange(std::vector<std::uint8_t>& out,
+                      const std::uint8_t* p, std::size_t n,
+                      asset::PngEncoder::Level level,
+                      int bytesPerPixel,
+                      bool final)
+    {
+        using Level = asset::PngEncoder::Level;
+
+        out.clear();
+        BitWriter bw(out);
+
+        if (level == Level::Store)
+        {
+            writeStored(bw, p, n, final);
+            bw.alignToByte();
+            return;
+        }
+
+        thread_local DeflateScratch s;
+        s.tokens.clear();
+        s.tokens.reserve(kMaxTokensPerBlock);
+
+        const bool rleOnly = (level == Level::Fast);
+        const int maxChain = (level == Level::Best) ? 256 : 32;
+        const int niceLength = (level == Level::Best) ? kMaxMatch : 128;
+
+        if (!rleOnly)
+        {
+            s.head.assign((std::size_t)1 << kHashBits, -1);
+            s.prev.resize(kWindowSize);
+        }
+
+        auto insert = [&](std::size_t pos)
+        {
+            const std::uint32_t h = hash3(p + pos);
+            s.prev[pos & (kWindowSize - 1)] = s.head[h];
+            s.head[h] = (std::int32_t)pos;
+        };
+
+        std::size_t blockStart = 0;
+        std::size_t pos = 0;
+
+        while (pos < n)
+        {
+            const int maxLen = (int)std::min<std::size_t>(kMaxMatch, n - pos);
+            int bestLen = 0;
+            int bestDist = 0;
+
+            if (maxLen >= kMinMatch)
+            {
+                if (rleOnly)
+                {
+                    // Pixel- und Byte-Wiederholungen (Distanz bpp bzw. 1)
+                    const int dists[2] = { bytesPerPixel, 1 };
+                    for (int d : dists)
+                    {
+                        if ((std::size_t)d > pos)
+                            continue;
+                        const int len = matchLength(p + pos, p + pos - d, maxLen);
+                        if (len > bestLen)
+                        {
+                            bestLen = len;
+                            bestDist = d;
+                        }
+                    }
+                }
+                else
+                {
+                    std::int32_t cand = s.head[hash3(p + pos)];
+                    int chain = maxChain;
+
+                    while (cand >= 0 && chain-- > 0)
+                    {
+                        const std::size_t dist = pos - (std::size_t)cand;
+                        if (dist > (std::size_t)kWindowSize)
+                            break;
+
+                        if (p[cand + bestLen] == p[pos + bestLen])
+                        {
+                            const int len = matchLength(p + pos, p + cand, maxLen);
+                            if (len > bestLen)
+                            {
+                                bestLen = len;
+                                bestDist = (int)dist;
+                                if (len >= niceLength || len == maxLen)
+                                    break;
+                            }
+                        }
+
+                        const std::int32_t next = s.prev[(std::size_t)cand & (kWindowSize - 1)];
+                        if (next >= cand)
+                            break; // Slot wurde von einer neueren Position überschrieben
+                        cand = next;
+                    }
+                }
+            }
+
+            if (bestLen >= kMinMatch)
+            {
+                s.tokens.push_back({ (std::uint16_t)bestLen, (std::uint16_t)bestDist });
+
+                if (!rleOnly)
+                {
+                    const std::size_t end = std::min(pos + (std::size_t)bestLen, n - 2);
+                    for (std::size_t k = pos; k < end; ++k)
+                        insert(k);
+                }
+                pos += (std::size_t)bestLen;
+            }
+            else
+            {
+                s.tokens.push_back({ p[pos], 0 });
+                if (!rleOnly && pos + 2 < n)
+                    insert(pos);
+                ++pos;
+            }
+
+            if (s.tokens.size() >= kMaxTokensPerBlock && pos < n)
+            {
+                writeBlock(bw, s.tokens, p + blockStart, pos - blockStart, false);
+                s.tokens.clear();
+                blockStart = pos;
+            }
+        }
+
+        writeBlock(bw, s.tokens, p + blockStart, pos - blockStart, final);
+
+        if (!final)
+        {
+            // Sync-Flush: leerer stored block -> byte-aligned
+            bw.put(0, 1);
+            bw.put(0, 2);
+            bw.alignToByte();
+            const std::uint8_t empty[4] = { 0x00, 0x00, 0xFF, 0xFF };
+            bw.putBytes(empty, 4);
+        }
+        else
+        {
+            bw.alignToByte();
+        }
+    }
+
+    // ------------------------------------------------------------
+    // PNG-Filter
+    // ------------------------------------------------------------
+    inline std::uint8_t paeth(int a, int b, int c)
+    {
+        const int p = a + b - c;
+        const int pa = std::abs(p - a);
+        const int pb = std::abs(p - b);
+        const int pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc) return (std::uint8_t)a;
+        if (pb <= pc) return (std::uint8_t)b;
+        return (std::uint8_t)c;
+    }
+
+    // Schreibt eine Zeile mit Filtertyp 'type' (ohne Filterbyte)
+    void filterRow(int type, const std::uint8_t* cur, const std::uint8_t* prior,
+                   std::size_t stride, int bpp, std::uint8_t* dst)
+    {
+        switch (type)
+        {
+        case 0:
+            std::memcpy(dst, cur, stride);
+            break;
+        case 1:
+            for (std::size_t i = 0; i < stride; ++i)
+                dst[i] = (std::uint8_t)(cur[i] - ((i >= (std::size_t)bpp) ? cur[i - bpp] : 0));
+            break;
+        case 2:
+            for (std::size_t i = 0; i < stride; ++i)
+                dst[i] = (std::uint8_t)(cur[i] - (prior ? prior[i] : 0));
+            break;
+        case 3:
+            for (std::size_t i = 0; i < stride; ++i)
+            {
+                const int a = (i >= (std::size_t)bpp) ? cur[i - bpp] : 0;
+                const int b = prior ? prior[i] : 0;
+                dst[i] = (std::uint8_t)(cur[i] - ((a + b) >> 1));
+            }
+            break;
+        default:
+            for (std::size_t i = 0; i < stride; ++i)
+            {
+                const int a = (i >= (std::size_t)bpp) ? cur[i - bpp] : 0;
+                const int b = prior ? prior[i] : 0;
+                const int c = (prior && i >= (std::size_t)bpp) ? prior[i - bpp] : 0;
+                dst[i] = (std::uint8_t)(cur[i] - paeth(a, b, c));
+            }
+            break;
+        }
+    }
+
+    // Zeilen [y0, y1) filtern; out zeigt auf Zeile y0 inkl. Filterbyte
+    void filterRows(const std::uint8_t* rgba, int width, int y0, int y1,
+                    asset::PngEncoder::Level level, std::uint8_t* out)
+    {
+        using Level = asset::PngEncoder::Level;
+
+        const int bpp = 4;
+        const std::size_t stride = (std::size_t)width * 4u;
+
+        thread_local std::vector<std::uint8_t> trial;
+
+        for (int y = y0; y < y1; ++y)
+        {
+            const std::uint8_t* cur = rgba + (std::size_t)y * stride;
+            const std::uint8_t* prior = (y > 0) ? cur - stride : nullptr;
+            std::uint8_t* dst = out + (std::size_t)(y - y0) * (stride + 1);
+
+            if (level == Level::Store || level == Level::Fast)
+            {
+                const int type = (level == Level::Store) ? 0 : 2;
+                dst[0] = (std::uint8_t)type;
+                filterRow(type, cur, prior, stride, bpp, dst + 1);
+                continue;
+            }
+
+            // Heuristik: kleinste Summe der Beträge (als signed byte)
+            trial.resize(stride);
+            int bestType = 0;
+            std::uint64_t bestSum = ~0ull;
+
+            for (int type = 0; type < 5; ++type)
+            {
+                filterRow(type, cur, prior, stride, bpp, trial.data());
+
+                std::uint64_t sum = 0;
+                for (std::size_t i = 0; i < stride; ++i)
+                    sum += (std::uint64_t)std::abs((int)(std::int8_t)trial[i]);
+
+                if (sum < bestSum)
+                {
+                    bestSum = sum;
+                    bestType = type;
+                    std::memcpy(dst + 1, trial.data(), stride);
+                }
+            }
+            dst[0] = (std::uint8_t)bestType;
+        }
+    }
+
+    // ------------------------------------------------------------
+    // PNG-Container
+    // ------------------------------------------------------------
+    void putU32BE(std::vector<std::uint8_t>& b, std::uint32_t v)
+    {
+        b.push_back((std::uint8_t)(v >> 24));
+        b.push_back((std::uint8_t)(v >> 16));
+        b.push_back((std::uint8_t)(v >> 8));
+        b.push_back((std::uint8_t)v);
+    }
+
+    void appendChunk(std::vector<std::uint8_t>& out, const char type[4],
+                     const std::uint8_t* data, std::size_t n)
+    {
+        putU32BE(out, (std::uint32_t)n);
+        const std::size_t typePos = out.size();
+        out.insert(out.end(), type, type + 4);
+        if (n)
+            out.insert(out.end(), data, data + n);
+        putU32BE(out, crc32Update(0, out.data() + typePos, n + 4));
+    }
+
+    struct EncodeScratch
+    {
+        std::vector<std::uint8_t> filtered;
+        std::vector<std::vector<std::uint8_t>> parts;
+        std::vector<std::uint32_t> adlers;
+        std::vector<std::uint8_t> idat;
+        std::vector<std::uint8_t> file;
+    };
+
+    EncodeScratch& encodeScratch()
+    {
+        thread_local EncodeScratch s;
+        return s;
+    }
+}
+
+namespace asset
+{
+bool PngEncoder::encodeRGBA(std::vector<std::uint8_t>& out,
+                            int w, int h,
+                            const std::uint8_t* rgba,
+                            const Options& opts,
+                            std::string* err)
+{
+    out.clear();
+
+    if (!rgba || w <= 0 || h <= 0)
+    {
+        if (err) *err = "PngEncoder: invalid image data";
+        return false;
+    }
+
+    EncodeScratch& s = encodeScratch();
+
+    const std::size_t stride = (std::size_t)w * 4u;
+    const std::size_t rowBytes = stride + 1;
+    const std::size_t filteredSize = rowBytes * (std::size_t)h;
+
+    s.filtered.resize(filteredSize);
+
+    // Bereiche zu ganzen Zeilen (~512 KiB gefiltert), jeder Bereich wird
+    // unabhängig gefiltert und komprimiert.
+    const bool parallel = opts.parallel && stride * (std::size_t)h >= opts.parallelMinBytes;
+    const std::size_t rowsPerPart = parallel
+        ? std::max<std::size_t>(1u, (512u * 1024u) / rowBytes)
+        : (std::size_t)h;
+    const std::size_t partCount = ((std::size_t)h + rowsPerPart - 1) / rowsPerPart;
+
+    if (s.parts.size() < partCount)
+        s.parts.resize(partCount);
+    s.adlers.assign(partCount, 1u);
+
+    auto encodePart = [&](std::size_t part)
+    {
+        const int y0 = (int)(part * rowsPerPart);
+        const int y1 = (int)std::min<std::size_t>((std::size_t)h, (part + 1) * rowsPerPart);
+
+        std::uint8_t* f = s.filtered.data() + (std::size_t)y0 * rowBytes;
+        const std::size_t n = (std::size_t)(y1 - y0) * rowBytes;
+
+        filterRows(rgba, w, y0, y1, opts.level, f);
+        s.adlers[part] = adler32(f, n);
+        deflateRange(s.parts[part], f, n, opts.level, 4, part + 1 == partCount);
+    };
+
+    if (partCount > 1)
+    {
+        core::TaskSystem::instance().parallelFor(partCount, 1, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                encodePart(i);
+        });
+    }
+    else
+    {
+        encodePart(0);
+    }
+
+    // zlib-Stream: Header + Bereiche + Adler-32 (big endian)
+    std::uint32_t adler = s.adlers[0];
+    for (std::size_t i = 1; i < partCount; ++i)
+    {
+        const std::size_t partRows = std::min<std::size_t>(rowsPerPart, (std::size_t)h - i * rowsPerPart);
+        adler = adler32Combine(adler, s.adlers[i], partRows * rowBytes);
+    }
+
+    std::size_t zlibSize = 2 + 4;
+    for (std::size_t i = 0; i < partCount; ++i)
+        zlibSize += s.parts[i].size();
+
+    s.idat.clear();
+    s.idat.reserve(zlibSize);
+    s.idat.push_back(0x78);
+    s.idat.push_back(opts.level == Level::Store || opts.level == Level::Fast ? 0x01
+                   : opts.level == Level::Best ? 0xDA : 0x9C);
+    for (std::size_t i = 0; i < partCount; ++i)
+        s.idat.insert(s.idat.end(), s.parts[i].begin(), s.parts[i].end());
+    putU32BE(s.idat, adler);
+
+    // Datei
+    static const std::uint8_t kSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    out.reserve(8 + 25 + s.idat.size() + 12 * (s.idat.size() / (1u << 20) + 1) + 12);
+    out.insert(out.end(), kSignature, kSignature + 8);
+
+    std::vector<std::uint8_t> ihdr;
+    putU32BE(ihdr, (std::uint32_t)w);
+    putU32BE(ihdr, (std::uint32_t)h);
+    ihdr.push_back(8);  // bit depth
+    ihdr.push_back(6);  // color type RGBA
+    ihdr.push_back(0);  // compression
+    ihdr.push_back(0);  // filter
+    ihdr.push_back(0);  // interlace
+    appendChunk(out, "IHDR", ihdr.data(), ihdr.size());
+
+    // IDAT in 1-MiB-Chunks
+    const std::size_t maxIdat = 1u << 20;
+    for (std::size_t off = 0; off < s.idat.size(); off += maxIdat)
+        appendChunk(out, "IDAT", s.idat.data() + off, std::min(maxIdat, s.idat.size() - off));
+
+    appendChunk(out, "IEND", nullptr, 0);
+    return true;
+}
+
+bool PngEncoder::writeRGBA(const std::filesystem::path& outPng,
+                           int w, int h,
+                           const std::uint8_t* rgba,
+                           const Options& opts,
+                           std::string* err)
+{
+    EncodeScratch& s = encodeScratch();
+
+    if (!encodeRGBA(s.file, w, h, rgba, opts, err))
+        return false;
+
+    std::ofstream f(outPng, std::ios::binary);
+    if (!f)
+    {
+        if (err) *err = "PngEncoder: cannot open for write: " + outPng.string();
+        return false;
+    }
+
+    f.write(reinterpret_cast<const char*>(s.file.data()), (std::streamsize)s.file.size());
+    if (!f)
+    {
+        if (err) *err = "PngEncoder: write failed: " + outPng.string();
+        return false;
+    }
+    return true;
+}
+
+bool PngEncoder::writeRGBA(const std::filesystem::path& outPng,
+                           int w, int h,
+                           const std::vector<uint8_t>& rgba,
+                           std::string* err)
+{
+    if (rgba.size() < (std::size_t)std::max(w, 0) * (std::size_t)std::max(h, 0) * 4u)
+    {
+        if (err) *err = "PngEncoder: rgba buffer too small";
+        return false;
+    }
+    return writeRGBA(outPng, w, h, rgba.data(), Options{}, err);
+}
+} // namespace asset
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace asset
+{
+// Eigener PNG-Encoder (RGBA8) für ImageConverter.
+//
+// - Filterwahl pro Zeile und Deflate laufen für große Bilder parallel auf
+//   dem TaskSystem: die gefilterten Zeilen werden in Blöcke geteilt, jeder
+//   Block wird unabhängig komprimiert (Sync-Flush an den Grenzen) und die
+//   Adler-32-Summen werden kombiniert.
+// - Scratch-Puffer (Filter, Hash-Ketten, Token, Ausgabe) sind thread_local
+//   und werden über viele Bilder hinweg wiederverwendet.
+struct PngEncoder
+{
+    enum class Level
+    {
+        Store,    // keine Kompression (stored blocks), kein Filter
+        Fast,     // Up-Filter + RLE-Matches, zum schnellen Iterieren
+        Default,  // Filterheuristik + LZ77 (kurze Hash-Ketten)
+        Best      // Filterheuristik + LZ77 (lange Hash-Ketten)
+    };
+
+    struct Options
+    {
+        Level level = Level::Default;
+
+        // Ab dieser Rohgröße (w*h*4) wird parallel gefiltert/komprimiert
+        bool parallel = true;
+        std::size_t parallelMinBytes = 1u << 20;
+    };
+
+    // Muss RGBA8 annehmen (w*h*4).
+    static bool writeRGBA(const std::filesystem::path& outPng,
+                          int w, int h,
+                          const std::vector<uint8_t>& rgba,
+                          std::string* err);
+
+    static bool writeRGBA(const std::filesystem::path& outPng,
+                          int w, int h,
+                          const std::uint8_t* rgba,
+                          const Options& opts,
+                          std::string* err);
+
+    // Komplette PNG-Datei in den Speicher (out wird überschrieben).
+    static bool encodeRGBA(std::vector<std::uint8_t>& out,
+                           int w, int h,
+                           const std::uint8_t* rgba,
+                           const Options& opts,
+                           std::string* err);
+};
+} // namespace asset
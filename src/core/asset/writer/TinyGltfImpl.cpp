@@ -0,0 +1,5 @@
+// tinygltf implementation must live in exactly ONE .cpp
+// (ModelWriter schreibt GLB selbst; tinygltf bleibt für GLB-Test / Import)
+#define TINYGLTF_IMPLEMENTATION
+#define TINYGLTF_USE_CPP14
+#include "tiny_gltf.h"
@@ -11,6 +11,8 @@
 #include "core/asset/loader/ImageLoader.h"
 #include "core/asset/loader/AnimationLoader.h"
 #include "core/asset/loader/SfxLoader.h"
+#include "core/asset/io/AssetIoService.h"
+#include "core/TaskSystem.h"
 
 // ================= DECODERS =================
 #include "core/asset/decoder/O3DDecoder.h"
@@ -26,8 +28,12 @@
 // ================= CONVERTERS (Phase B) =================
 #include "core/asset/converter/ImageConverter.h"
 #include "core/asset/converter/SfxConverter.h"
-#include "core/asset/converter/ModelConverter.h"
+#include "core/asset/cache/ConversionCache.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <filesystem>
 #include <map>
 
@@ -51,6 +57,8 @@ void AssetPipelineA::onReset()
     m_assetIndex.clear();
     m_loadedModels.clear();
     m_decodedModels.clear();
+    m_parsedModels.clear();
+    m_parsedModelSource.clear();
 }
 
 PipelineResult AssetPipelineA::onUpdate()
@@ -129,6 +137,8 @@ void AssetPipelineA::loadAssets()
 {
     m_loadedModels.clear();
 
+    // 1) Sources vorbereiten (Pfade/Flags), noch ohne I/O
+    std::vector<::asset::ModelSource> prepared;
     for (const auto& kv : m_assetIndex)
     {
         const auto& rec = kv.second;
@@ -137,13 +147,61 @@ void AssetPipelineA::loadAssets()
         if (rec.techKind == ::asset::AssetTechKind::Model)
         {
             ::asset::ModelSource src;
-            if (::asset::ModelLoader::load(src, rec, &err))
-                m_loadedModels.emplace_back(std::move(src));
+            if (::asset::ModelLoader::prepare(src, rec, &err))
+                prepared.emplace_back(std::move(src));
             else
                 Log::error(err);
         }
     }
 
+    // 2) Alle Parts gebündelt lesen (viele Reads gleichzeitig in-flight)
+    //    userIndex = modelIndex * 2 + (0 = skeleton, 1 = mesh)
+    std::vector<::asset::io::ReadRequest> requests;
+    requests.reserve(prepared.size() * 2);
+
+    for (std::size_t i = 0; i < prepared.size(); ++i)
+    {
+        if (prepared[i].skeleton.exists)
+            requests.push_back({ prepared[i].skeleton.path, i * 2 + 0 });
+        if (prepared[i].mesh.exists)
+            requests.push_back({ prepared[i].mesh.path, i * 2 + 1 });
+    }
+
+    std::vector<std::string> partErrors(prepared.size() * 2);
+
+    ::asset::io::AssetIoService io;
+    io.readBatch(requests, [&](const ::asset::io::ReadRequest& req, ::asset::io::ReadResult& res)
+    {
+        // jeder Request schreibt nur in seinen eigenen Slot -> kein Lock nötig
+        if (!res.ok)
+        {
+            partErrors[req.userIndex] = res.error;
+            return;
+        }
+
+        auto& mdl = prepared[req.userIndex / 2];
+        auto& part = (req.userIndex % 2 == 0) ? mdl.skeleton : mdl.mesh;
+        part.bytes = std::move(res.data);
+    });
+
+    // 3) Ergebnis übernehmen (deterministische Reihenfolge wie der Index)
+    m_loadedModels.reserve(prepared.size());
+    for (std::size_t i = 0; i < prepared.size(); ++i)
+    {
+        auto& mdl = prepared[i];
+        const std::string& err = !partErrors[i * 2].empty() ? partErrors[i * 2] : partErrors[i * 2 + 1];
+        if (!err.empty())
+        {
+            mdl.state = ::asset::AssetState::Error;
+            mdl.errorMessage = err;
+            Log::error(err);
+            continue;
+        }
+
+        mdl.state = ::asset::AssetState::Loaded;
+        m_loadedModels.emplace_back(std::move(mdl));
+    }
+
     Log::info(
         "[AssetPipelineA] LoadAssets: models=" +
         std::to_string(m_loadedModels.size()));
@@ -155,16 +213,14 @@ void AssetPipelineA::decryptAssets()
     {
         auto decryptPart = [&](::asset::ModelPartSource& part)
         {
-            if (!part.exists || part.bytes.bytes.empty())
+            if (!part.exists || part.bytes.empty())
                 return;
 
-            std::vector<std::uint8_t> out;
             std::uint8_t key = 0;
             std::string err;
 
-            if (::asset::O3DDecryptor::decryptAuto(out, part.bytes.bytes, &key, &err))
-                part.bytes.bytes = std::move(out);
-            else
+            // In-place: unverschlüsselte Parts bleiben gemappt, sonst copy-on-write
+            if (!::asset::O3DDecryptor::decryptAutoInPlace(part.bytes, &key, &err))
                 Log::error(err);
         };
 
@@ -197,16 +253,60 @@ void AssetPipelineA::decodeAssets()
 
 void AssetPipelineA::parseAssets()
 {
-    for (std::size_t i = 0; i < m_decodedModels.size(); ++i)
+    using ModelParser = asset::parser::ModelParser;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const std::size_t count = m_decodedModels.size();
+
+    // Ergebnis-Slots pro Modell -> keine Synchronisation beim Parsen,
+    // Reihenfolge der Logs/Ergebnisse bleibt deterministisch
+    std::vector<::asset::O3DParsed> parsed(count);
+    std::vector<ModelParser::Stats> stats(count);
+    std::vector<std::string> errors(count);
+    std::vector<std::uint8_t> ok(count, 0);
+
+    ModelParser::Options opts;
+    opts.keepRaw = false; // Bytes liegen bereits in m_decodedModels
+
+    TaskSystem::instance().parallelFor(count, 1,
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                ok[i] = ModelParser::parse(parsed[i], m_decodedModels[i], opts, &stats[i], &errors[i]) ? 1 : 0;
+        });
+
+    m_parsedModels.clear();
+    m_parsedModelSource.clear();
+    m_parsedModels.reserve(count);
+    m_parsedModelSource.reserve(count);
+
+    ModelParser::Stats total;
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        ::asset::O3DParsed parsed;
-        std::string err;
+        if (!ok[i])
+        {
+            Log::error(errors[i]);
+            continue;
+        }
 
-        if (!asset::parser::ModelParser::parse(parsed, m_decodedModels[i], &err))
-            Log::error(err);
+        // eine Zeile pro Modell statt pro Objekt/Block
+        const auto& p = parsed[i];
+        const std::string& name = !p.mesh.headerNameLower.empty() ? p.mesh.headerNameLower : p.skeleton.headerNameLower;
+        Log::pipelineInfo("[ModelParser] " + (name.empty() ? "#" + std::to_string(i) : name) + " " + stats[i].summary());
+
+        total.add(stats[i]);
+        m_parsedModels.push_back(std::move(parsed[i]));
+        m_parsedModelSource.push_back(static_cast<std::uint32_t>(i));
     }
 
-    Log::info("[AssetPipelineA] ParseAssets done");
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    total.firstError.clear();
+    Log::info(
+        "[AssetPipelineA] ParseAssets: parsedModels=" + std::to_string(m_parsedModels.size()) +
+        "/" + std::to_string(count) + " " + total.summary() +
+        " ms=" + std::to_string(static_cast<long long>(ms)));
 }
 
 
@@ -247,20 +347,240 @@ PipelineResult AssetPipelineB::onUpdate()
 
 // -------------------- Phase B Steps --------------------
 
+namespace
+{
+    const char* assetKindName(::asset::AssetKind kind)
+    {
+        switch (kind)
+        {
+        case ::asset::AssetKind::UiSprite: return "UiSprite";
+        case ::asset::AssetKind::Icon:     return "Icon";
+        case ::asset::AssetKind::Texture:  return "Texture";
+        case ::asset::AssetKind::Image:    return "Image";
+        default:                           return "Other";
+        }
+    }
+}
+
 void AssetPipelineB::convertAssets()
 {
     ::asset::ConverterSettings cs;
     cs.overwriteExisting = false;
     cs.modelToolPath = m_projectData.projectRoot + "/tools/model_converter.exe";
 
-    ::asset::ModelConverter modelConv(cs);
+    // Inhaltsadressierter Cache: geänderte Quellen werden neu konvertiert,
+    // identische (auch über Client-Versionen hinweg) nur verlinkt
+    cs.cache = std::make_shared<::asset::cache::ConversionCache>(fs::path(m_projectData.assetCachePath) / ".convcache");
+    {
+        std::string err;
+        if (!cs.cache->load(&err))
+            Log::error(err);
+    }
+
+    // Modelle fehlen hier bewusst: ModelConverter schreibt noch kein GLB
+    // (Parse/Normalize/Write sind dort auskommentiert)
     ::asset::ImageConverter imageConv(cs);
     ::asset::SfxConverter   sfxConv(cs);
 
-    // ⚠️ Phase B nutzt KEINE Decoder
-    // → nur SourceSpecs + vorhandene AssetSources
+    ::asset::AssetIndexBuilder builder;
+    ::asset::AssetIndexBuilder::Settings s;
+    s.clientRoot        = m_projectData.clientPath;
+    s.resourceRoot      = m_projectData.resourcePath;
+    s.assetRoot         = m_projectData.assetCachePath;
+    s.resourceModelRoot = m_projectData.resourcePath + "/Model";
+
+    const auto index = builder.build(s);
+
+    // ⚠️ Phase B nutzt die Decoder nur innerhalb der Converter
+    // → Quellen kommen direkt aus dem Index, nichts bleibt im Speicher
+    convertImages(imageConv, index);
+    convertSfx(sfxConv, index);
+
+    std::string err;
+    if (!cs.cache->save(&err))
+        Log::error(err);
+
+    Log::info(
+        "[AssetPipelineB] ConvertAssets done: cacheHits=" + std::to_string(cs.cache->hits()) +
+        " deduped=" + std::to_string(cs.cache->dedupes()));
+}
+
+void AssetPipelineB::convertImages(const ::asset::ImageConverter& conv, const ::asset::AssetIndexBuilder::Index& index)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // 1) Nach Kind partitionieren (Texture/Image/UiSprite/Icon), sortiert für stabile Logs
+    std::map<::asset::AssetKind, std::vector<const ::asset::AssetRecord*>> byKind;
+    for (const auto& kv : index)
+    {
+        const auto& rec = kv.second;
+        if (rec.kind == ::asset::AssetKind::Ignore)
+            continue;
+        if (rec.techKind != ::asset::AssetTechKind::Texture &&
+            rec.techKind != ::asset::AssetTechKind::Image)
+            continue;
+
+        byKind[rec.kind].push_back(&rec);
+    }
+
+    // Speicher in-flight: Lesepuffer über maxInFlightBytes, Decode/Encode über
+    // maxInFlight (ein Bild pro Slot, Puffer werden nach convert() recycelt)
+    ::asset::io::AssetIoService::Settings ioSettings;
+    ioSettings.maxInFlightBytes = 256u * 1024u * 1024u;
+    ::asset::io::AssetIoService io(ioSettings);
+
+    for (auto& [kind, records] : byKind)
+    {
+        std::sort(records.begin(), records.end(),
+                  [](const ::asset::AssetRecord* a, const ::asset::AssetRecord* b) { return a->relPath < b->relPath; });
+
+        const auto t0 = Clock::now();
+
+        // 2) Vorbereiten + Ziel prüfen, bevor irgendetwas gelesen wird
+        std::vector<::asset::ImageSource> sources;
+        std::vector<::asset::io::ReadRequest> requests;
+        sources.reserve(records.size());
+        requests.reserve(records.size());
+
+        std::size_t skipped = 0;
+        std::size_t restored = 0;
+        std::atomic<std::size_t> failed{ 0 };
+
+        for (const auto* rec : records)
+        {
+            ::asset::ImageSource src;
+            std::string err;
+            if (!::asset::ImageLoader::prepare(src, *rec, &err))
+            {
+                Log::error(err + ": " + rec->relPath.generic_string());
+                ++failed;
+                continue;
+            }
+
+            if (!conv.needsConversion(src))
+            {
+                ++skipped;
+                continue;
+            }
+
+            // gleiche Ausgabe liegt schon im Objektspeicher -> verlinken statt lesen
+            if (conv.restoreFromCache(src))
+            {
+                ++restored;
+                continue;
+            }
+
+            requests.push_back({ src.sourcePath, sources.size() });
+            sources.emplace_back(std::move(src));
+        }
+
+        // 3) Lesen + Decode + Encode pro Bild auf dem Worker, der es gelesen hat
+        std::atomic<std::size_t> converted{ 0 };
+        std::atomic<std::uint64_t> bytesIn{ 0 };
+
+        io.readBatch(requests, [&](const ::asset::io::ReadRequest& req, ::asset::io::ReadResult& res)
+        {
+            if (!res.ok)
+            {
+                Log::error(res.error);
+                ++failed;
+                return;
+            }
+
+            // jeder Request besitzt nur seinen eigenen Slot -> kein Lock nötig
+            auto& src = sources[req.userIndex];
+            bytesIn += res.data.size();
+            src.bytes = std::move(res.data);
+            src.state = ::asset::AssetState::Loaded;
+
+            const ::asset::ConvertResult r = conv.convert(src);
+
+            // Puffer zurück an den Service (Pool), Quelle hält nichts mehr
+            res.data = std::move(src.bytes);
+            src.bytes.clear();
+
+            if (!r.ok)
+            {
+                Log::error("[AssetPipelineB] " + src.relPath.generic_string() + ": " + r.error);
+                ++failed;
+                return;
+            }
+            ++converted;
+        });
+
+        // 4) Durchsatz pro Kind
+        const auto elapsed = Clock::now() - t0;
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+        const double sec = std::max(std::chrono::duration<double>(elapsed).count(), 1e-6);
+
+        // in double aus Bytes, sonst ergeben kleine Batches 0 MiB/s
+        const double mib = static_cast<double>(bytesIn.load()) / (1024.0 * 1024.0);
+        char rate[96];
+        std::snprintf(rate, sizeof(rate), " files/s=%.1f MiB/s=%.1f (%.1f MiB read)",
+                      static_cast<double>(converted.load()) / sec, mib / sec, mib);
+
+        Log::info(
+            std::string("[AssetPipelineB] ConvertImages ") + assetKindName(kind) +
+            ": records=" + std::to_string(records.size()) +
+            " converted=" + std::to_string(converted.load()) +
+            " skipped=" + std::to_string(skipped) +
+            " restored=" + std::to_string(restored) +
+            " failed=" + std::to_string(failed.load()) +
+            " time=" + std::to_string(ms) + "ms" + rate);
+    }
+}
 
-    Log::info("[AssetPipelineB] ConvertAssets done");
+void AssetPipelineB::convertSfx(const ::asset::SfxConverter& conv, const ::asset::AssetIndexBuilder::Index& index)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<const ::asset::AssetRecord*> records;
+    for (const auto& kv : index)
+    {
+        if (kv.second.kind != ::asset::AssetKind::Ignore && kv.second.techKind == ::asset::AssetTechKind::Sfx)
+            records.push_back(&kv.second);
+    }
+    std::sort(records.begin(), records.end(),
+              [](const ::asset::AssetRecord* a, const ::asset::AssetRecord* b) { return a->relPath < b->relPath; });
+
+    const auto t0 = Clock::now();
+
+    // Ohne Bytes kopiert SfxConverter die Quelle direkt (copy_file, skip_existing),
+    // nichts wird in den Speicher gelesen
+    std::vector<std::string> errors(records.size());
+    TaskSystem::instance().parallelFor(records.size(), 16,
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ::asset::SfxSource src;
+                std::string err;
+                if (!::asset::SfxLoader::prepare(src, *records[i], &err))
+                {
+                    errors[i] = err + ": " + records[i]->relPath.generic_string();
+                    continue;
+                }
+
+                const ::asset::ConvertResult r = conv.convert(src);
+                if (!r.ok)
+                    errors[i] = "[AssetPipelineB] " + src.relPath.generic_string() + ": " + r.error;
+            }
+        });
+
+    std::size_t failed = 0;
+    for (const auto& e : errors)
+    {
+        if (e.empty())
+            continue;
+        Log::error(e);
+        ++failed;
+    }
+
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - t0).count();
+    Log::info(
+        "[AssetPipelineB] ConvertSfx: records=" + std::to_string(records.size()) +
+        " failed=" + std::to_string(failed) +
+        " time=" + std::to_string(ms) + "ms");
 }
 
 void AssetPipelineB::buildSnapshot()
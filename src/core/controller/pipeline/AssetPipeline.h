@@ -21,6 +21,12 @@
 // ===== Parsed =====
 #include "data/asset/parsed/O3DParsed.h"
 
+namespace asset
+{
+    class ImageConverter;
+    class SfxConverter;
+}
+
 namespace core::pipeline
 {
 
@@ -64,7 +70,10 @@ private:
     std::vector<::asset::DecodedAniData>   m_decodedAni;
     std::vector<::asset::DecodedSfxData>   m_decodedSfx;
 
+    // nur erfolgreich geparste Modelle, dicht gepackt;
+    // m_parsedModelSource[i] = Index in m_decodedModels
     std::vector<::asset::O3DParsed> m_parsedModels;
+    std::vector<std::uint32_t>      m_parsedModelSource;
 
     // -------- STEPS --------
     void scanAssets();
@@ -101,6 +110,12 @@ private:
 
     void convertAssets();
     void buildSnapshot();
+
+    // Texture/Image/UiSprite/Icon: Lesen + Decode + Encode gebündelt auf dem TaskSystem
+    void convertImages(const ::asset::ImageConverter& conv, const ::asset::AssetIndexBuilder::Index& index);
+
+    // Sfx: Datei-Kopie (ggf. mit Ziel-Extension), parallel auf dem TaskSystem
+    void convertSfx(const ::asset::SfxConverter& conv, const ::asset::AssetIndexBuilder::Index& index);
 };
 
 } // namespace asset::pipeline
@@ -6,6 +6,42 @@
 
 using namespace core;
 
+namespace
+{
+    core::source::SourceCollector::Settings collectorSettings()
+    {
+        core::source::SourceCollector::Settings cs;
+        cs.groupByBasename = true;
+        cs.applyDescriptorRules = true;
+        cs.keepFirstCategory = true;
+        return cs;
+    }
+
+    // alles außer den Dateien selbst, was Scan/Collect beeinflusst
+    std::uint64_t makeTreeKey(const std::string& sourceRoot,
+                              const core::source::descriptor::SourceDescriptorRegistry& registry,
+                              const core::source::SourceCollector::Settings& cs)
+    {
+        std::string d = "root=" + sourceRoot;
+        d += "|collect=" + std::to_string(cs.groupByBasename) +
+             std::to_string(cs.applyDescriptorRules) +
+             std::to_string(cs.keepFirstCategory);
+
+        for (const auto& desc : registry.descriptors())
+        {
+            d += "|desc=" + desc.id;
+            for (const auto& r : desc.rules)
+            {
+                d += ";" + std::to_string(static_cast<int>(r.type)) + ":" + r.value + ":" + r.category + ":";
+                for (const auto& e : r.extensions)
+                    d += e + ",";
+            }
+        }
+
+        return core::source::cache::SourceCache::keyOf(d);
+    }
+}
+
 SourcePipeline::SourcePipeline(ProjectData& projectData)
     : m_projectData(projectData)
 {
@@ -13,11 +49,14 @@ SourcePipeline::SourcePipeline(ProjectData& projectData)
 
 void SourcePipeline::onReset()
 {
-    m_state.step = State::Step::SourceScan;
+    m_state = {};
 
     m_descriptorRegistry.clear();
+    m_sourceCache.clear();
+    m_treeKey = 0;
     m_sourceIndex.clear();
     m_groups.clear();
+    m_extractFacts.clear();
 
     m_error.clear();
 }
@@ -28,7 +67,7 @@ PipelineResult SourcePipeline::onUpdate()
     {
     case State::Step::SourceScan:
         scanSource();
-        m_state.step = State::Step::SourceCollect;
+        m_state.step = m_state.treeUnchanged ? State::Step::SourceAssemble : State::Step::SourceCollect;
         return { JobState::Running, true };
 
     case State::Step::SourceCollect:
@@ -89,11 +128,8 @@ void SourcePipeline::scanSource()
     Log::info(
         "SourceScan finished: files=" + std::to_string(m_sourceIndex.size())
     );
-}
 
-void SourcePipeline::collectSource()
-{
-    // 1) Load Source descriptors (collect rules)
+    // Load Source descriptors (collect rules), gehören zum Cache-Key
     core::source::descriptor::SourceDescriptorLoader loader;
     std::string err;
 
@@ -102,7 +138,7 @@ void SourcePipeline::collectSource()
     {
         // Non-fatal if you want: but I'd rather fail hard v1
         m_jobState = JobState::Error;
-        m_error = "SourcePipeline::collectSource: loadAll(core) failed: " + err;
+        m_error = "SourcePipeline::scanSource: loadAll(core) failed: " + err;
         Log::error(m_error);
         return;
     }
@@ -111,13 +147,45 @@ void SourcePipeline::collectSource()
     // v1 loader clears registry; so we SKIP plugin load here for now.
     // Sobald du JSON-Loader hast, bauen wir "loadAll(core, plugins)" als 1 Call.
 
-    // 2) Build groups
-    core::source::SourceCollector::Settings cs;
-    cs.groupByBasename = true;
-    cs.applyDescriptorRules = true;
-    cs.keepFirstCategory = true;
+    // Scan als Änderungserkennung gegen den letzten Lauf
+    m_treeKey = makeTreeKey(m_projectData.sourcePath, m_descriptorRegistry, collectorSettings());
 
-    core::source::SourceCollector collector(cs);
+    m_sourceCache.setFile(m_projectData.internalDataPath.empty()
+        ? std::filesystem::path{}
+        : std::filesystem::path(m_projectData.internalDataPath) / "source" / "sourcecache.bin");
+
+    // Cache-Probleme sind nicht fatal, dann wird eben alles neu gebaut
+    err.clear();
+    if (!m_sourceCache.load(&err))
+        Log::warn(err);
+
+    // Unveränderter Baum: Groups + Facts aus dem Cache, weiter mit SourceAssemble.
+    if (m_sourceCache.sameTree(m_treeKey, m_sourceIndex) &&
+        m_sourceCache.restoreGroups(m_sourceIndex, m_groups) &&
+        m_sourceCache.restoreResult(m_sourceExtractor.extractorInfos(), m_extractFacts))
+    {
+        m_state.treeUnchanged = true;
+        Log::info(
+            "SourceCache: tree unchanged, skipping to SourceAssemble: groups=" +
+            std::to_string(m_groups.size()) +
+            " facts=" + std::to_string(m_extractFacts.size())
+        );
+    }
+}
+
+void SourcePipeline::collectSource()
+{
+    // Gleiche Dateiliste wie beim letzten Lauf -> Gruppen wiederverwenden
+    if (m_sourceCache.sameFiles(m_treeKey, m_sourceIndex) &&
+        m_sourceCache.restoreGroups(m_sourceIndex, m_groups))
+    {
+        Log::info(
+            "SourceCollect finished (cached): groups=" + std::to_string(m_groups.size())
+        );
+        return;
+    }
+
+    core::source::SourceCollector collector(collectorSettings());
     collector.collect(m_sourceIndex, m_descriptorRegistry, m_groups);
 
     Log::info(
@@ -132,16 +200,23 @@ void SourcePipeline::extractSource()
     // 1) Input aus vorheriger Phase
     const auto& groups = m_groups; // aus Collect + Descriptor
 
-    // 2) Facts-Zielcontainer (in-memory)
-    m_extractFacts.clear();
-    m_extractFacts.reserve(1024); // optional
+    // 2) Extractor ausführen (einziger Einstiegspunkt, füllt Facts + Tabellen),
+    //    ungeänderte Dateien kommen aus dem SourceCache
+    SourceExtractor::Stats stats;
+    m_sourceExtractor.extract(groups, m_extractFacts, &m_sourceCache, &stats);
+
+    // 3) Baum + Ergebnis für den nächsten Lauf merken
+    m_sourceCache.storeTree(m_treeKey, m_sourceIndex, m_groups);
+    m_sourceCache.storeResult(m_extractFacts);
 
-    // 3) Extractor ausführen (einziger Einstiegspunkt)
-    m_sourceExtractor.extract(groups, m_extractFacts);
+    std::string err;
+    if (!m_sourceCache.save(&err))
+        Log::warn(err);
 
     Log::info(
         "SourceExtract finished: facts=" +
-        std::to_string(m_extractFacts.size())
+        std::to_string(m_extractFacts.size()) +
+        " " + stats.summary()
         );
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "core/controller/PipelineController.h"
@@ -12,6 +13,7 @@
 // Logic
 #include "core/source/scan/SourceScanner.h"
 #include "core/source/collect/SourceCollector.h"
+#include "core/source/cache/SourceCache.h"
 
 // Data
 #include "data/source/index/SourceIndexList.h"
@@ -53,6 +55,10 @@ private:
         };
 
         Step step = Step::SourceScan;
+
+        // Scan == letzter Lauf (SourceCache) -> Groups + Facts restauriert,
+        // weiter direkt mit SourceAssemble (Collect/Extract entfallen)
+        bool treeUnchanged = false;
     };
 
     State m_state;
@@ -61,7 +67,7 @@ private:
     // =====================
     // Pipeline Steps
     // =====================
-    void scanSource();
+    void scanSource();        // + Descriptors laden, Abgleich mit SourceCache
     void collectSource();
     void extractSource();     // v1: placeholder
     void assembleSource();    // v1: placeholder
@@ -77,6 +83,10 @@ private:
     // loaded rules for collect
     core::source::descriptor::SourceDescriptorRegistry m_descriptorRegistry;
 
+    // inkrementelle Läufe (persistiert unter internalDataPath)
+    core::source::cache::SourceCache m_sourceCache;
+    std::uint64_t m_treeKey = 0;   // Wurzel + Descriptor-Regeln + Collector-Settings
+
     // scan result
     data::source::SourceIndexList m_sourceIndex;
 
@@ -84,7 +94,7 @@ private:
     std::vector<data::source::SourceGroup> m_groups;
 
     // extract result (facts)
-    std::vector<core::source::extract::ExtractFact> m_extractFacts;
+    core::source::extract::ExtractFacts m_extractFacts;
 
     // extractor (owns schema extractors)
     core::source::extract::SourceExtractor m_sourceExtractor;
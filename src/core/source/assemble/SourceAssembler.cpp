@@ -1,52 +1,66 @@
 #include "core/source/assemble/SourceAssembler.h"
 
-using core::source::extract::ExtractFact;
 using namespace core::source::assemble::model;
 
 namespace core::source::assemble
 {
 void SourceAssembler::assemble(
-    const std::vector<core::source::extract::ExtractFact>& facts,
+    const core::source::extract::ExtractFacts& facts,
     model::MeshRenderSpec& outSpec
     ) const
 {
     using namespace core::source::assemble::model;
+    using core::source::extract::FactType;
 
     outSpec = {};
 
     bool hasStruct = false;
     bool hasArrayRead = false;
 
-    for (const auto& f : facts)
+    for (const auto& f : facts.facts)
     {
+        switch (f.type)
+        {
         // --- SubMesh schema evidence ---
-        if (f.factType == "SubMesh.Block.Struct")
+        case FactType::SubMeshBlockStruct:
             hasStruct = true;
-        else if (f.factType == "SubMesh.Block.ArrayRead")
+            break;
+        case FactType::SubMeshBlockArrayRead:
             hasArrayRead = true;
+            break;
 
         // --- Drawcall schema ---
-        else if (f.factType == "DrawCall.PrimitiveType.TriangleList")
+        case FactType::DrawCallPrimitiveTypeTriangleList:
             outSpec.draw.primitiveType = PrimitiveType::TriangleList;
+            break;
 
-        else if (f.factType == "DrawCall.Invoke.DrawIndexedPrimitive")
-            outSpec.draw.usesDrawIndexedPrimitive = true; // <-- add field (see below)
+        case FactType::DrawCallInvokeDrawIndexedPrimitive:
+            outSpec.draw.usesDrawIndexedPrimitive = true;
+            break;
 
-        else if (f.factType == "DrawCall.PerSubMesh")
+        case FactType::DrawCallPerSubMesh:
             outSpec.draw.perSubMesh = true;
+            break;
 
-        else if (f.factType == "DrawCall.Grouping.SetGroup")
+        case FactType::DrawCallGroupingSetGroup:
             outSpec.draw.usesLOD = true;
+            break;
 
-        else if (f.factType == "Material.Variant.SetTextureEx")
+        case FactType::MaterialVariantSetTextureEx:
             outSpec.draw.usesMaterialVariants = true;
+            break;
 
-        else if (f.factType == "DrawCall.Mapping.MaterialBlockField")
+        case FactType::DrawCallMappingMaterialBlockField:
             outSpec.draw.mappingFieldLocations.push_back(
-                f.file + ":" + std::to_string(f.line)
+                facts.fileOf(f).relativePath + ":" + std::to_string(f.line)
                 );
+            break;
+
+        default:
+            break;
+        }
     }
 
-    outSpec.draw.hasMaterialBlockEvidence = (hasStruct && hasArrayRead); // <-- add field
+    outSpec.draw.hasMaterialBlockEvidence = (hasStruct && hasArrayRead);
 }
 }
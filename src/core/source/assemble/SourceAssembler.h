@@ -10,7 +10,7 @@ namespace core::source::assemble
     {
     public:
         void assemble(
-            const std::vector<core::source::extract::ExtractFact>& facts,
+            const core::source::extract::ExtractFacts& facts,
             model::MeshRenderSpec& outSpec
         ) const;
     };
@@ -0,0 +1,652 @@
+#include "SourceCache.h"
+
+#include "core/source/extract/schema/RuleExtractorBase.h"
+#include "core/source/extract/util/TextUnit.h"
+#include "core/asset/decoder/BinaryReader.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+namespace core::source::cache
+{
+    namespace
+    {
+        constexpr std::uint32_t kCacheMagic = 0x43525346u; // "FSRC"
+        constexpr std::uint32_t kCacheVersion = 1;          // bei Änderungen an FactType/Layout erhöhen
+
+        using asset::decode::BinaryReader;
+
+        void putU8(std::string& b, std::uint8_t v) { b.push_back(static_cast<char>(v)); }
+        void putU16(std::string& b, std::uint16_t v) { b.append(reinterpret_cast<const char*>(&v), 2); }
+        void putU32(std::string& b, std::uint32_t v) { b.append(reinterpret_cast<const char*>(&v), 4); }
+        void putU64(std::string& b, std::uint64_t v) { b.append(reinterpret_cast<const char*>(&v), 8); }
+        void putStr(std::string& b, std::string_view s)
+        {
+            putU32(b, static_cast<std::uint32_t>(s.size()));
+            b.append(s);
+        }
+
+        bool getStr(BinaryReader& r, std::string& out)
+        {
+            auto len = r.readLE<std::uint32_t>();
+            if (!len) return false;
+            auto span = r.readSpan(*len);
+            if (!span) return false;
+            out.assign(reinterpret_cast<const char*>(span->data()), span->size());
+            return true;
+        }
+
+        // Anzahl lesen, grob gegen den Rest plausibilisieren (min. Bytes pro Element)
+        bool getCount(BinaryReader& r, std::size_t minBytes, std::uint32_t& out)
+        {
+            auto n = r.readLE<std::uint32_t>();
+            if (!n || *n > r.remaining() / minBytes) return false;
+            out = *n;
+            return true;
+        }
+
+        // --- Facts / Spans ---
+        constexpr std::size_t kFactBytes = 2 + 2 + 4 + 4 + 4 + 4 + 4 + 4 + 1 + 4 + 4;
+
+        void putFacts(std::string& b, const std::vector<extract::ExtractFact>& facts,
+                      const std::vector<extract::TextSpan>& spans)
+        {
+            putU32(b, static_cast<std::uint32_t>(facts.size()));
+            for (const auto& f : facts)
+            {
+                std::uint32_t conf = 0;
+                std::memcpy(&conf, &f.confidence, 4);
+
+                putU16(b, static_cast<std::uint16_t>(f.type));
+                putU16(b, f.extractor);
+                putU32(b, f.file);
+                putU32(b, f.group);
+                putU32(b, static_cast<std::uint32_t>(f.line));
+                putU32(b, conf);
+                putU32(b, f.evidence.offset);
+                putU32(b, f.evidence.length);
+                putU8(b, f.snippetContext);
+                putU32(b, f.spanBegin);
+                putU32(b, f.spanCount);
+            }
+
+            putU32(b, static_cast<std::uint32_t>(spans.size()));
+            for (const auto& s : spans)
+            {
+                putU32(b, s.offset);
+                putU32(b, s.length);
+            }
+        }
+
+        bool getFacts(BinaryReader& r, std::vector<extract::ExtractFact>& facts,
+                      std::vector<extract::TextSpan>& spans)
+        {
+            std::uint32_t n = 0;
+            if (!getCount(r, kFactBytes, n))
+                return false;
+
+            facts.resize(n);
+            for (auto& f : facts)
+            {
+                const auto type = r.readLE<std::uint16_t>();
+                const auto extractor = r.readLE<std::uint16_t>();
+                const auto file = r.readLE<std::uint32_t>();
+                const auto group = r.readLE<std::uint32_t>();
+                const auto line = r.readLE<std::int32_t>();
+                const auto conf = r.readLE<std::uint32_t>();
+                const auto evOffset = r.readLE<std::uint32_t>();
+                const auto evLength = r.readLE<std::uint32_t>();
+                const auto ctx = r.readLE<std::uint8_t>();
+                const auto spanBegin = r.readLE<std::uint32_t>();
+                const auto spanCount = r.readLE<std::uint32_t>();
+                if (!type || !extractor || !file || !group || !line || !conf ||
+                    !evOffset || !evLength || !ctx || !spanBegin || !spanCount ||
+                    *type >= static_cast<std::uint16_t>(extract::FactType::Count))
+                    return false;
+
+                f.type = static_cast<extract::FactType>(*type);
+                f.extractor = *extractor;
+                f.file = *file;
+                f.group = *group;
+                f.line = *line;
+                std::memcpy(&f.confidence, &*conf, 4);
+                f.evidence = { *evOffset, *evLength };
+                f.snippetContext = *ctx;
+                f.spanBegin = *spanBegin;
+                f.spanCount = *spanCount;
+            }
+
+            if (!getCount(r, 8, n))
+                return false;
+
+            spans.resize(n);
+            for (auto& s : spans)
+            {
+                const auto offset = r.readLE<std::uint32_t>();
+                const auto length = r.readLE<std::uint32_t>();
+                if (!offset || !length)
+                    return false;
+                s = { *offset, *length };
+            }
+
+            for (const auto& f : facts)
+                if (static_cast<std::uint64_t>(f.spanBegin) + f.spanCount > spans.size())
+                    return false;
+            return true;
+        }
+
+        std::string relKey(const data::source::SourceFileEntry& f)
+        {
+            return f.relativePath.generic_string();
+        }
+    }
+
+    SourceCache::SourceCache(fs::path file)
+        : m_file(std::move(file))
+    {
+    }
+
+    void SourceCache::clear()
+    {
+        m_dirty = false;
+
+        m_hasTree = false;
+        m_treeKey = 0;
+        m_treeFiles.clear();
+        m_treeGroups.clear();
+
+        m_fileStats.clear();
+        m_facts.clear();
+
+        m_hasResult = false;
+        m_result.clear();
+    }
+
+    std::uint64_t SourceCache::keyOf(std::string_view description)
+    {
+        return extract::util::contentHash(description);
+    }
+
+    std::string SourceCache::factsKey(std::string_view extractorId, int version, std::string_view relPath)
+    {
+        std::string k;
+        k.reserve(extractorId.size() + relPath.size() + 16);
+        k.append(extractorId);
+        k.push_back('\0');
+        k.append(std::to_string(version));
+        k.push_back('\0');
+        k.append(relPath);
+        return k;
+    }
+
+    // =======================================================
+    // Persistenz
+    // =======================================================
+
+    bool SourceCache::load(std::string* err)
+    {
+        clear();
+        if (m_file.empty())
+            return true;
+
+        std::error_code ec;
+        if (!fs::exists(m_file, ec))
+            return true;
+
+        std::ifstream f(m_file, std::ios::binary);
+        const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+        if (f.bad())
+        {
+            if (err) *err = "SourceCache: cannot read " + m_file.string();
+            return false;
+        }
+
+        BinaryReader r(bytes);
+        const auto magic = r.readLE<std::uint32_t>();
+        const auto version = r.readLE<std::uint32_t>();
+        if (!magic || *magic != kCacheMagic || !version || *version != kCacheVersion)
+            return true; // fremdes/altes Format -> leer starten
+
+        auto corrupt = [&]
+        {
+            clear();
+            if (err) *err = "SourceCache: cache corrupt, rebuilding " + m_file.string();
+            return false;
+        };
+
+        // --- Baum ---
+        const auto hasTree = r.readLE<std::uint8_t>();
+        const auto treeKey = r.readLE<std::uint64_t>();
+        std::uint32_t n = 0;
+        if (!hasTree || !treeKey || !getCount(r, 20, n))
+            return corrupt();
+
+        m_hasTree = *hasTree != 0;
+        m_treeKey = *treeKey;
+        m_treeFiles.resize(n);
+        for (auto& tf : m_treeFiles)
+        {
+            if (!getStr(r, tf.relPath))
+                return corrupt();
+            const auto size = r.readLE<std::uint64_t>();
+            const auto writeTime = r.readLE<std::int64_t>();
+            if (!size || !writeTime)
+                return corrupt();
+            tf.size = *size;
+            tf.writeTime = *writeTime;
+        }
+
+        if (!getCount(r, 20, n))
+            return corrupt();
+        m_treeGroups.resize(n);
+        for (auto& tg : m_treeGroups)
+        {
+            std::uint32_t m = 0;
+            if (!getStr(r, tg.id) || !getStr(r, tg.category) || !getCount(r, 4, m))
+                return corrupt();
+            tg.matchedDescriptorIds.resize(m);
+            for (auto& d : tg.matchedDescriptorIds)
+                if (!getStr(r, d))
+                    return corrupt();
+
+            if (!getStr(r, tg.baseDirectory) || !getCount(r, 4, m))
+                return corrupt();
+            tg.files.resize(m);
+            for (auto& fi : tg.files)
+            {
+                const auto idx = r.readLE<std::uint32_t>();
+                if (!idx || *idx >= m_treeFiles.size())
+                    return corrupt();
+                fi = *idx;
+            }
+        }
+
+        // --- Datei-Hashes ---
+        if (!getCount(r, 28, n))
+            return corrupt();
+        m_fileStats.reserve(n);
+        for (std::uint32_t i = 0; i < n; ++i)
+        {
+            std::string rel;
+            if (!getStr(r, rel))
+                return corrupt();
+            const auto size = r.readLE<std::uint64_t>();
+            const auto writeTime = r.readLE<std::int64_t>();
+            const auto hash = r.readLE<std::uint64_t>();
+            if (!size || !writeTime || !hash)
+                return corrupt();
+            m_fileStats[std::move(rel)] = { *size, *writeTime, *hash };
+        }
+
+        // --- Facts pro (Extractor, Datei) ---
+        if (!getCount(r, 24, n))
+            return corrupt();
+        m_facts.reserve(n);
+        for (std::uint32_t i = 0; i < n; ++i)
+        {
+            FactsEntry e;
+            if (!getStr(r, e.extractorId))
+                return corrupt();
+            const auto ver = r.readLE<std::int32_t>();
+            if (!ver || !getStr(r, e.relPath))
+                return corrupt();
+            const auto hash = r.readLE<std::uint64_t>();
+            if (!hash)
+                return corrupt();
+
+            e.version = *ver;
+            e.facts.hash = *hash;
+            if (!getFacts(r, e.facts.facts, e.facts.spans))
+                return corrupt();
+
+            auto key = factsKey(e.extractorId, e.version, e.relPath);
+            m_facts[std::move(key)] = std::move(e);
+        }
+
+        // --- letztes Ergebnis ---
+        const auto hasResult = r.readLE<std::uint8_t>();
+        if (!hasResult || !getCount(r, 8, n))
+            return corrupt();
+        m_hasResult = *hasResult != 0;
+
+        m_result.extractors.resize(n);
+        for (auto& e : m_result.extractors)
+        {
+            if (!getStr(r, e.id))
+                return corrupt();
+            const auto ver = r.readLE<std::int32_t>();
+            if (!ver)
+                return corrupt();
+            e.version = *ver;
+        }
+
+        if (!getCount(r, 4, n))
+            return corrupt();
+        m_result.groups.resize(n);
+        for (auto& g : m_result.groups)
+            if (!getStr(r, g))
+                return corrupt();
+
+        if (!getCount(r, 8, n))
+            return corrupt();
+        m_result.files.resize(n);
+        for (auto& ff : m_result.files)
+        {
+            std::string abs;
+            if (!getStr(r, abs) || !getStr(r, ff.relativePath))
+                return corrupt();
+            ff.absolutePath = fs::path(abs);
+        }
+
+        if (!getFacts(r, m_result.facts, m_result.spans))
+            return corrupt();
+
+        for (const auto& f : m_result.facts)
+        {
+            if (f.extractor >= m_result.extractors.size() ||
+                f.file >= m_result.files.size() ||
+                f.group >= m_result.groups.size())
+                return corrupt();
+        }
+
+        return true;
+    }
+
+    bool SourceCache::save(std::string* err)
+    {
+        if (!m_dirty || m_file.empty())
+            return true;
+
+        std::string b;
+        putU32(b, kCacheMagic);
+        putU32(b, kCacheVersion);
+
+        // --- Baum ---
+        putU8(b, m_hasTree ? 1 : 0);
+        putU64(b, m_treeKey);
+        putU32(b, static_cast<std::uint32_t>(m_treeFiles.size()));
+        for (const auto& tf : m_treeFiles)
+        {
+            putStr(b, tf.relPath);
+            putU64(b, tf.size);
+            putU64(b, static_cast<std::uint64_t>(tf.writeTime));
+        }
+
+        putU32(b, static_cast<std::uint32_t>(m_treeGroups.size()));
+        for (const auto& tg : m_treeGroups)
+        {
+            putStr(b, tg.id);
+            putStr(b, tg.category);
+            putU32(b, static_cast<std::uint32_t>(tg.matchedDescriptorIds.size()));
+            for (const auto& d : tg.matchedDescriptorIds)
+                putStr(b, d);
+            putStr(b, tg.baseDirectory);
+            putU32(b, static_cast<std::uint32_t>(tg.files.size()));
+            for (auto fi : tg.files)
+                putU32(b, fi);
+        }
+
+        // --- Datei-Hashes ---
+        putU32(b, static_cast<std::uint32_t>(m_fileStats.size()));
+        for (const auto& [rel, st] : m_fileStats)
+        {
+            putStr(b, rel);
+            putU64(b, st.size);
+            putU64(b, static_cast<std::uint64_t>(st.writeTime));
+            putU64(b, st.hash);
+        }
+
+        // --- Facts pro (Extractor, Datei) ---
+        putU32(b, static_cast<std::uint32_t>(m_facts.size()));
+        for (const auto& [key, e] : m_facts)
+        {
+            putStr(b, e.extractorId);
+            putU32(b, static_cast<std::uint32_t>(e.version));
+            putStr(b, e.relPath);
+            putU64(b, e.facts.hash);
+            putFacts(b, e.facts.facts, e.facts.spans);
+        }
+
+        // --- letztes Ergebnis ---
+        putU8(b, m_hasResult ? 1 : 0);
+        putU32(b, static_cast<std::uint32_t>(m_result.extractors.size()));
+        for (const auto& e : m_result.extractors)
+        {
+            putStr(b, e.id);
+            putU32(b, static_cast<std::uint32_t>(e.version));
+        }
+        putU32(b, static_cast<std::uint32_t>(m_result.groups.size()));
+        for (const auto& g : m_result.groups)
+            putStr(b, g);
+        putU32(b, static_cast<std::uint32_t>(m_result.files.size()));
+        for (const auto& ff : m_result.files)
+        {
+            putStr(b, ff.absolutePath.string());
+            putStr(b, ff.relativePath);
+        }
+        putFacts(b, m_result.facts, m_result.spans);
+
+        std::error_code ec;
+        fs::create_directories(m_file.parent_path(), ec);
+
+        fs::path tmp = m_file;
+        tmp += ".tmp";
+        {
+            std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+            f.write(b.data(), static_cast<std::streamsize>(b.size()));
+            if (!f)
+            {
+                if (err) *err = "SourceCache: cannot write " + tmp.string();
+                return false;
+            }
+        }
+
+        fs::rename(tmp, m_file, ec);
+        if (ec)
+        {
+            fs::remove(tmp, ec);
+            if (err) *err = "SourceCache: cannot replace " + m_file.string();
+            return false;
+        }
+
+        m_dirty = false;
+        return true;
+    }
+
+    // =======================================================
+    // Baum
+    // =======================================================
+
+    bool SourceCache::sameFiles(std::uint64_t treeKey, const data::source::SourceIndexList& index) const
+    {
+        if (!m_hasTree || m_treeKey != treeKey || m_treeFiles.size() != index.size())
+            return false;
+
+        const auto& files = index.files();
+        for (std::size_t i = 0; i < files.size(); ++i)
+            if (m_treeFiles[i].relPath != relKey(files[i]))
+                return false;
+        return true;
+    }
+
+    bool SourceCache::sameTree(std::uint64_t treeKey, const data::source::SourceIndexList& index) const
+    {
+        if (!sameFiles(treeKey, index))
+            return false;
+
+        const auto& files = index.files();
+        for (std::size_t i = 0; i < files.size(); ++i)
+            if (m_treeFiles[i].size != files[i].size || m_treeFiles[i].writeTime != files[i].writeTime)
+                return false;
+        return true;
+    }
+
+    bool SourceCache::restoreGroups(const data::source::SourceIndexList& index,
+                                    std::vector<data::source::SourceGroup>& out) const
+    {
+        out.clear();
+        if (!m_hasTree || m_treeFiles.size() != index.size())
+            return false;
+
+        const auto& files = index.files();
+        out.reserve(m_treeGroups.size());
+        for (const auto& tg : m_treeGroups)
+        {
+            data::source::SourceGroup g;
+            g.id = tg.id;
+            g.category = tg.category;
+            g.matchedDescriptorIds = tg.matchedDescriptorIds;
+            g.baseDirectory = fs::path(tg.baseDirectory);
+            g.files.reserve(tg.files.size());
+            for (auto fi : tg.files)
+                g.files.push_back(files[fi]);
+            out.push_back(std::move(g));
+        }
+        return true;
+    }
+
+    void SourceCache::storeTree(std::uint64_t treeKey,
+                                const data::source::SourceIndexList& index,
+                                const std::vector<data::source::SourceGroup>& groups)
+    {
+        m_hasTree = true;
+        m_treeKey = treeKey;
+
+        std::unordered_map<std::string, std::uint32_t> fileIndex;
+        fileIndex.reserve(index.size());
+
+        m_treeFiles.clear();
+        m_treeFiles.reserve(index.size());
+        for (const auto& f : index.files())
+        {
+            TreeFile tf;
+            tf.relPath = relKey(f);
+            tf.size = f.size;
+            tf.writeTime = f.writeTime;
+            fileIndex.emplace(tf.relPath, static_cast<std::uint32_t>(m_treeFiles.size()));
+            m_treeFiles.push_back(std::move(tf));
+        }
+
+        m_treeGroups.clear();
+        m_treeGroups.reserve(groups.size());
+        for (const auto& g : groups)
+        {
+            TreeGroup tg;
+            tg.id = g.id;
+            tg.category = g.category;
+            tg.matchedDescriptorIds = g.matchedDescriptorIds;
+            tg.baseDirectory = g.baseDirectory.string();
+            tg.files.reserve(g.files.size());
+            for (const auto& f : g.files)
+            {
+                auto it = fileIndex.find(relKey(f));
+                if (it == fileIndex.end())
+                {
+                    // Gruppe mit Datei außerhalb des Index -> Baum nicht cachebar
+                    m_hasTree = false;
+                    m_treeGroups.clear();
+                    m_dirty = true;
+                    return;
+                }
+                tg.files.push_back(it->second);
+            }
+            m_treeGroups.push_back(std::move(tg));
+        }
+
+        m_dirty = true;
+    }
+
+    // =======================================================
+    // Extract
+    // =======================================================
+
+    bool SourceCache::knownHash(const data::source::SourceFileEntry& file, std::uint64_t& hash) const
+    {
+        auto it = m_fileStats.find(relKey(file));
+        if (it == m_fileStats.end() || it->second.size != file.size || it->second.writeTime != file.writeTime)
+            return false;
+
+        hash = it->second.hash;
+        return true;
+    }
+
+    const SourceCache::FileFacts* SourceCache::findFacts(std::string_view extractorId, int version,
+                                                         std::string_view relPath) const
+    {
+        auto it = m_facts.find(factsKey(extractorId, version, relPath));
+        return it != m_facts.end() ? &it->second.facts : nullptr;
+    }
+
+    void SourceCache::appendFacts(const FileFacts& cached, const extract::FactContext& ctx,
+                                  extract::ExtractFacts& out)
+    {
+        const auto base = static_cast<std::uint32_t>(out.spans.size());
+        out.spans.insert(out.spans.end(), cached.spans.begin(), cached.spans.end());
+
+        out.facts.reserve(out.facts.size() + cached.facts.size());
+        for (auto f : cached.facts)
+        {
+            f.extractor = ctx.extractor;
+            f.file = ctx.fileId;
+            f.group = ctx.groupId;
+            f.spanBegin += base;
+            out.facts.push_back(f);
+        }
+    }
+
+    SourceCache::FileFacts SourceCache::makeFileFacts(std::uint64_t hash, const extract::ExtractFacts& local)
+    {
+        FileFacts ff;
+        ff.hash = hash;
+        ff.facts = local.facts;
+        ff.spans = local.spans;
+        for (auto& f : ff.facts)
+        {
+            f.extractor = 0;
+            f.file = 0;
+            f.group = 0;
+        }
+        return ff;
+    }
+
+    void SourceCache::replaceExtract(std::unordered_map<std::string, FileStat> files,
+                                     std::vector<FactsEntry> facts)
+    {
+        m_fileStats = std::move(files);
+
+        m_facts.clear();
+        m_facts.reserve(facts.size());
+        for (auto& e : facts)
+        {
+            auto key = factsKey(e.extractorId, e.version, e.relPath);
+            m_facts[std::move(key)] = std::move(e);
+        }
+
+        m_dirty = true;
+    }
+
+    bool SourceCache::restoreResult(const std::vector<extract::ExtractorInfo>& extractors,
+                                    extract::ExtractFacts& out) const
+    {
+        if (!m_hasResult || m_result.extractors.size() != extractors.size())
+            return false;
+
+        for (std::size_t i = 0; i < extractors.size(); ++i)
+            if (m_result.extractors[i].id != extractors[i].id ||
+                m_result.extractors[i].version != extractors[i].version)
+                return false;
+
+        out = m_result;
+        return true;
+    }
+
+    void SourceCache::storeResult(const extract::ExtractFacts& facts)
+    {
+        m_hasResult = true;
+        m_result = facts;
+        m_dirty = true;
+    }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "data/source/index/SourceIndexList.h"
+#include "data/source/collect/SourceGroup.h"
+#include "data/source/extract/ExtractFact.h"
+
+namespace core::source::extract
+{
+    struct FactContext;
+}
+
+namespace core::source::cache
+{
+    // Persistenter Zustand für inkrementelle SourcePipeline-Läufe
+    // (<internalDataPath>/source/sourcecache.bin):
+    // - Baum: Scan-Ergebnis (Pfad, Größe, Schreibzeit) + daraus gesammelte Gruppen,
+    //   gültig für einen treeKey (Wurzel, Descriptor-Regeln, Collector-Settings)
+    // - pro Datei: Inhalts-Hash, zuletzt gesehen mit Größe/Schreibzeit
+    // - pro (Extractor-Id, Version, Datei): Facts + Spans für genau diesen Hash
+    // - letztes Extract-Ergebnis, damit ein unveränderter Baum direkt zu
+    //   SourceAssemble springen kann
+    //
+    // Fehlt die Datei oder passt die Version nicht, ist der Cache einfach leer.
+    // Lesende Methoden sind threadsicher, schreibende nur seriell aufrufen.
+    class SourceCache
+    {
+    public:
+        // Facts einer Datei für einen Extractor. extractor/file/group sind im
+        // Cache bedeutungslos (werden beim Einfügen neu gesetzt), spanBegin ist
+        // relativ zu spans.
+        struct FileFacts
+        {
+            std::uint64_t hash = 0;
+            std::vector<extract::ExtractFact> facts;
+            std::vector<extract::TextSpan> spans;
+        };
+
+        struct FileStat
+        {
+            std::uint64_t size = 0;
+            std::int64_t writeTime = 0;
+            std::uint64_t hash = 0;
+        };
+
+        explicit SourceCache(std::filesystem::path file = {});
+
+        void setFile(std::filesystem::path file) { m_file = std::move(file); }
+        const std::filesystem::path& file() const { return m_file; }
+
+        // false nur bei Lese-/Formatfehlern (nicht fatal, Cache ist danach leer)
+        bool load(std::string* err);
+
+        // schreibt nur, wenn sich seit load() etwas geändert hat (tmp + rename)
+        bool save(std::string* err);
+
+        void clear();
+
+        // ---------------------------------------------------------------
+        // Baum (Scan + Collect)
+        // ---------------------------------------------------------------
+
+        // gleiche Pfade in gleicher Reihenfolge -> Gruppen wiederverwendbar
+        bool sameFiles(std::uint64_t treeKey, const data::source::SourceIndexList& index) const;
+
+        // zusätzlich gleiche Größe/Schreibzeit -> Extract-Ergebnis wiederverwendbar
+        bool sameTree(std::uint64_t treeKey, const data::source::SourceIndexList& index) const;
+
+        // Gruppen mit den Einträgen des aktuellen Scans (nur nach sameFiles)
+        bool restoreGroups(const data::source::SourceIndexList& index,
+                           std::vector<data::source::SourceGroup>& out) const;
+
+        void storeTree(std::uint64_t treeKey,
+                       const data::source::SourceIndexList& index,
+                       const std::vector<data::source::SourceGroup>& groups);
+
+        // ---------------------------------------------------------------
+        // Extract
+        // ---------------------------------------------------------------
+
+        // bekannter Inhalts-Hash, wenn Größe und Schreibzeit unverändert sind
+        bool knownHash(const data::source::SourceFileEntry& file, std::uint64_t& hash) const;
+
+        const FileFacts* findFacts(std::string_view extractorId, int version, std::string_view relPath) const;
+
+        // cached Facts mit den Tabellen-Indizes aus ctx an out anhängen
+        static void appendFacts(const FileFacts& cached, const extract::FactContext& ctx, extract::ExtractFacts& out);
+
+        // lokale Facts eines Items (Spans ab 0) als Cache-Eintrag
+        static FileFacts makeFileFacts(std::uint64_t hash, const extract::ExtractFacts& local);
+
+        // ersetzt alle Datei-/Fact-Einträge; was der Lauf nicht mehr
+        // angefasst hat (gelöschte Dateien, alte Extractor-Versionen), fällt raus
+        struct FactsEntry
+        {
+            std::string extractorId;
+            int version = 1;
+            std::string relPath;
+            FileFacts facts;
+        };
+        void replaceExtract(std::unordered_map<std::string, FileStat> files,
+                            std::vector<FactsEntry> facts);
+
+        // Letztes Ergebnis, nur wenn die Extractor-Liste (Id + Version) passt
+        bool restoreResult(const std::vector<extract::ExtractorInfo>& extractors,
+                           extract::ExtractFacts& out) const;
+
+        void storeResult(const extract::ExtractFacts& facts);
+
+        // ---------------------------------------------------------------
+
+        // FNV-1a über einen beschreibenden String (treeKey o.ä.)
+        static std::uint64_t keyOf(std::string_view description);
+
+        std::size_t fileCount() const { return m_fileStats.size(); }
+        std::size_t factsEntryCount() const { return m_facts.size(); }
+
+    private:
+        struct TreeFile
+        {
+            std::string relPath;      // generic
+            std::uint64_t size = 0;
+            std::int64_t writeTime = 0;
+        };
+
+        struct TreeGroup
+        {
+            std::string id;
+            std::string category;
+            std::vector<std::string> matchedDescriptorIds;
+            std::string baseDirectory;
+            std::vector<std::uint32_t> files;   // Index in m_treeFiles
+        };
+
+        static std::string factsKey(std::string_view extractorId, int version, std::string_view relPath);
+
+        std::filesystem::path m_file;
+        bool m_dirty = false;
+
+        bool m_hasTree = false;
+        std::uint64_t m_treeKey = 0;
+        std::vector<TreeFile> m_treeFiles;
+        std::vector<TreeGroup> m_treeGroups;
+
+        std::unordered_map<std::string, FileStat> m_fileStats;   // relPath -> Stat + Hash
+        std::unordered_map<std::string, FactsEntry> m_facts;     // factsKey -> Facts
+
+        bool m_hasResult = false;
+        extract::ExtractFacts m_result;
+    };
+}
@@ -4,8 +4,20 @@
 #include "core/source/extract/schema/SubMeshSchemaExtractor.h"
 #include "core/source/extract/schema/DrawCallSchemaExtractor.h"
 
+#include "core/source/extract/util/TextUnit.h"
+#include "core/source/cache/SourceCache.h"
+#include "core/TaskSystem.h"
+
+#include <string>
+#include <unordered_map>
+
 namespace core::source::extract
 {
+    SourceExtractor::SourceExtractor()
+        : SourceExtractor(Settings{})
+    {
+    }
+
     SourceExtractor::SourceExtractor(Settings s)
         : m_settings(std::move(s))
     {
@@ -26,12 +38,207 @@ namespace core::source::extract
             m_extractors.emplace_back(std::make_unique<DrawCallSchemaExtractor>());
     }
 
+    std::string SourceExtractor::Stats::summary() const
+    {
+        return "files=" + std::to_string(files) +
+               " reused=" + std::to_string(filesReused) +
+               " loaded=" + std::to_string(filesLoaded) +
+               " items(cached/extracted)=" + std::to_string(itemsReused) +
+               "/" + std::to_string(itemsExtracted);
+    }
+
+    std::vector<ExtractorInfo> SourceExtractor::extractorInfos() const
+    {
+        std::vector<ExtractorInfo> out;
+        out.reserve(m_extractors.size());
+        for (const auto& ex : m_extractors)
+            out.push_back({ ex->id(), ex->version() });
+        return out;
+    }
+
     void SourceExtractor::extract(
         const std::vector<data::source::SourceGroup>& groups,
-        std::vector<ExtractFact>& outFacts
+        ExtractFacts& out,
+        cache::SourceCache* cache,
+        Stats* stats
     ) const
     {
+        out.clear();
+
+        // (1) Arbeitsliste in serieller Reihenfolge (Extractor, Gruppe, Datei),
+        //     gleiche Dateien (absolutePath) teilen sich einen Unit-Slot.
+        //     Dabei werden die Tabellen interniert: fileId == Unit-Index.
+        struct WorkItem
+        {
+            const RuleExtractorBase* extractor = nullptr;
+            const data::source::SourceGroup* group = nullptr;
+            const data::source::SourceFileEntry* file = nullptr;
+            std::uint16_t extractorId = 0;
+            std::uint32_t groupId = 0;
+            std::uint32_t fileId = 0;
+        };
+
+        std::vector<WorkItem> items;
+        std::vector<const data::source::SourceFileEntry*> units;   // eindeutige Dateien
+        std::vector<std::vector<std::size_t>> unitItems;           // Items pro Datei
+        std::unordered_map<std::string, std::size_t> unitIndex;
+        std::unordered_map<const data::source::SourceGroup*, std::uint32_t> groupIndex;
+
         for (const auto& ex : m_extractors)
-            ex->extract(groups, outFacts);
+        {
+            const auto extractorId = static_cast<std::uint16_t>(out.extractors.size());
+            out.extractors.push_back({ ex->id(), ex->version() });
+
+            for (const auto& g : groups)
+            {
+                for (const auto& f : g.files)
+                {
+                    if (!ex->wantsFile(g, f))
+                        continue;
+
+                    auto [it, inserted] = unitIndex.try_emplace(f.absolutePath.generic_string(), units.size());
+                    if (inserted)
+                    {
+                        units.push_back(&f);
+                        unitItems.emplace_back();
+                        out.files.push_back({ f.absolutePath, f.relativePath.generic_string() });
+                    }
+
+                    auto [git, gInserted] = groupIndex.try_emplace(&g, static_cast<std::uint32_t>(out.groups.size()));
+                    if (gInserted)
+                        out.groups.push_back(g.id);
+
+                    unitItems[it->second].push_back(items.size());
+                    items.push_back({ ex.get(), &g, &f, extractorId, git->second, static_cast<std::uint32_t>(it->second) });
+                }
+            }
+        }
+
+        // (2) Pro Datei: 1x laden, alle Extractoren darauf, Facts in den Slot des Items.
+        //     Cache wird hier nur gelesen (threadsicher), geschrieben wird in (4).
+        std::vector<ExtractFacts> slots(items.size());
+        std::vector<std::uint8_t> itemCached(items.size(), 0);
+        std::vector<std::uint64_t> unitHash(units.size(), 0);
+        std::vector<std::uint8_t> unitLoaded(units.size(), 0);
+
+        auto ctxOf = [&](const WorkItem& w)
+        {
+            return FactContext{ *w.group, *w.file, w.extractorId, w.groupId, w.fileId };
+        };
+
+        auto cachedFacts = [&](const WorkItem& w, std::uint64_t hash) -> const cache::SourceCache::FileFacts*
+        {
+            const auto* cf = cache->findFacts(w.extractor->id(), w.extractor->version(), out.files[w.fileId].relativePath);
+            return (cf && cf->hash == hash) ? cf : nullptr;
+        };
+
+        auto runUnits = [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t u = begin; u < end; ++u)
+            {
+                // Größe/Schreibzeit unverändert und alle Items im Cache -> Datei nicht lesen
+                std::uint64_t hash = 0;
+                if (cache && cache->knownHash(*units[u], hash))
+                {
+                    std::vector<const cache::SourceCache::FileFacts*> hits;
+                    hits.reserve(unitItems[u].size());
+                    for (std::size_t i : unitItems[u])
+                    {
+                        const auto* cf = cachedFacts(items[i], hash);
+                        if (!cf)
+                            break;
+                        hits.push_back(cf);
+                    }
+
+                    if (hits.size() == unitItems[u].size())
+                    {
+                        unitHash[u] = hash;
+                        for (std::size_t k = 0; k < hits.size(); ++k)
+                        {
+                            const std::size_t i = unitItems[u][k];
+                            cache::SourceCache::appendFacts(*hits[k], ctxOf(items[i]), slots[i]);
+                            itemCached[i] = 1;
+                        }
+                        continue;
+                    }
+                }
+
+                const auto unit = util::TextUnit::load(units[u]->absolutePath, units[u]->relativePath);
+                unitLoaded[u] = 1;
+                unitHash[u] = util::contentHash(unit.content);
+
+                for (std::size_t i : unitItems[u])
+                {
+                    const WorkItem& w = items[i];
+                    if (cache)
+                    {
+                        // z.B. nur Schreibzeit geändert (Checkout), Inhalt gleich
+                        if (const auto* cf = cachedFacts(w, unitHash[u]))
+                        {
+                            cache::SourceCache::appendFacts(*cf, ctxOf(w), slots[i]);
+                            itemCached[i] = 1;
+                            continue;
+                        }
+                    }
+                    w.extractor->extractFile(ctxOf(w), unit, slots[i]);
+                }
+            }
+        };
+
+        if (m_settings.parallel && units.size() > 1)
+            core::TaskSystem::instance().parallelFor(units.size(), 1, runUnits);
+        else
+            runUnits(0, units.size());
+
+        // (3) Cache auf genau diesen Lauf setzen (vor dem Merge, Slots sind noch lokal)
+        if (cache)
+        {
+            std::unordered_map<std::string, cache::SourceCache::FileStat> fileStats;
+            fileStats.reserve(units.size());
+            for (std::size_t u = 0; u < units.size(); ++u)
+            {
+                // leerer Inhalt bei Größe > 0 -> Lesefehler, Hash nicht merken
+                if (unitLoaded[u] && units[u]->size > 0 && unitHash[u] == util::contentHash({}))
+                    continue;
+                fileStats[out.files[u].relativePath] = { units[u]->size, units[u]->writeTime, unitHash[u] };
+            }
+
+            std::vector<cache::SourceCache::FactsEntry> entries;
+            entries.reserve(items.size());
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                const WorkItem& w = items[i];
+                if (!fileStats.count(out.files[w.fileId].relativePath))
+                    continue;
+
+                cache::SourceCache::FactsEntry e;
+                e.extractorId = w.extractor->id();
+                e.version = w.extractor->version();
+                e.relPath = out.files[w.fileId].relativePath;
+                e.facts = cache::SourceCache::makeFileFacts(unitHash[w.fileId], slots[i]);
+                entries.push_back(std::move(e));
+            }
+
+            cache->replaceExtract(std::move(fileStats), std::move(entries));
+        }
+
+        if (stats)
+        {
+            *stats = {};
+            stats->files = units.size();
+            for (std::size_t u = 0; u < units.size(); ++u)
+                (unitLoaded[u] ? stats->filesLoaded : stats->filesReused)++;
+            for (std::size_t i = 0; i < items.size(); ++i)
+                (itemCached[i] ? stats->itemsReused : stats->itemsExtracted)++;
+        }
+
+        // (4) Deterministischer Merge
+        std::size_t total = 0;
+        for (const auto& s : slots)
+            total += s.facts.size();
+        out.facts.reserve(total);
+
+        for (auto& s : slots)
+            out.appendFacts(std::move(s));
     }
 }
@@ -1,11 +1,17 @@
 #pragma once
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "data/source/collect/SourceGroup.h"
 #include "data/source/extract/ExtractFact.h"
 #include "core/source/extract/schema/RuleExtractorBase.h"
 
+namespace core::source::cache
+{
+    class SourceCache;
+}
+
 namespace core::source::extract
 {
     class SourceExtractor
@@ -16,18 +22,46 @@ namespace core::source::extract
             // v1: feste Reihenfolge, deterministisch
             bool enableSubMeshSchema = true;
             bool enableDrawCallSchema = true;
+
+            // Dateien parallel auf dem TaskSystem laden/extrahieren.
+            // Facts landen immer in der seriellen Reihenfolge (Extractor, Gruppe, Datei).
+            bool parallel = true;
         };
 
-        explicit SourceExtractor(Settings s = Settings{});
+        struct Stats
+        {
+            std::size_t files = 0;
+            std::size_t filesReused = 0;      // nicht gelesen (Größe/Schreibzeit bekannt, alle Facts im Cache)
+            std::size_t filesLoaded = 0;
+            std::size_t itemsReused = 0;      // (Extractor, Datei) aus dem Cache
+            std::size_t itemsExtracted = 0;
+
+            std::string summary() const;
+        };
+
+        SourceExtractor();
+        explicit SourceExtractor(Settings s);
 
         // EINZIGE Pipeline-Schnittstelle
+        // Per-File: jede Datei wird genau 1x als TextUnit geladen und von allen
+        // interessierten Extractoren nacheinander genutzt, danach freigegeben.
+        // out wird überschrieben (Facts + Tabellen)
+        //
+        // Mit cache: Facts pro (Extractor-Id/Version, Datei, Inhalts-Hash) werden
+        // wiederverwendet; ungeänderte Dateien (Größe/Schreibzeit) werden gar nicht
+        // gelesen. Danach enthält cache genau die Einträge dieses Laufs.
         void extract(
             const std::vector<data::source::SourceGroup>& groups,
-            std::vector<ExtractFact>& outFacts
+            ExtractFacts& out,
+            cache::SourceCache* cache = nullptr,
+            Stats* stats = nullptr
         ) const;
 
         std::size_t extractorCount() const { return m_extractors.size(); }
 
+        // Id + Version in Extract-Reihenfolge (entspricht ExtractFacts::extractors)
+        std::vector<ExtractorInfo> extractorInfos() const;
+
     private:
         Settings m_settings;
 
@@ -1,6 +1,11 @@
 #include "DrawCallSchemaExtractor.h"
 #include "core/source/extract/util/TextUnit.h"
-#include <regex>
+#include "core/source/extract/util/PatternScanner.h"
+#include "core/source/index/TokenIndexBuilder.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <string_view>
 
 namespace core::source::extract::rules
 {
@@ -9,104 +14,121 @@ namespace core::source::extract::rules
         return p.generic_string().find(token) != std::string::npos;
     }
 
-    void DrawCallSchemaExtractor::extract(
-        const std::vector<data::source::SourceGroup>& groups,
-        std::vector<ExtractFact>& outFacts
+    // Regeln (v2) als Abfragen auf den TokenIndex der Datei: Identifier in
+    // Kommentaren, String-Literalen und unter "#if 0" zählen nicht mehr, und
+    // Treffer beginnen immer an einer Token-Grenze. Was dem Namen folgen muss,
+    // wird wie in v1 im Text geprüft (nur Whitespace dazwischen).
+    //   DIP          DrawIndexedPrimitive\s*\(
+    //   TriList      D3DPT_TRIANGLELIST
+    //   Mapping      m_nStartVertex|m_nPrimitiveCount|m_nTextureID
+    //   SetGroup     SetGroup\s*\(
+    //   SetTextureEx SetTextureEx\s*\(
+    //   RenderCall   Render\s*\(\s*pd3dDevice
+    static void findHits(const data::source::TokenIndex& index,
+                          std::string_view text,
+                          std::initializer_list<std::string_view> names,
+                          const std::vector<util::PatternScanner::Follow>& follow,
+                          std::vector<TextSpan>& out)
+    {
+        out.clear();
+        for (std::string_view name : names)
+        {
+            for (const auto& occ : index.find(name))
+            {
+                if (occ.disabled)
+                    continue;
+
+                std::size_t end = occ.offset + name.size();
+                if (!follow.empty() && !util::PatternScanner::matchFollow(text, end, follow, &end))
+                    continue;
+                out.push_back({ occ.offset, static_cast<std::uint32_t>(end - occ.offset) });
+            }
+        }
+
+        // mehrere Namen: zurück in Quelltext-Reihenfolge
+        if (names.size() > 1)
+            std::sort(out.begin(), out.end(), [](const TextSpan& a, const TextSpan& b) { return a.offset < b.offset; });
+    }
+
+    bool DrawCallSchemaExtractor::wantsFile(
+        const data::source::SourceGroup&,
+        const data::source::SourceFileEntry& f
+    ) const
+    {
+        const auto& rel = f.relativePath;
+        return relContains(rel, "_Common/Object3D.cpp") ||
+               relContains(rel, "_Common/ModelObject.cpp") ||
+               relContains(rel, "_Common/Obj.cpp");
+    }
+
+    void DrawCallSchemaExtractor::extractFile(
+        const FactContext& ctx,
+        const util::TextUnit& unit,
+        ExtractFacts& out
     ) const
     {
         using namespace core::source::extract::util;
 
-        // Patterns (v1)
-        std::regex reDIP(R"(DrawIndexedPrimitive\s*\()");
-        std::regex reTriList(R"(D3DPT_TRIANGLELIST)");
-        std::regex reSetGroup(R"(\bSetGroup\s*\()");
-        std::regex reSetTextureEx(R"(\bSetTextureEx\s*\()");
+        const auto& rel = ctx.file.relativePath;
+
+        const bool isObject3Dcpp   = relContains(rel, "_Common/Object3D.cpp");
+        const bool isModelObjectcpp= relContains(rel, "_Common/ModelObject.cpp");
+        const bool isObjcpp        = relContains(rel, "_Common/Obj.cpp");
 
-        for (const auto& g : groups)
+        // Snippet wird nicht mehr hier gebaut: Evidenz-Span + Zeilenkontext reichen (FactText)
+        auto emitHit = [&](FactType type, const TextSpan& hit, float conf, int lines=2)
         {
-            for (const auto& f : g.files)
-            {
-                const auto rel = f.relativePath;
+            ExtractFact fact = ctx.make(type, unit.lineOfOffset(hit.offset), conf);
+            fact.evidence = hit;
+            fact.snippetContext = static_cast<std::uint8_t>(lines);
+            out.facts.push_back(fact);
+        };
 
-                const bool isObject3Dcpp   = relContains(rel, "_Common/Object3D.cpp");
-                const bool isModelObjectcpp= relContains(rel, "_Common/ModelObject.cpp");
-                const bool isObjcpp        = relContains(rel, "_Common/Obj.cpp");
+        // Index nur für diese Datei, aus dem bereits geladenen TextUnit
+        data::source::TokenIndex tokens;
+        index::TokenIndexBuilder::addFile(ctx.file, unit, tokens);
 
-                if (!isObject3Dcpp && !isModelObjectcpp && !isObjcpp)
-                    continue;
+        const std::vector<PatternScanner::Follow> call = { { "(" } };
+        std::vector<TextSpan> hits;
 
-                auto unit = TextUnit::load(f.absolutePath, rel);
-
-                auto emitHit = [&](const char* factType, std::size_t off, float conf, int ctx=2)
-                {
-                    int line = unit.lineOfOffset(off);
-                    auto snip = unit.snippetAtLine(line, ctx);
-
-                    ExtractFact fact;
-                    fact.factType = factType;
-                    fact.extractorId = id();
-                    fact.extractorVersion = version();
-                    fact.file = rel.generic_string();
-                    fact.line = line;
-                    fact.confidence = conf;
-                    fact.payload =
-                        std::string("{\"groupId\":\"") + jsonEscape(g.id) +
-                        "\",\"snippet\":\"" + jsonEscape(snip) + "\"}";
-                    outFacts.emplace_back(std::move(fact));
-                };
-
-                // (A) Object3D.cpp: DrawIndexedPrimitive signals => per-submesh drawcall
-                if (isObject3Dcpp)
-                {
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reDIP);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("DrawCall.Invoke.DrawIndexedPrimitive", (std::size_t)it->position(), 1.0f);
-                        emitHit("DrawCall.PerSubMesh", (std::size_t)it->position(), 0.9f);
-                    }
-
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reTriList);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("DrawCall.PrimitiveType.TriangleList", (std::size_t)it->position(), 1.0f, 1);
-                    }
-
-                    // Mapping hint: block fields used as DIP args (v1: keyword based)
-                    std::regex reMapping(R"(\b(m_nStartVertex|m_nPrimitiveCount|m_nTextureID)\b)");
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reMapping);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("DrawCall.Mapping.MaterialBlockField", (std::size_t)it->position(), 0.8f, 1);
-                    }
-                }
-
-                // (B) Obj.cpp: LOD grouping and TextureEx (affects which drawcalls happen / material variant)
-                if (isObjcpp)
-                {
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reSetGroup);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("DrawCall.Grouping.SetGroup", (std::size_t)it->position(), 0.95f, 2);
-                    }
-
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reSetTextureEx);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("Material.Variant.SetTextureEx", (std::size_t)it->position(), 0.9f, 2);
-                    }
-                }
-
-                // (C) ModelObject.cpp: bridge call chain (CModelObject -> Object3D render)
-                if (isModelObjectcpp)
-                {
-                    std::regex reRenderCall(R"(\bRender\s*\(\s*pd3dDevice)");
-                    for (auto it = std::sregex_iterator(unit.content.begin(), unit.content.end(), reRenderCall);
-                         it != std::sregex_iterator(); ++it)
-                    {
-                        emitHit("DrawCall.Delegation.ModelObjectRender", (std::size_t)it->position(), 0.7f, 2);
-                    }
-                }
+        // (A) Object3D.cpp: DrawIndexedPrimitive signals => per-submesh drawcall
+        if (isObject3Dcpp)
+        {
+            findHits(tokens, unit.content, { "DrawIndexedPrimitive" }, call, hits);
+            for (const auto& hit : hits)
+            {
+                emitHit(FactType::DrawCallInvokeDrawIndexedPrimitive, hit, 1.0f);
+                emitHit(FactType::DrawCallPerSubMesh, hit, 0.9f);
             }
+
+            findHits(tokens, unit.content, { "D3DPT_TRIANGLELIST" }, {}, hits);
+            for (const auto& hit : hits)
+                emitHit(FactType::DrawCallPrimitiveTypeTriangleList, hit, 1.0f, 1);
+
+            // Mapping hint: block fields used as DIP args (v1: keyword based)
+            findHits(tokens, unit.content, { "m_nStartVertex", "m_nPrimitiveCount", "m_nTextureID" }, {}, hits);
+            for (const auto& hit : hits)
+                emitHit(FactType::DrawCallMappingMaterialBlockField, hit, 0.8f, 1);
+        }
+
+        // (B) Obj.cpp: LOD grouping and TextureEx (affects which drawcalls happen / material variant)
+        if (isObjcpp)
+        {
+            findHits(tokens, unit.content, { "SetGroup" }, call, hits);
+            for (const auto& hit : hits)
+                emitHit(FactType::DrawCallGroupingSetGroup, hit, 0.95f, 2);
+
+            findHits(tokens, unit.content, { "SetTextureEx" }, call, hits);
+            for (const auto& hit : hits)
+                emitHit(FactType::MaterialVariantSetTextureEx, hit, 0.9f, 2);
+        }
+
+        // (C) ModelObject.cpp: bridge call chain (CModelObject -> Object3D render)
+        if (isModelObjectcpp)
+        {
+            findHits(tokens, unit.content, { "Render" }, { { "(" }, { "pd3dDevice" } }, hits);
+            for (const auto& hit : hits)
+                emitHit(FactType::DrawCallDelegationModelObjectRender, hit, 0.7f, 2);
         }
     }
 }
@@ -7,9 +7,13 @@ namespace core::source::extract::rules
     {
     public:
         std::string id() const override { return "DrawCallSchema"; }
-        int version() const override { return 1; }
+        int version() const override { return 2; } // v2: Regeln über den TokenIndex
 
-        void extract(const std::vector<data::source::SourceGroup>& groups,
-                     std::vector<ExtractFact>& outFacts) const override;
+        bool wantsFile(const data::source::SourceGroup& group,
+                       const data::source::SourceFileEntry& file) const override;
+
+        void extractFile(const FactContext& ctx,
+                         const util::TextUnit& unit,
+                         ExtractFacts& out) const override;
     };
 }
@@ -4,9 +4,34 @@
 
 #include "data/source/collect/SourceGroup.h"
 #include "data/source/extract/ExtractFact.h"
+#include "core/source/extract/util/TextUnit.h"
 
 namespace core::source::extract
 {
+    // Was ein Extractor über die aktuelle Datei wissen muss, inkl. der
+    // bereits internierten Tabellen-Indizes (siehe ExtractFacts)
+    struct FactContext
+    {
+        const data::source::SourceGroup& group;
+        const data::source::SourceFileEntry& file;
+
+        std::uint16_t extractor = 0;
+        std::uint32_t groupId = 0;
+        std::uint32_t fileId = 0;
+
+        ExtractFact make(FactType type, int line, float confidence) const
+        {
+            ExtractFact f;
+            f.type = type;
+            f.extractor = extractor;
+            f.file = fileId;
+            f.group = groupId;
+            f.line = line;
+            f.confidence = confidence;
+            return f;
+        }
+    };
+
     class RuleExtractorBase
     {
     public:
@@ -15,9 +40,51 @@ namespace core::source::extract
         virtual std::string id() const = 0;
         virtual int version() const = 0;
 
-        virtual void extract(
-            const std::vector<data::source::SourceGroup>& groups,
-            std::vector<ExtractFact>& outFacts
+        // Per-File-Arbeitsmodell: SourceExtractor lädt jede Datei genau 1x und
+        // ruft extractFile() aller interessierten Extractoren darauf auf
+        // (parallel über Dateien -> extractFile muss const/threadsafe sein).
+        virtual bool wantsFile(const data::source::SourceGroup& group,
+                               const data::source::SourceFileEntry& file) const = 0;
+
+        // Facts/Spans nach out.facts/out.spans (Tabellen von out werden nicht angefasst)
+        virtual void extractFile(
+            const FactContext& ctx,
+            const util::TextUnit& unit,
+            ExtractFacts& out
         ) const = 0;
+
+        // Standalone (seriell, lädt selbst): alle Gruppen/Dateien in Reihenfolge, out wird überschrieben
+        void extract(
+            const std::vector<data::source::SourceGroup>& groups,
+            ExtractFacts& out
+        ) const
+        {
+            out.clear();
+            out.extractors.push_back({ id(), version() });
+
+            for (const auto& g : groups)
+            {
+                bool groupInterned = false;
+                for (const auto& f : g.files)
+                {
+                    if (!wantsFile(g, f))
+                        continue;
+
+                    if (!groupInterned)
+                    {
+                        out.groups.push_back(g.id);
+                        groupInterned = true;
+                    }
+                    out.files.push_back({ f.absolutePath, f.relativePath.generic_string() });
+
+                    const FactContext ctx{ g, f, 0,
+                                           static_cast<std::uint32_t>(out.groups.size() - 1),
+                                           static_cast<std::uint32_t>(out.files.size() - 1) };
+
+                    const auto unit = util::TextUnit::load(f.absolutePath, f.relativePath);
+                    extractFile(ctx, unit, out);
+                }
+            }
+        }
     };
 }
@@ -1,6 +1,8 @@
 #include "SubMeshSchemaExtractor.h"
 #include "core/source/extract/util/TextUnit.h"
-#include <regex>
+#include "core/source/extract/util/PatternScanner.h"
+
+#include <cstring>
 
 namespace core::source::extract::rules
 {
@@ -22,90 +24,218 @@ namespace core::source::extract::rules
         return false;
     }
 
-    void SubMeshSchemaExtractor::extract(
-        const std::vector<data::source::SourceGroup>& groups,
-        std::vector<ExtractFact>& outFacts
+    // Patterns (v1)
+    enum SubMeshTag : int
+    {
+        kTagStruct,         // struct\s+MATERIAL_BLOCK\s*\{
+        kTagRead,           // Read\s*\(
+    };
+
+    static const util::PatternScanner& subMeshScanner()
+    {
+        using util::PatternScanner;
+
+        static const PatternScanner scanner = []
+        {
+            PatternScanner s;
+            s.add({ "struct", kTagStruct, false, false, { { "MATERIAL_BLOCK", true }, { "{" } } });
+            s.add({ "Read", kTagRead, false, false, { { "(" } } });
+            s.build();
+            return s;
+        }();
+        return scanner;
+    }
+
+    // Feld-Deklaration ab pos, entspricht
+    //   ([A-Za-z_]\w*(?:\s*::\s*[A-Za-z_]\w*)?(?:\s*[\*\&])?)\s+([A-Za-z_]\w*)\s*(?:\[[^\]]+\])?\s*;
+    // (Alternativen in Regex-Reihenfolge). Liefert Name und Ende hinter ';'.
+    static bool matchFieldAt(std::string_view s, std::size_t pos, std::string_view* name, std::size_t* end)
+    {
+        using util::PatternScanner;
+
+        auto ident = [&](std::size_t p) -> std::size_t
+        {
+            if (p >= s.size() || !PatternScanner::isIdentStart(s[p])) return std::string_view::npos;
+            ++p;
+            while (p < s.size() && PatternScanner::isWordChar(s[p])) ++p;
+            return p;
+        };
+
+        const std::size_t typeEnd = ident(pos);
+        if (typeEnd == std::string_view::npos) return false;
+
+        // optional ::qualifier
+        std::size_t qualEnd = std::string_view::npos;
+        {
+            std::size_t p = PatternScanner::skipSpace(s, typeEnd);
+            if (s.compare(p, 2, "::") == 0)
+                qualEnd = ident(PatternScanner::skipSpace(s, p + 2));
+        }
+
+        auto tail = [&](std::size_t p) -> bool
+        {
+            // optional [*&]
+            auto rest = [&](std::size_t q) -> bool
+            {
+                const std::size_t nameBegin = PatternScanner::skipSpace(s, q);
+                if (nameBegin == q) return false;
+                const std::size_t nameEnd = ident(nameBegin);
+                if (nameEnd == std::string_view::npos) return false;
+
+                std::size_t r = PatternScanner::skipSpace(s, nameEnd);
+                if (r < s.size() && s[r] == '[')
+                {
+                    const std::size_t close = s.find(']', r + 1);
+                    if (close != std::string_view::npos && close > r + 1)
+                    {
+                        const std::size_t semi = PatternScanner::skipSpace(s, close + 1);
+                        if (semi < s.size() && s[semi] == ';')
+                        {
+                            *name = s.substr(nameBegin, nameEnd - nameBegin);
+                            *end = semi + 1;
+                            return true;
+                        }
+                    }
+                }
+                if (r < s.size() && s[r] == ';')
+                {
+                    *name = s.substr(nameBegin, nameEnd - nameBegin);
+                    *end = r + 1;
+                    return true;
+                }
+                return false;
+            };
+
+            const std::size_t q = PatternScanner::skipSpace(s, p);
+            if (q < s.size() && (s[q] == '*' || s[q] == '&') && rest(q + 1))
+                return true;
+            return rest(p);
+        };
+
+        if (qualEnd != std::string_view::npos && tail(qualEnd))
+            return true;
+        return tail(typeEnd);
+    }
+
+    bool SubMeshSchemaExtractor::wantsFile(
+        const data::source::SourceGroup& g,
+        const data::source::SourceFileEntry& f
+    ) const
+    {
+        const auto& rel = f.relativePath;
+        if (!fileEndsWith(rel, "Object3D.h") && !fileEndsWith(rel, "Object3D.cpp"))
+            return false;
+
+        return groupLikelyCommonObject3D(g);
+    }
+
+    void SubMeshSchemaExtractor::extractFile(
+        const FactContext& ctx,
+        const util::TextUnit& unit,
+        ExtractFacts& out
     ) const
     {
         using namespace core::source::extract::util;
 
-        for (const auto& g : groups)
-        {
-            if (!groupLikelyCommonObject3D(g))
-                continue;
+        const PatternScanner& scanner = subMeshScanner();
+        std::vector<PatternScanner::Hit> hits;
+
+        const auto& rel = ctx.file.relativePath;
+
+        const bool isHeader = fileEndsWith(rel, "Object3D.h");
+        const bool isSource = fileEndsWith(rel, "Object3D.cpp");
 
-            for (const auto& f : g.files)
+        std::string_view text = unit.content;
+        scanner.scan(text, hits);
+
+        // (A) struct MATERIAL_BLOCK fields (header)
+        if (isHeader)
+        {
+            // Capture body of struct MATERIAL_BLOCK {...}; (erster Treffer, Body bis zum ersten "};")
+            for (const auto& h : hits)
             {
-                const auto rel = f.relativePath;
-                if (!fileEndsWith(rel, "Object3D.h") && !fileEndsWith(rel, "Object3D.cpp"))
+                if (h.tag != kTagStruct)
+                    continue;
+
+                const std::size_t close = text.find("};", h.end);
+                if (close == std::string_view::npos)
                     continue;
 
-                auto unit = TextUnit::load(f.absolutePath, rel);
+                std::string_view body = text.substr(h.end, close - h.end);
 
-                // (A) struct MATERIAL_BLOCK fields (header)
-                if (fileEndsWith(rel, "Object3D.h"))
+                // field lines: very simple v1 - find "<type> <name>;" and collect names (als Spans)
+                ExtractFact fact = ctx.make(FactType::SubMeshBlockStruct, 1, 1.0f);
+                fact.evidence = { (std::uint32_t)h.begin, (std::uint32_t)(close + 2 - h.begin) };
+                fact.spanBegin = (std::uint32_t)out.spans.size();
+
+                const std::size_t bodyOffset = h.end;
+                for (std::size_t pos = 0; pos < body.size();)
                 {
-                    // Capture body of struct MATERIAL_BLOCK {...};
-                    std::regex re(R"(struct\s+MATERIAL_BLOCK\s*\{([\s\S]*?)\};)");
-                    std::smatch m;
-                    if (std::regex_search(unit.content, m, re))
+                    std::string_view name;
+                    std::size_t end = 0;
+                    if (!matchFieldAt(body, pos, &name, &end))
                     {
-                        std::string body = m[1].str();
-                        // field lines: very simple v1 - find "<type> <name>;" and collect names
-                        std::regex fieldRe(R"(([A-Za-z_]\w*(?:\s*::\s*[A-Za-z_]\w*)?(?:\s*[\*\&])?)\s+([A-Za-z_]\w*)\s*(?:\[[^\]]+\])?\s*;)");
-                        std::sregex_iterator it(body.begin(), body.end(), fieldRe), end;
-
-                        std::string fieldsJson = "[";
-                        bool first = true;
-                        for (; it != end; ++it)
-                        {
-                            std::string name = (*it)[2].str();
-                            if (!first) fieldsJson += ",";
-                            first = false;
-                            fieldsJson += "\"" + jsonEscape(name) + "\"";
-                        }
-                        fieldsJson += "]";
-
-                        ExtractFact fact;
-                        fact.factType = "SubMesh.Block.Struct";
-                        fact.extractorId = id();
-                        fact.extractorVersion = version();
-                        fact.file = rel.generic_string();
-                        fact.line = 1;
-                        fact.confidence = 1.0f;
-                        fact.payload =
-                            std::string("{\"struct\":\"MATERIAL_BLOCK\",\"fields\":") + fieldsJson + "}";
-                        outFacts.emplace_back(std::move(fact));
+                        ++pos;
+                        continue;
                     }
+
+                    const std::size_t nameOffset = bodyOffset + (std::size_t)(name.data() - body.data());
+                    out.spans.push_back({ (std::uint32_t)nameOffset, (std::uint32_t)name.size() });
+                    pos = end;
                 }
 
-                // (B) file->Read of MATERIAL_BLOCK array (cpp)
-                if (fileEndsWith(rel, "Object3D.cpp"))
+                fact.spanCount = (std::uint32_t)out.spans.size() - fact.spanBegin;
+                out.facts.push_back(fact);
+                break;
+            }
+        }
+
+        // (B) file->Read of MATERIAL_BLOCK array (cpp)
+        if (isSource)
+        {
+            // Look for Read(... sizeof(MATERIAL_BLOCK) * ... );
+            // = Read\s*\([^;]*sizeof\s*\(\s*MATERIAL_BLOCK\s*\)[^;]*\)\s*;
+            std::size_t consumed = 0;
+            for (const auto& h : hits)
+            {
+                if (h.tag != kTagRead || h.begin < consumed)
+                    continue;
+
+                // Statement endet am ersten ';' nach "Read("
+                const std::size_t semi = text.find(';', h.end);
+                if (semi == std::string_view::npos)
+                    continue;
+
+                // letztes Nicht-Whitespace vor ';' muss ')' sein
+                std::size_t lastParen = semi;
+                while (lastParen > h.end && PatternScanner::isSpace(text[lastParen - 1]))
+                    --lastParen;
+                if (lastParen == h.end || text[lastParen - 1] != ')')
+                    continue;
+                --lastParen;
+
+                // sizeof(MATERIAL_BLOCK) muss vor dieser ')' enden
+                bool hasSizeof = false;
+                static const std::vector<PatternScanner::Follow> sizeofArgs = { { "(" }, { "MATERIAL_BLOCK" }, { ")" } };
+                std::string_view stmt = text.substr(0, lastParen);
+                for (std::size_t p = stmt.find("sizeof", h.end); p != std::string_view::npos; p = stmt.find("sizeof", p + 1))
                 {
-                    // Look for Read(... sizeof(MATERIAL_BLOCK) * ... )
-                    std::regex reRead(R"(Read\s*\([^;]*sizeof\s*\(\s*MATERIAL_BLOCK\s*\)[^;]*\)\s*;)");
-                    auto begin = std::sregex_iterator(unit.content.begin(), unit.content.end(), reRead);
-                    auto end = std::sregex_iterator();
-                    for (auto it = begin; it != end; ++it)
+                    std::size_t end = 0;
+                    if (PatternScanner::matchFollow(stmt, p + 6, sizeofArgs, &end))
                     {
-                        std::size_t off = (std::size_t)it->position();
-                        int line = unit.lineOfOffset(off);
-
-                        ExtractFact fact;
-                        fact.factType = "SubMesh.Block.ArrayRead";
-                        fact.extractorId = id();
-                        fact.extractorVersion = version();
-                        fact.file = rel.generic_string();
-                        fact.line = line;
-                        fact.confidence = 0.95f;
-
-                        auto snip = unit.snippetAtLine(line, 2);
-                        fact.payload =
-                            std::string("{\"hint\":\"Read MATERIAL_BLOCK array\",\"snippet\":\"") +
-                            jsonEscape(snip) + "\"}";
-                        outFacts.emplace_back(std::move(fact));
+                        hasSizeof = true;
+                        break;
                     }
                 }
+                if (!hasSizeof)
+                    continue;
+
+                consumed = semi + 1;
+
+                ExtractFact fact = ctx.make(FactType::SubMeshBlockArrayRead, unit.lineOfOffset(h.begin), 0.95f);
+                fact.evidence = { (std::uint32_t)h.begin, (std::uint32_t)(semi + 1 - h.begin) };
+                fact.snippetContext = 2;
+                out.facts.push_back(fact);
             }
         }
     }
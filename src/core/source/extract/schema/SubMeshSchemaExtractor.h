@@ -9,7 +9,11 @@ namespace core::source::extract::rules
         std::string id() const override { return "SubMeshSchema"; }
         int version() const override { return 1; }
 
-        void extract(const std::vector<data::source::SourceGroup>& groups,
-                     std::vector<ExtractFact>& outFacts) const override;
+        bool wantsFile(const data::source::SourceGroup& group,
+                       const data::source::SourceFileEntry& file) const override;
+
+        void extractFile(const FactContext& ctx,
+                         const util::TextUnit& unit,
+                         ExtractFacts& out) const override;
     };
 }
@@ -0,0 +1,77 @@
+#include "FactText.h"
+
+namespace core::source::extract::util
+{
+    const TextUnit& FactText::unitOf(const ExtractFact& f)
+    {
+        auto it = m_units.find(f.file);
+        if (it == m_units.end())
+        {
+            const FactFile& file = m_facts.fileOf(f);
+            it = m_units.emplace(f.file, TextUnit::load(file.absolutePath, file.relativePath)).first;
+        }
+        return it->second;
+    }
+
+    std::string_view FactText::textOf(const TextUnit& unit, const TextSpan& span) const
+    {
+        if (span.offset > unit.content.size() || span.length > unit.content.size() - span.offset)
+            return {};
+        return std::string_view(unit.content).substr(span.offset, span.length);
+    }
+
+    std::string_view FactText::evidence(const ExtractFact& f)
+    {
+        return textOf(unitOf(f), f.evidence);
+    }
+
+    std::string FactText::snippet(const ExtractFact& f)
+    {
+        return unitOf(f).snippetAtLine(f.line, f.snippetContext);
+    }
+
+    std::vector<std::string_view> FactText::spans(const ExtractFact& f)
+    {
+        const TextUnit& unit = unitOf(f);
+
+        std::vector<std::string_view> out;
+        out.reserve(f.spanCount);
+        for (std::uint32_t i = 0; i < f.spanCount; ++i)
+            out.push_back(textOf(unit, m_facts.spans[f.spanBegin + i]));
+        return out;
+    }
+
+    std::string FactText::payloadJson(const ExtractFact& f)
+    {
+        switch (f.type)
+        {
+        case FactType::SubMeshBlockStruct:
+        {
+            std::string fieldsJson = "[";
+            bool first = true;
+            for (std::string_view name : spans(f))
+            {
+                if (!first) fieldsJson += ",";
+                first = false;
+                fieldsJson += '"';
+                fieldsJson += jsonEscape(name);
+                fieldsJson += '"';
+            }
+            fieldsJson += "]";
+            return std::string("{\"struct\":\"MATERIAL_BLOCK\",\"fields\":") + fieldsJson + "}";
+        }
+
+        case FactType::SubMeshBlockArrayRead:
+            return std::string("{\"hint\":\"Read MATERIAL_BLOCK array\",\"snippet\":\"") +
+                   jsonEscape(snippet(f)) + "\"}";
+
+        case FactType::Unknown:
+        case FactType::Count:
+            return "{}";
+
+        default:
+            return std::string("{\"groupId\":\"") + jsonEscape(m_facts.groupOf(f)) +
+                   "\",\"snippet\":\"" + jsonEscape(snippet(f)) + "\"}";
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "data/source/extract/ExtractFact.h"
+#include "core/source/extract/util/TextUnit.h"
+
+namespace core::source::extract::util
+{
+    // Erzeugt Snippets/Payloads von ExtractFacts erst bei Bedarf (Log, Snapshot, Debug).
+    // Dateien werden pro fileId 1x nachgeladen und gehalten; nicht threadsafe.
+    class FactText
+    {
+    public:
+        explicit FactText(const ExtractFacts& facts) : m_facts(facts) {}
+
+        const TextUnit& unitOf(const ExtractFact& f);
+
+        // Text des Evidenz-Spans (leer, wenn die Datei sich geändert hat)
+        std::string_view evidence(const ExtractFact& f);
+
+        // snippetContext Zeilen um f.line
+        std::string snippet(const ExtractFact& f);
+
+        // Texte von f.spanBegin..spanCount (z.B. Feldnamen)
+        std::vector<std::string_view> spans(const ExtractFact& f);
+
+        // JSON-Payload im v1-Format ("groupId"/"snippet", "struct"/"fields", "hint"/"snippet")
+        std::string payloadJson(const ExtractFact& f);
+
+    private:
+        std::string_view textOf(const TextUnit& unit, const TextSpan& span) const;
+
+        const ExtractFacts& m_facts;
+        std::unordered_map<std::uint32_t, TextUnit> m_units;
+    };
+}
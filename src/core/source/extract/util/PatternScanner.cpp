@@ -0,0 +1,152 @@
+#include "PatternScanner.h"
+#include <algorithm>
+#include <deque>
+
+namespace core::source::extract::util
+{
+    int PatternScanner::add(Pattern p)
+    {
+        m_patterns.emplace_back(std::move(p));
+        m_built = false;
+        return (int)m_patterns.size() - 1;
+    }
+
+    void PatternScanner::build()
+    {
+        m_next.assign(kAlphabet, -1);
+        m_out.assign(1, {});
+
+        // (1) Trie
+        for (std::size_t pi = 0; pi < m_patterns.size(); ++pi)
+        {
+            int state = 0;
+            for (char ch : m_patterns[pi].literal)
+            {
+                const auto c = (unsigned char)ch;
+                std::int32_t& n = m_next[(std::size_t)state * kAlphabet + c];
+                if (n < 0)
+                {
+                    n = (std::int32_t)m_out.size();
+                    m_out.emplace_back();
+                    m_next.resize(m_next.size() + kAlphabet, -1);
+                }
+                state = m_next[(std::size_t)state * kAlphabet + c];
+            }
+            if (state != 0)
+                m_out[(std::size_t)state].push_back((std::int32_t)pi);
+        }
+
+        // (2) Fail-Links per BFS, fehlende Übergänge direkt auflösen (DFA)
+        const std::size_t states = m_out.size();
+        std::vector<std::int32_t> fail(states, 0);
+        m_outLink.assign(states, -1);
+
+        std::deque<std::int32_t> queue;
+        for (int c = 0; c < kAlphabet; ++c)
+        {
+            std::int32_t& n = m_next[(std::size_t)c];
+            if (n < 0) n = 0;
+            else queue.push_back(n);
+        }
+
+        while (!queue.empty())
+        {
+            const std::int32_t s = queue.front();
+            queue.pop_front();
+
+            const std::int32_t f = fail[(std::size_t)s];
+            m_outLink[(std::size_t)s] = !m_out[(std::size_t)f].empty() ? f : m_outLink[(std::size_t)f];
+
+            for (int c = 0; c < kAlphabet; ++c)
+            {
+                std::int32_t& n = m_next[(std::size_t)s * kAlphabet + c];
+                const std::int32_t viaFail = m_next[(std::size_t)f * kAlphabet + c];
+                if (n < 0)
+                {
+                    n = viaFail;
+                }
+                else
+                {
+                    fail[(std::size_t)n] = viaFail;
+                    queue.push_back(n);
+                }
+            }
+        }
+
+        m_built = true;
+    }
+
+    std::size_t PatternScanner::skipSpace(std::string_view text, std::size_t pos)
+    {
+        while (pos < text.size() && isSpace(text[pos]))
+            ++pos;
+        return pos;
+    }
+
+    bool PatternScanner::matchFollow(std::string_view text, std::size_t pos,
+                                     const std::vector<Follow>& follow, std::size_t* end)
+    {
+        for (const auto& tok : follow)
+        {
+            const std::size_t after = skipSpace(text, pos);
+            if (tok.spaceRequired && after == pos)
+                return false;
+            if (text.compare(after, tok.text.size(), tok.text) != 0)
+                return false;
+            pos = after + tok.text.size();
+        }
+        if (end) *end = pos;
+        return true;
+    }
+
+    bool PatternScanner::verify(std::string_view text, std::size_t begin, const Pattern& p, std::size_t* end) const
+    {
+        if (p.wordStart && begin > 0 && isWordChar(text[begin - 1]))
+            return false;
+
+        std::size_t pos = begin + p.literal.size();
+        if (!matchFollow(text, pos, p.follow, &pos))
+            return false;
+
+        if (p.wordEnd && pos < text.size() && isWordChar(text[pos]))
+            return false;
+
+        *end = pos;
+        return true;
+    }
+
+    void PatternScanner::scan(std::string_view text, std::vector<Hit>& out) const
+    {
+        out.clear();
+        if (!m_built || m_patterns.empty())
+            return;
+
+        const std::int32_t* next = m_next.data();
+        std::int32_t state = 0;
+
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            state = next[(std::size_t)state * kAlphabet + (unsigned char)text[i]];
+
+            for (std::int32_t s = m_out[(std::size_t)state].empty() ? m_outLink[(std::size_t)state] : state;
+                 s > 0; s = m_outLink[(std::size_t)s])
+            {
+                for (std::int32_t pi : m_out[(std::size_t)s])
+                {
+                    const Pattern& p = m_patterns[(std::size_t)pi];
+                    const std::size_t begin = i + 1 - p.literal.size();
+
+                    std::size_t end = 0;
+                    if (verify(text, begin, p, &end))
+                        out.push_back(Hit{ p.tag, pi, begin, end });
+                }
+            }
+        }
+
+        // Automat meldet nach Literal-Ende; Extractoren erwarten Quelltext-Reihenfolge
+        std::stable_sort(out.begin(), out.end(), [](const Hit& a, const Hit& b)
+        {
+            return a.begin != b.begin ? a.begin < b.begin : a.pattern < b.pattern;
+        });
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core::source::extract::util
+{
+    // Multi-Pattern-Scanner für die Schema-Extractoren (ersetzt std::regex).
+    //
+    // - alle Literale eines Extractors stecken in EINEM Aho-Corasick-Automaten,
+    //   ein Durchlauf über TextUnit::content findet alle Patterns
+    // - leichte Token-Checks statt Backtracking: \b vor/nach dem Literal und
+    //   eine Folge von Tokens, jeweils mit optionalem/erforderlichem Whitespace
+    //   davor (z.B. "Render" + "(" + "pd3dDevice" == \bRender\s*\(\s*pd3dDevice)
+    // - Treffer sind nach Offset sortiert (wie sregex_iterator)
+    class PatternScanner
+    {
+    public:
+        struct Follow
+        {
+            std::string text;         // exaktes Literal
+            bool spaceRequired = false; // \s+ statt \s* davor
+        };
+
+        struct Pattern
+        {
+            std::string literal;      // Anker für den Automaten (nicht leer)
+            int tag = 0;              // frei wählbar, mehrere Patterns dürfen sich einen Tag teilen
+            bool wordStart = false;   // \b vor literal
+            bool wordEnd = false;     // \b nach literal (bzw. nach dem letzten Follow)
+            std::vector<Follow> follow;
+        };
+
+        struct Hit
+        {
+            int tag = 0;
+            int pattern = 0;          // Index in add()-Reihenfolge
+            std::size_t begin = 0;    // Offset des Literals
+            std::size_t end = 0;      // hinter dem letzten gematchten Token
+        };
+
+        // liefert den Pattern-Index; build() muss danach (erneut) aufgerufen werden
+        int add(Pattern p);
+        void build();
+
+        bool empty() const { return m_patterns.empty(); }
+        const Pattern& pattern(int index) const { return m_patterns[(std::size_t)index]; }
+
+        // out wird überschrieben
+        void scan(std::string_view text, std::vector<Hit>& out) const;
+
+        // --- Helfer für Extractor-spezifische Nachprüfungen ---
+        static bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        static bool isWordChar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        static bool isIdentStart(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+        }
+
+        static std::size_t skipSpace(std::string_view text, std::size_t pos);
+
+        // matcht die Follow-Kette ab pos; bei Erfolg liegt *end hinter dem letzten Token
+        static bool matchFollow(std::string_view text, std::size_t pos,
+                                const std::vector<Follow>& follow, std::size_t* end);
+
+    private:
+        static constexpr int kAlphabet = 256;
+
+        std::vector<Pattern> m_patterns;
+
+        // Automat (vollständige Übergangstabelle, States x 256)
+        std::vector<std::int32_t> m_next;
+        std::vector<std::int32_t> m_outLink;    // nächster State mit Ausgabe (Dictionary-Suffix-Link), -1 = keiner
+        std::vector<std::vector<std::int32_t>> m_out; // Patterns, die in diesem State enden
+        bool m_built = false;
+
+        bool verify(std::string_view text, std::size_t begin, const Pattern& p, std::size_t* end) const;
+    };
+}
@@ -41,7 +41,8 @@ namespace core::source::extract::util
 
     std::string TextUnit::snippetAtLine(int line1Based, int ctx) const
     {
-        if (line1Based <= 0) return {};
+        // Zeile außerhalb (z.B. FactText lädt eine inzwischen gekürzte Datei nach)
+        if (line1Based <= 0 || line1Based > (int)lineOffsets.size()) return {};
         int idx = line1Based - 1;
 
         int startLine = std::max(0, idx - ctx);
@@ -74,4 +75,15 @@ namespace core::source::extract::util
         }
         return out;
     }
+
+    std::uint64_t contentHash(std::string_view s)
+    {
+        std::uint64_t h = 0xCBF29CE484222325ull;
+        for (unsigned char c : s)
+        {
+            h ^= c;
+            h *= 0x100000001B3ull;
+        }
+        return h;
+    }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <filesystem>
@@ -20,4 +21,7 @@ namespace core::source::extract::util
     };
 
     std::string jsonEscape(std::string_view s);
+
+    // FNV-1a 64 über den (normalisierten) Inhalt – Wiedererkennung, kein Kryptohash
+    std::uint64_t contentHash(std::string_view s);
 }
@@ -0,0 +1,287 @@
+#include "CppLexer.h"
+
+#include <algorithm>
+#include <array>
+
+namespace core::source::index
+{
+    namespace
+    {
+        bool isIdentStart(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$';
+        }
+
+        bool isIdentChar(char c)
+        {
+            return isIdentStart(c) || (c >= '0' && c <= '9');
+        }
+
+        bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        // sortiert für binary_search
+        constexpr std::array<std::string_view, 107> kKeywords = {
+            "__asm", "__attribute__", "__cdecl", "__declspec", "__fastcall", "__forceinline",
+            "__inline", "__int16", "__int32", "__int64", "__int8", "__stdcall",
+            "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool",
+            "break", "case", "catch", "char", "char16_t", "char32_t", "char8_t", "class",
+            "co_await", "co_return", "co_yield", "compl", "concept", "const", "const_cast",
+            "consteval", "constexpr", "constinit", "continue", "decltype", "default", "defined",
+            "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export",
+            "extern", "false", "final", "float", "for", "friend", "goto", "if", "inline", "int",
+            "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+            "operator", "or", "or_eq", "override", "private", "protected", "public", "register",
+            "reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static",
+            "static_assert", "static_cast", "struct", "switch", "template", "this",
+            "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+            "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor",
+            "xor_eq"
+        };
+
+        // Präfixe vor '"' bzw. '\''
+        bool isStringPrefix(std::string_view id)
+        {
+            return id == "L" || id == "u" || id == "U" || id == "u8";
+        }
+
+        bool isRawPrefix(std::string_view id)
+        {
+            return id == "R" || id == "LR" || id == "uR" || id == "UR" || id == "u8R";
+        }
+    }
+
+    bool CppLexer::isKeyword(std::string_view ident)
+    {
+        return std::binary_search(kKeywords.begin(), kKeywords.end(), ident);
+    }
+
+    void CppLexer::tokenize(std::string_view s, std::vector<Token>& out)
+    {
+        out.clear();
+        out.reserve(s.size() / 5);
+
+        const std::size_t n = s.size();
+        std::size_t i = 0;
+        std::uint32_t line = 1;
+
+        bool atLineStart = true;   // nur Whitespace seit letztem '\n'
+        bool inDirective = false;
+        bool includeDirective = false;
+
+        auto push = [&](std::size_t begin, TokenKind kind, std::uint32_t startLine)
+        {
+            Token t;
+            t.offset = static_cast<std::uint32_t>(begin);
+            t.length = static_cast<std::uint32_t>(i - begin);
+            t.line = startLine;
+            t.kind = kind;
+            t.directive = inDirective;
+            out.push_back(t);
+            atLineStart = false;
+        };
+
+        // "..." bzw. '...' ab i (zeigt auf das öffnende Quote), Ende an Zeilenumbruch
+        auto skipQuoted = [&](char quote)
+        {
+            ++i;
+            while (i < n && s[i] != quote && s[i] != '\n')
+            {
+                if (s[i] == '\\' && i + 1 < n)
+                {
+                    if (s[i + 1] == '\n') ++line;
+                    ++i;
+                }
+                ++i;
+            }
+            if (i < n && s[i] == quote) ++i;
+        };
+
+        while (i < n)
+        {
+            const char c = s[i];
+
+            // --- Whitespace / Zeilen ---
+            if (c == '\n')
+            {
+                ++line;
+                ++i;
+                atLineStart = true;
+                inDirective = false;
+                includeDirective = false;
+                continue;
+            }
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f')
+            {
+                ++i;
+                continue;
+            }
+            if (c == '\\' && i + 1 < n && s[i + 1] == '\n')
+            {
+                // Fortsetzungszeile: Direktive läuft weiter
+                i += 2;
+                ++line;
+                continue;
+            }
+
+            // --- Kommentare ---
+            if (c == '/' && i + 1 < n && s[i + 1] == '/')
+            {
+                // bis Zeilenende; '\'-Fortsetzung verlängert auch Kommentare
+                i += 2;
+                while (i < n && s[i] != '\n')
+                {
+                    if (s[i] == '\\' && i + 1 < n && s[i + 1] == '\n')
+                    {
+                        ++line;
+                        ++i;
+                    }
+                    ++i;
+                }
+                continue;
+            }
+            if (c == '/' && i + 1 < n && s[i + 1] == '*')
+            {
+                i += 2;
+                while (i < n && !(s[i] == '*' && i + 1 < n && s[i + 1] == '/'))
+                {
+                    if (s[i] == '\n') ++line;
+                    ++i;
+                }
+                i = std::min(n, i + 2);
+                continue;
+            }
+
+            const std::size_t begin = i;
+            const std::uint32_t startLine = line;
+
+            // --- Präprozessor ---
+            if (c == '#' && atLineStart)
+            {
+                inDirective = true;
+                ++i;
+                push(begin, TokenKind::Punct, startLine);
+
+                // Direktivenname prüfen: #include/#import -> Rest ist ein Pfad
+                std::size_t j = i;
+                while (j < n && (s[j] == ' ' || s[j] == '\t')) ++j;
+                std::size_t k = j;
+                while (k < n && isIdentChar(s[k])) ++k;
+                const std::string_view name = s.substr(j, k - j);
+                includeDirective = (name == "include" || name == "import" || name == "include_next");
+                continue;
+            }
+
+            if (includeDirective && c == '<')
+            {
+                while (i < n && s[i] != '>' && s[i] != '\n') ++i;
+                if (i < n && s[i] == '>') ++i;
+                push(begin, TokenKind::String, startLine);
+                continue;
+            }
+
+            // --- Identifier / Präfix-Literale ---
+            if (isIdentStart(c))
+            {
+                while (i < n && isIdentChar(s[i])) ++i;
+                const std::string_view id = s.substr(begin, i - begin);
+
+                if (i < n && s[i] == '"' && isRawPrefix(id))
+                {
+                    // R"delim( ... )delim"
+                    std::size_t d = i + 1;
+                    while (d < n && s[d] != '(' && s[d] != '\n' && d - (i + 1) < 16) ++d;
+                    if (d < n && s[d] == '(')
+                    {
+                        const std::string_view delim = s.substr(i + 1, d - (i + 1));
+                        std::size_t p = d + 1;
+                        for (;;)
+                        {
+                            p = s.find(')', p);
+                            if (p == std::string_view::npos)
+                            {
+                                p = n;
+                                break;
+                            }
+                            if (s.compare(p + 1, delim.size(), delim) == 0 &&
+                                p + 1 + delim.size() < n && s[p + 1 + delim.size()] == '"')
+                            {
+                                p += delim.size() + 2;
+                                break;
+                            }
+                            ++p;
+                        }
+                        line += static_cast<std::uint32_t>(std::count(s.begin() + static_cast<std::ptrdiff_t>(i),
+                                                                      s.begin() + static_cast<std::ptrdiff_t>(p), '\n'));
+                        i = p;
+                        push(begin, TokenKind::String, startLine);
+                        continue;
+                    }
+                }
+
+                if (i < n && (s[i] == '"' || s[i] == '\'') && isStringPrefix(id))
+                {
+                    const char quote = s[i];
+                    skipQuoted(quote);
+                    push(begin, quote == '"' ? TokenKind::String : TokenKind::Char, startLine);
+                    continue;
+                }
+
+                push(begin, TokenKind::Identifier, startLine);
+                continue;
+            }
+
+            // --- Zahlen (pp-number, inkl. 1'000 und 1e+5) ---
+            if (isDigit(c) || (c == '.' && i + 1 < n && isDigit(s[i + 1])))
+            {
+                ++i;
+                while (i < n)
+                {
+                    const char d = s[i];
+                    if (isIdentChar(d) || d == '.')
+                    {
+                        ++i;
+                    }
+                    else if (d == '\'' && i + 1 < n && isIdentChar(s[i + 1]))
+                    {
+                        i += 2;
+                    }
+                    else if ((d == '+' || d == '-') &&
+                             (s[i - 1] == 'e' || s[i - 1] == 'E' || s[i - 1] == 'p' || s[i - 1] == 'P'))
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+                push(begin, TokenKind::Number, startLine);
+                continue;
+            }
+
+            // --- Literale ---
+            if (c == '"')
+            {
+                skipQuoted('"');
+                push(begin, TokenKind::String, startLine);
+                continue;
+            }
+            if (c == '\'')
+            {
+                skipQuoted('\'');
+                push(begin, TokenKind::Char, startLine);
+                continue;
+            }
+
+            // --- Punctuation ---
+            if (i + 1 < n && ((c == ':' && s[i + 1] == ':') || (c == '-' && s[i + 1] == '>')))
+                i += 2;
+            else
+                ++i;
+            push(begin, TokenKind::Punct, startLine);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace core::source::index
+{
+    enum class TokenKind : std::uint8_t
+    {
+        Identifier,   // inkl. Keywords (siehe CppLexer::isKeyword)
+        Number,
+        String,       // "..." / R"(...)" / <...> nach #include, inkl. Präfix
+        Char,
+        Punct         // 1 Zeichen, außer "::" und "->"
+    };
+
+    struct Token
+    {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+        std::uint32_t line = 0;      // 1-based
+        TokenKind kind = TokenKind::Punct;
+        bool directive = false;      // Teil einer Präprozessor-Zeile (inkl. '#')
+    };
+
+    // Leichter C++-Lexer für den Legacy-Quellbaum (kein Präprozessor, keine Makro-Expansion).
+    // - Kommentare und Whitespace werden übersprungen
+    // - String-/Char-/Raw-String-Literale sind je ein Token (Inhalt wird nicht indiziert)
+    // - Präprozessor-Zeilen (inkl. '\'-Fortsetzung) werden normal tokenisiert, aber markiert
+    struct CppLexer
+    {
+        // out wird überschrieben
+        static void tokenize(std::string_view text, std::vector<Token>& out);
+
+        static bool isKeyword(std::string_view ident);
+
+        static std::string_view text(std::string_view source, const Token& t)
+        {
+            return source.substr(t.offset, t.length);
+        }
+    };
+}
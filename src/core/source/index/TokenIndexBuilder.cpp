@@ -0,0 +1,507 @@
+#include "TokenIndexBuilder.h"
+
+#include "core/source/index/CppLexer.h"
+
+#include <string_view>
+#include <unordered_map>
+
+namespace core::source::index
+{
+    namespace
+    {
+        // --- Ergebnis pro Datei, Indizes lokal (Merge in addFile) ---
+        struct FileFunction
+        {
+            std::string name;
+            std::uint32_t line = 0;
+            std::uint32_t endLine = 0;
+        };
+
+        struct FileOccurrence
+        {
+            std::uint32_t name = 0;      // Index in FileTokens::names
+            std::uint32_t line = 0;
+            std::uint32_t offset = 0;
+            std::int32_t function = -1;  // Index in FileTokens::functions
+            bool disabled = false;
+        };
+
+        struct FileTokens
+        {
+            std::uint32_t tokenCount = 0;
+
+            std::vector<std::string> names;
+            std::vector<FileFunction> functions;
+            std::vector<FileOccurrence> occurrences;
+        };
+
+        // ---------------------------------------------------------------
+        // Scope-Analyse
+        // ---------------------------------------------------------------
+        // Heuristik auf Token-Ebene, kein Parser:
+        // - '{' nach "name(...)" (optional mit Qualifiern, Init-Liste, const, ...)
+        //   außerhalb eines Funktionsrumpfs = Funktionsdefinition
+        // - namespace/class/struct/union/enum liefern Scope-Namen für die Qualifizierung
+        // - in #else/#elif-Zweigen und unter "#if 0" werden Klammern ignoriert,
+        //   damit doppelt vorhandene Signaturen den Brace-Stack nicht verschieben
+        class ScopeAnalyzer
+        {
+        public:
+            ScopeAnalyzer(std::string_view text, const std::vector<Token>& toks, FileTokens& out)
+                : m_text(text), m_toks(toks), m_out(out)
+            {
+            }
+
+            void run()
+            {
+                for (std::size_t i = 0; i < m_toks.size(); ++i)
+                {
+                    const Token& t = m_toks[i];
+                    const std::string_view sv = CppLexer::text(m_text, t);
+
+                    if (t.kind == TokenKind::Identifier && !CppLexer::isKeyword(sv))
+                        addOccurrence(sv, t);
+
+                    if (t.directive)
+                    {
+                        if (sv == "#")
+                            onDirective(i);
+                        continue;
+                    }
+
+                    if (m_skipDepth > 0)
+                        continue;
+
+                    if (m_curFunction >= 0)
+                        onTokenInFunction(t, sv);
+                    else
+                        onTokenOutside(i, t, sv);
+                }
+
+                // nicht geschlossene Rümpfe bis Dateiende
+                const std::uint32_t lastLine = m_toks.empty() ? 0 : m_toks.back().line;
+                for (auto& fn : m_out.functions)
+                    if (fn.endLine == 0)
+                        fn.endLine = lastLine;
+            }
+
+        private:
+            enum class ScopeKind { Namespace, Class, Function, Block, InitBrace };
+
+            struct Frame
+            {
+                ScopeKind kind = ScopeKind::Block;
+                std::string name;
+                std::int32_t prevFunction = -1;
+                std::int32_t function = -1;
+            };
+
+            struct CondFrame
+            {
+                bool taken = false;      // ein Zweig wurde bereits übernommen
+                bool skipping = false;
+                bool dead = false;       // erster Zweig von "#if 0"
+            };
+
+            std::string_view m_text;
+            const std::vector<Token>& m_toks;
+            FileTokens& m_out;
+
+            std::unordered_map<std::string_view, std::uint32_t> m_nameIds;
+
+            std::vector<Frame> m_stack;
+            std::int32_t m_curFunction = -1;
+
+            std::vector<CondFrame> m_cond;
+            int m_skipDepth = 0;
+            int m_deadDepth = 0;
+
+            // Signatur-Zustand (nur außerhalb von Funktionsrümpfen)
+            std::string m_candName;
+            std::uint32_t m_candLine = 0;
+            bool m_candOpen = false;
+            bool m_candClosed = false;
+            bool m_initList = false;
+            bool m_pendingNamespace = false;
+            bool m_pendingClass = false;
+            bool m_classColon = false;
+            bool m_sawAssign = false;
+            std::string m_pendingScopeName;
+            int m_parenDepth = 0;
+            int m_templateDepth = 0;
+
+            std::string_view textAt(std::size_t i) const
+            {
+                return CppLexer::text(m_text, m_toks[i]);
+            }
+
+            bool isIdent(std::size_t i) const
+            {
+                return m_toks[i].kind == TokenKind::Identifier;
+            }
+
+            void addOccurrence(std::string_view name, const Token& t)
+            {
+                auto [it, inserted] = m_nameIds.try_emplace(name, static_cast<std::uint32_t>(m_out.names.size()));
+                if (inserted)
+                    m_out.names.emplace_back(name);
+
+                FileOccurrence occ;
+                occ.name = it->second;
+                occ.line = t.line;
+                occ.offset = t.offset;
+                occ.function = m_curFunction;
+                occ.disabled = m_deadDepth > 0;
+                m_out.occurrences.push_back(occ);
+            }
+
+            void resetSignature()
+            {
+                m_candName.clear();
+                m_candOpen = false;
+                m_candClosed = false;
+                m_initList = false;
+                m_pendingNamespace = false;
+                m_pendingClass = false;
+                m_classColon = false;
+                m_sawAssign = false;
+                m_pendingScopeName.clear();
+            }
+
+            void updateSkip()
+            {
+                m_skipDepth = 0;
+                m_deadDepth = 0;
+                for (const auto& c : m_cond)
+                {
+                    if (c.skipping)
+                        ++m_skipDepth;
+                    if (c.dead)
+                        ++m_deadDepth;
+                }
+            }
+
+            void onDirective(std::size_t hashIdx)
+            {
+                if (hashIdx + 1 >= m_toks.size() || !m_toks[hashIdx + 1].directive)
+                    return;
+
+                const std::string_view name = textAt(hashIdx + 1);
+                if (name == "if" || name == "ifdef" || name == "ifndef")
+                {
+                    // "#if 0" -> erster Zweig ist toter Code
+                    const bool ifZero = name == "if" && hashIdx + 2 < m_toks.size() &&
+                                        m_toks[hashIdx + 2].directive && textAt(hashIdx + 2) == "0";
+                    m_cond.push_back({ !ifZero, ifZero, ifZero });
+                }
+                else if (name == "elif" || name == "else")
+                {
+                    if (m_cond.empty())
+                        return;
+                    CondFrame& c = m_cond.back();
+                    c.skipping = c.taken;
+                    c.taken = true;
+                    c.dead = false;
+                }
+                else if (name == "endif")
+                {
+                    if (!m_cond.empty())
+                        m_cond.pop_back();
+                }
+                else
+                {
+                    return;
+                }
+                updateSkip();
+            }
+
+            void onTokenInFunction(const Token& t, std::string_view sv)
+            {
+                if (t.kind != TokenKind::Punct)
+                    return;
+
+                if (sv == "{")
+                {
+                    m_stack.push_back({ ScopeKind::Block, {}, m_curFunction, -1 });
+                }
+                else if (sv == "}" && !m_stack.empty())
+                {
+                    const Frame f = std::move(m_stack.back());
+                    m_stack.pop_back();
+
+                    if (f.kind == ScopeKind::Function)
+                    {
+                        m_out.functions[static_cast<std::size_t>(f.function)].endLine = t.line;
+                        m_curFunction = f.prevFunction;
+                        resetSignature();
+                    }
+                }
+            }
+
+            // Qualifizierer "A::B::" vor Token-Index first voranstellen
+            std::string qualify(std::size_t first, std::string name) const
+            {
+                while (first >= 2 && textAt(first - 1) == "::" && isIdent(first - 2) &&
+                       !CppLexer::isKeyword(textAt(first - 2)))
+                {
+                    name = std::string(textAt(first - 2)) + "::" + name;
+                    first -= 2;
+                }
+                return name;
+            }
+
+            // Name einer Funktion, deren Parameterliste bei Token parenIdx beginnt; leer = keine
+            std::string nameBeforeParen(std::size_t parenIdx) const
+            {
+                if (parenIdx == 0)
+                    return {};
+
+                const std::size_t k = parenIdx - 1;
+
+                // operator()(...)
+                if (k >= 2 && textAt(k) == ")" && textAt(k - 1) == "(" && textAt(k - 2) == "operator")
+                    return qualify(k - 2, "operator()");
+
+                // operator==, operator new[], operator bool, ...
+                for (std::size_t m = 1; m <= 4 && m <= k + 1; ++m)
+                {
+                    const std::size_t j = parenIdx - m;
+                    const std::string_view sv = textAt(j);
+                    if (sv == "operator")
+                    {
+                        std::string name = "operator";
+                        for (std::size_t x = j + 1; x < parenIdx; ++x)
+                        {
+                            if (isIdent(x)) name += ' ';
+                            name += textAt(x);
+                        }
+                        return qualify(j, std::move(name));
+                    }
+                    if (sv == ";" || sv == "{" || sv == "}" || sv == "(" || sv == ")")
+                        break;
+                }
+
+                if (!isIdent(k) || CppLexer::isKeyword(textAt(k)))
+                    return {};
+
+                // ~Dtor
+                if (k >= 1 && textAt(k - 1) == "~")
+                    return qualify(k - 1, "~" + std::string(textAt(k)));
+
+                return qualify(k, std::string(textAt(k)));
+            }
+
+            std::string scopePrefix() const
+            {
+                std::string prefix;
+                for (const auto& f : m_stack)
+                {
+                    if ((f.kind == ScopeKind::Namespace || f.kind == ScopeKind::Class) && !f.name.empty())
+                    {
+                        prefix += f.name;
+                        prefix += "::";
+                    }
+                }
+                return prefix;
+            }
+
+            void onTokenOutside(std::size_t i, const Token& t, std::string_view sv)
+            {
+                // template<...> überspringen (class/typename darin sind keine Scopes)
+                if (m_templateDepth > 0)
+                {
+                    if (sv == "<")
+                        ++m_templateDepth;
+                    else if (sv == ">")
+                        --m_templateDepth;
+                    else if (sv == ";" || sv == "{" || sv == "}")
+                        m_templateDepth = 0; // kaputte Liste: normal weiter
+                    if (m_templateDepth > 0 || sv == ">")
+                        return;
+                }
+
+                if (t.kind == TokenKind::Identifier)
+                {
+                    if (m_parenDepth != 0)
+                        return;
+
+                    if (sv == "template" && i + 1 < m_toks.size() && textAt(i + 1) == "<")
+                    {
+                        m_templateDepth = -1; // das folgende '<' öffnet die Liste
+                        return;
+                    }
+                    if (sv == "namespace")
+                    {
+                        m_pendingNamespace = true;
+                        m_pendingScopeName.clear();
+                        return;
+                    }
+                    if ((sv == "class" || sv == "struct" || sv == "union" || sv == "enum") && !m_candClosed)
+                    {
+                        if (!m_pendingClass)
+                            m_pendingScopeName.clear();
+                        m_pendingClass = true;
+                        return;
+                    }
+                    if ((m_pendingNamespace || (m_pendingClass && !m_classColon)) && !CppLexer::isKeyword(sv))
+                    {
+                        if (i > 0 && textAt(i - 1) == "::" && !m_pendingScopeName.empty())
+                            m_pendingScopeName += "::";
+                        else
+                            m_pendingScopeName.clear();
+                        m_pendingScopeName += sv;
+                    }
+                    return;
+                }
+
+                if (t.kind != TokenKind::Punct)
+                    return;
+
+                if (sv == "<" && m_templateDepth < 0)
+                {
+                    m_templateDepth = 1;
+                    return;
+                }
+
+                if (sv == "(")
+                {
+                    if (m_parenDepth == 0 && !m_initList && !m_pendingClass)
+                    {
+                        std::string name = nameBeforeParen(i);
+                        if (!name.empty())
+                        {
+                            m_candName = std::move(name);
+                            m_candLine = m_toks[i - 1].line;
+                            m_candOpen = true;
+                            m_candClosed = false;
+                            m_sawAssign = false;
+                        }
+                    }
+                    ++m_parenDepth;
+                    return;
+                }
+
+                if (sv == ")")
+                {
+                    if (m_parenDepth > 0)
+                        --m_parenDepth;
+                    if (m_parenDepth == 0 && m_candOpen)
+                    {
+                        m_candOpen = false;
+                        m_candClosed = true;
+                    }
+                    return;
+                }
+
+                if (sv == "{")
+                {
+                    if (m_parenDepth > 0)
+                    {
+                        m_stack.push_back({ ScopeKind::Block, {}, m_curFunction, -1 });
+                        return;
+                    }
+
+                    // Init-Liste mit Klammer-Init: A() : m_a{1}, m_b{} { ... }
+                    if (m_initList && i > 0 &&
+                        ((isIdent(i - 1) && !CppLexer::isKeyword(textAt(i - 1))) || textAt(i - 1) == ">"))
+                    {
+                        m_stack.push_back({ ScopeKind::InitBrace, {}, m_curFunction, -1 });
+                        return;
+                    }
+
+                    if (m_candClosed && !m_sawAssign)
+                    {
+                        const auto fnId = static_cast<std::int32_t>(m_out.functions.size());
+                        m_out.functions.push_back({ scopePrefix() + m_candName, m_candLine, 0 });
+                        m_stack.push_back({ ScopeKind::Function, {}, m_curFunction, fnId });
+                        m_curFunction = fnId;
+                    }
+                    else if (m_pendingNamespace)
+                    {
+                        m_stack.push_back({ ScopeKind::Namespace, m_pendingScopeName, m_curFunction, -1 });
+                    }
+                    else if (m_pendingClass)
+                    {
+                        m_stack.push_back({ ScopeKind::Class, m_pendingScopeName, m_curFunction, -1 });
+                    }
+                    else
+                    {
+                        m_stack.push_back({ ScopeKind::Block, {}, m_curFunction, -1 });
+                    }
+                    resetSignature();
+                    return;
+                }
+
+                if (sv == "}")
+                {
+                    const bool initBrace = !m_stack.empty() && m_stack.back().kind == ScopeKind::InitBrace;
+                    if (!m_stack.empty())
+                        m_stack.pop_back();
+                    if (!initBrace)
+                        resetSignature();
+                    return;
+                }
+
+                if (m_parenDepth != 0)
+                    return;
+
+                if (sv == ";")
+                {
+                    resetSignature();
+                }
+                else if (sv == "=")
+                {
+                    m_sawAssign = true;
+                }
+                else if (sv == ":")
+                {
+                    if (m_candClosed)
+                        m_initList = true;
+                    else if (m_pendingClass)
+                        m_classColon = true;
+                    else
+                        resetSignature(); // public: / case / Bitfeld
+                }
+            }
+        };
+
+        void analyzeFile(std::string_view text, FileTokens& out)
+        {
+            std::vector<Token> toks;
+            CppLexer::tokenize(text, toks);
+            out.tokenCount = static_cast<std::uint32_t>(toks.size());
+
+            ScopeAnalyzer(text, toks, out).run();
+        }
+    }
+
+    std::uint32_t TokenIndexBuilder::addFile(const data::source::SourceFileEntry& file,
+                                             const extract::util::TextUnit& unit,
+                                             data::source::TokenIndex& out)
+    {
+        FileTokens ft;
+        analyzeFile(unit.content, ft);
+
+        data::source::IndexedFile indexed;
+        indexed.absolutePath = file.absolutePath;
+        indexed.relativePath = file.relativePath;
+        indexed.tokenCount = ft.tokenCount;
+        const std::uint32_t fileId = out.addFile(std::move(indexed));
+
+        const auto fnBase = static_cast<std::int32_t>(out.functions().size());
+        for (const auto& fn : ft.functions)
+            out.addFunction({ fn.name, fileId, fn.line, fn.endLine });
+
+        for (const auto& occ : ft.occurrences)
+        {
+            data::source::TokenOccurrence o;
+            o.file = fileId;
+            o.line = occ.line;
+            o.offset = occ.offset;
+            o.function = occ.function >= 0 ? fnBase + occ.function : -1;
+            o.disabled = occ.disabled;
+            out.addOccurrence(ft.names[occ.name], o);
+        }
+        return fileId;
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "data/source/index/SourceIndexList.h"
+#include "data/source/index/TokenIndex.h"
+#include "core/source/extract/util/TextUnit.h"
+
+namespace core::source::index
+{
+    // Baut aus bereits geladenen Dateien einen TokenIndex (Identifier -> Vorkommen
+    // mit Datei, Zeile und umschließender Funktion).
+    //
+    // - liest selbst nichts: Extractoren, die den Index abfragen, indizieren das
+    //   TextUnit, das SourceExtractor ohnehin geladen hat (siehe DrawCallSchemaExtractor)
+    // - Wiederverwendung über Läufe hinweg passiert eine Ebene höher: der
+    //   SourceCache hält die Facts pro (Extractor, Datei-Hash), ungeänderte
+    //   Dateien werden also weder gelesen noch lexiert
+    struct TokenIndexBuilder
+    {
+        // lexiert unit, hängt Funktionen + Vorkommen an out an; Rückgabe = Datei-Index in out
+        static std::uint32_t addFile(const data::source::SourceFileEntry& file,
+                                     const extract::util::TextUnit& unit,
+                                     data::source::TokenIndex& out);
+    };
+}
@@ -1,6 +1,10 @@
 #include "SourceScanner.h"
 
+#include "core/TaskSystem.h"
+
+#include <algorithm>
 #include <filesystem>
+#include <system_error>
 
 namespace fs = std::filesystem;
 using namespace core::source;
@@ -10,30 +14,128 @@ SourceScanner::SourceScanner(Settings settings)
 {
 }
 
+bool SourceScanner::makeEntry(const fs::directory_entry& entry, data::source::SourceFileEntry& out) const
+{
+    std::error_code ec;
+    if (!entry.is_regular_file(ec))
+        return false;
+
+    const fs::path& absPath = entry.path();
+    std::string ext = absPath.extension().string();
+
+    if (m_settings.extensions.find(ext) == m_settings.extensions.end())
+        return false;
+
+    // Einträge entstehen per append aus sourceRoot -> relativer Pfad ist ein
+    // reiner String-Suffix (fs::relative würde pro Datei kanonisieren = Syscalls)
+    const auto& rootStr = m_settings.sourceRoot.native();
+    const auto& absStr = absPath.native();
+
+    std::size_t cut = rootStr.size();
+    if (absStr.compare(0, cut, rootStr) == 0)
+    {
+        while (cut < absStr.size() && fs::path::value_type(absStr[cut]) == fs::path::preferred_separator)
+            ++cut;
+        out.relativePath = fs::path(absStr.substr(cut));
+    }
+    else
+    {
+        out.relativePath = absPath.lexically_relative(m_settings.sourceRoot);
+    }
+
+    out.absolutePath = absPath;
+    out.extension    = std::move(ext);
+    out.filename     = absPath.filename().string();
+
+    const auto size = entry.file_size(ec);
+    out.size = ec ? 0 : static_cast<std::uint64_t>(size);
+    const auto mtime = entry.last_write_time(ec);
+    out.writeTime = ec ? 0 : static_cast<std::int64_t>(mtime.time_since_epoch().count());
+    return true;
+}
+
+void SourceScanner::walkTree(const fs::path& dir, std::vector<data::source::SourceFileEntry>& out) const
+{
+    std::error_code ec;
+    fs::recursive_directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec);
+    const fs::recursive_directory_iterator end;
+
+    for (; !ec && it != end; it.increment(ec))
+    {
+        data::source::SourceFileEntry file;
+        if (makeEntry(*it, file))
+            out.emplace_back(std::move(file));
+    }
+}
+
 void SourceScanner::scan(data::source::SourceIndexList& outIndex)
 {
     outIndex.clear();
 
-    if (!fs::exists(m_settings.sourceRoot))
+    std::error_code ec;
+    if (!fs::exists(m_settings.sourceRoot, ec))
         return;
 
-    for (auto& entry : fs::recursive_directory_iterator(m_settings.sourceRoot))
+    std::vector<data::source::SourceFileEntry> files;
+
+    if (!m_settings.parallel)
+    {
+        walkTree(m_settings.sourceRoot, files);
+    }
+    else
     {
-        if (!entry.is_regular_file())
-            continue;
+        // (1) Oberste Ebenen seriell aufklappen, bis genug Teilbäume für den Pool da sind
+        core::TaskSystem& tasks = core::TaskSystem::instance();
+        const std::size_t wantDirs = (tasks.workerCount() + 1) * 4;
+        constexpr int kMaxExpandDepth = 3;
 
-        const fs::path& absPath = entry.path();
-        const std::string ext = absPath.extension().string();
+        std::vector<fs::path> dirs{ m_settings.sourceRoot };
+        for (int depth = 0; depth < kMaxExpandDepth && !dirs.empty() && dirs.size() < wantDirs; ++depth)
+        {
+            std::vector<fs::path> nextDirs;
+            for (const auto& dir : dirs)
+            {
+                fs::directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec);
+                const fs::directory_iterator end;
+                for (; !ec && it != end; it.increment(ec))
+                {
+                    // wie recursive_directory_iterator: Verzeichnis-Symlinks nicht verfolgen
+                    std::error_code dec;
+                    if (it->is_directory(dec) && !it->is_symlink(dec))
+                    {
+                        nextDirs.push_back(it->path());
+                        continue;
+                    }
 
-        if (m_settings.extensions.find(ext) == m_settings.extensions.end())
-            continue;
+                    data::source::SourceFileEntry file;
+                    if (makeEntry(*it, file))
+                        files.emplace_back(std::move(file));
+                }
+                ec.clear();
+            }
+            dirs = std::move(nextDirs);
+        }
 
-        data::source::SourceFileEntry file;
-        file.absolutePath = absPath;
-        file.relativePath = fs::relative(absPath, m_settings.sourceRoot);
-        file.extension    = ext;
-        file.filename     = absPath.filename().string();
+        // (2) Restliche Teilbäume parallel, ein Ergebnis-Slot pro Teilbaum
+        std::vector<std::vector<data::source::SourceFileEntry>> slots(dirs.size());
+        tasks.parallelFor(dirs.size(), 1, [&](std::size_t begin, std::size_t endIdx)
+        {
+            for (std::size_t i = begin; i < endIdx; ++i)
+                walkTree(dirs[i], slots[i]);
+        });
 
-        outIndex.add(std::move(file));
+        for (auto& slot : slots)
+            for (auto& f : slot)
+                files.emplace_back(std::move(f));
     }
+
+    // Reihenfolge unabhängig von Dateisystem und Thread-Timing
+    std::sort(files.begin(), files.end(), [](const data::source::SourceFileEntry& a,
+                                             const data::source::SourceFileEntry& b)
+    {
+        return a.relativePath < b.relativePath;
+    });
+
+    for (auto& f : files)
+        outIndex.add(std::move(f));
 }
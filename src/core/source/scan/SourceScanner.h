@@ -18,6 +18,10 @@ public:
         std::unordered_set<std::string> extensions = {
             ".cpp", ".h", ".hpp", ".inl"
         };
+
+        // Teilbäume parallel auf dem TaskSystem durchlaufen.
+        // Ergebnis ist in beiden Fällen nach relativePath sortiert (deterministisch).
+        bool parallel = true;
     };
 
     explicit SourceScanner(Settings settings);
@@ -26,6 +30,13 @@ public:
 
 private:
     Settings m_settings;
+
+    // Datei-Eintrag aus einem Verzeichnis-Eintrag; false = ignorieren
+    bool makeEntry(const std::filesystem::directory_entry& entry,
+                   data::source::SourceFileEntry& out) const;
+
+    void walkTree(const std::filesystem::path& dir,
+                  std::vector<data::source::SourceFileEntry>& out) const;
 };
 
 } // namespace core::source
@@ -1,18 +1,103 @@
 #pragma once
 
+#include <cmath>
 #include <cstdint>
 #include <string>
 #include <vector>
 
 namespace asset
 {
+    struct AniBone
+    {
+        std::string name;
+        std::int32_t parent = -1;
+
+        // D3DX-Matrizen (row-major, wie in der Datei)
+        float inverseTM[16] = {};
+        float localTM[16]   = {};
+
+        // false -> Bone ist statisch, localTM gilt für alle Frames
+        bool animated = false;
+    };
+
+    struct AniTrack
+    {
+        std::uint32_t bone = 0;       // Index in DecodedAniData::bones
+        std::uint32_t firstKey = 0;   // Offset in die Key-Pools von AniTracks
+        std::uint32_t keyCount = 0;
+    };
+
+    // Alle Tracks einer Animation als SoA-Pools (dicht gepackt, ein Eintrag pro Key).
+    // Rotation liegt entweder als float x/y/z/w vor oder – mit compressRotations –
+    // als "smallest three" in 32 Bit (2 Bit Index + 3x 10 Bit).
+    struct AniTracks
+    {
+        std::vector<AniTrack> tracks;
+
+        std::vector<std::uint16_t> frame;   // Frame-Nummer pro Key
+
+        std::vector<float> posX, posY, posZ;
+
+        bool rotationsCompressed = false;
+        std::vector<float> rotX, rotY, rotZ, rotW;
+        std::vector<std::uint32_t> rotPacked;
+
+        std::size_t keyCount() const { return frame.size(); }
+
+        void rotation(std::size_t key, float out[4]) const
+        {
+            if (!rotationsCompressed)
+            {
+                out[0] = rotX[key]; out[1] = rotY[key]; out[2] = rotZ[key]; out[3] = rotW[key];
+                return;
+            }
+
+            // smallest three: größte Komponente weggelassen, aus |q| = 1 rekonstruiert
+            const std::uint32_t v = rotPacked[key];
+            const std::uint32_t largest = v >> 30;
+            constexpr float kRange = 0.70710678f; // 1/sqrt(2)
+
+            float c[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                const std::uint32_t q = (v >> (20 - i * 10)) & 0x3FFu;
+                c[i] = (static_cast<float>(q) / 1023.0f * 2.0f - 1.0f) * kRange;
+            }
+
+            const float sum = c[0] * c[0] + c[1] * c[1] + c[2] * c[2];
+            const float w = std::sqrt(sum < 1.0f ? 1.0f - sum : 0.0f);
+
+            int src = 0;
+            for (std::uint32_t i = 0; i < 4; ++i)
+                out[i] = (i == largest) ? w : c[src++];
+        }
+
+        std::size_t memoryBytes() const
+        {
+            return tracks.size() * sizeof(AniTrack) +
+                   frame.size() * sizeof(std::uint16_t) +
+                   (posX.size() + posY.size() + posZ.size()) * sizeof(float) +
+                   (rotX.size() + rotY.size() + rotZ.size() + rotW.size()) * sizeof(float) +
+                   rotPacked.size() * sizeof(std::uint32_t);
+        }
+    };
+
     struct DecodedAniData
     {
         // Container / Header
         std::string containerKind;     // "ANI", "ANI_LEGACY", "Unknown"
         std::uint32_t version = 0;     // falls erkennbar, sonst 0
 
-        // Referenzen (vorsichtig extrahiert)
+        // --- Strukturiert (CMotion-Layout) ---
+        bool parsed = false;
+        std::int32_t motionId = 0;
+        float perSlerp = 0.0f;
+        std::uint32_t frameCount = 0;
+
+        std::vector<AniBone> bones;
+        AniTracks tracks;
+
+        // Referenzen (vorsichtig extrahiert, nur wenn nicht strukturiert)
         std::vector<std::string> refSkeletons; // bone/skel/o3d refs
         std::vector<std::string> refModels;    // o3d/ase
         std::vector<std::string> refOther;     // sonstige refs mit Punkt
@@ -20,7 +105,7 @@ namespace asset
         // Analyse / Debug
         std::vector<std::string> allStrings;
 
-        // Raw unverändert (wichtig für Converter!)
+        // Raw unverändert (wichtig für Converter!) – leer bei DecodeOptions::keepRaw = false
         std::vector<std::uint8_t> raw;
     };
 }
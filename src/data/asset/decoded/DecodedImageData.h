@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -13,6 +14,7 @@ namespace asset
         int width = 0;
         int height = 0;
         int mipCount = 1;
+        int mipLevel = 0;   // welche Stufe in rgba liegt (width/height sind die der Stufe)
 
         // DXT2/DXT4 sind premultiplied alpha Varianten
         bool premultipliedAlpha = false;
@@ -21,10 +23,62 @@ namespace asset
         std::vector<std::uint8_t> rgba;
     };
 
+    enum class DdsBlockFormat
+    {
+        BC1, BC2, BC3, BC4, BC5
+    };
+
+    struct DdsMipInfo
+    {
+        int width = 0;
+        int height = 0;
+        std::size_t offset = 0; // absolut in den DDS-Dateibytes
+        std::size_t size = 0;
+    };
+
+    // Beschreibung des komprimierten Payloads (für Passthrough ohne Decode)
+    struct DdsPayloadInfo
+    {
+        DdsBlockFormat format = DdsBlockFormat::BC1;
+        int width = 0;
+        int height = 0;
+        int blockBytes = 0;             // 8 (BC1/BC4) oder 16
+
+        bool premultipliedAlpha = false;
+        bool colorSpaceKnown = false;   // nur DX10-Header
+        bool srgb = false;
+        bool snorm = false;
+
+        std::vector<DdsMipInfo> mips;   // nur vollständig vorhandene Stufen, 0 = voll
+    };
+
     class DdsDecoder
     {
     public:
+        struct DecodeOptions
+        {
+            // Große BCn-Texturen in Blockzeilen-Bereiche auf dem TaskSystem aufteilen
+            bool parallel = true;
+            std::size_t parallelMinPixels = 512u * 512u;
+        };
+
         // Memory-only: erwartet vollständige DDS-Dateibytes
         static bool decode(DecodedImageData& out, const BinaryData& inBytes, std::string* outError = nullptr);
+        static bool decode(DecodedImageData& out, const BinaryData& inBytes, const DecodeOptions& opts, std::string* outError = nullptr);
+
+        // Nur eine Mip-Stufe direkt aus dem Payload dekodieren (0 = volle Auflösung).
+        static bool decodeMip(DecodedImageData& out, const BinaryData& inBytes, int mipLevel, std::string* outError = nullptr);
+        static bool decodeMip(DecodedImageData& out, const BinaryData& inBytes, int mipLevel,
+                              const DecodeOptions& opts, std::string* outError = nullptr);
+
+        // Kleinste Mip-Stufe, die beim Einpassen in targetWidth x targetHeight
+        // nicht hochskaliert werden muss (z.B. für Vorschaubilder).
+        static bool decodeForSize(DecodedImageData& out, const BinaryData& inBytes,
+                                  int targetWidth, int targetHeight, std::string* outError = nullptr);
+
+        // Liest nur Header + Mip-Offsets, dekodiert nichts.
+        static bool describePayload(DdsPayloadInfo& out, const BinaryData& inBytes, std::string* outError = nullptr);
+
+        static int selectMipForSize(int width, int height, int mipCount, int targetWidth, int targetHeight);
     };
 }
\ No newline at end of file
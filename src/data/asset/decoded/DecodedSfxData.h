@@ -7,6 +7,65 @@ namespace asset
 {
     struct BinaryData;
 
+    // SFX0.x Part-Typen (Werte wie in der Datei)
+    enum class SfxPartType : std::uint32_t
+    {
+        Bill       = 1,
+        Particle   = 2,
+        Mesh       = 3,   // texture = .o3d
+        CustomMesh = 4
+    };
+
+    struct SfxKeyFrame
+    {
+        std::uint16_t frame = 0;
+        float pos[3]       = {};
+        float posRotate[3] = {};
+        float scale[3]     = {};
+        float rotate[3]    = {};
+        std::int32_t alpha = 0;
+    };
+
+    // Nur für SfxPartType::Particle
+    struct SfxParticleParams
+    {
+        std::uint16_t createInterval = 0;
+        std::uint16_t createCount    = 0;
+        std::uint16_t frameAppear    = 0;
+        std::uint16_t frameKeep      = 0;
+        std::uint16_t frameDisappear = 0;
+
+        float startPosVar  = 0.0f;
+        float startPosVarY = 0.0f;
+        float yLow   = 0.0f;
+        float yHigh  = 0.0f;
+        float xzLow  = 0.0f;
+        float xzHigh = 0.0f;
+
+        float accel[3]        = {};
+        float scale[3]        = {};
+        float rotationLow[3]  = {};
+        float rotationHigh[3] = {};
+    };
+
+    struct SfxPart
+    {
+        SfxPartType type = SfxPartType::Bill;
+
+        std::string name;      // ab SFX0.2
+        std::string texture;   // lower-case, '/' – bei Mesh der Modellname
+
+        std::uint16_t texFrame = 0;
+        std::uint16_t texLoop  = 0;
+        bool visible = true;   // ab SFX0.3
+
+        std::uint32_t billType  = 0;
+        std::uint32_t alphaType = 0;
+
+        SfxParticleParams particle;
+        std::vector<SfxKeyFrame> keys;
+    };
+
     struct DecodedSfxData
     {
         // "SFX0.1", "SFX0.2", "SFX0.3" oder leer/unknown bei Legacy
@@ -16,6 +75,11 @@ namespace asset
         // "SFX0x" oder "Legacy"
         std::string containerKind;
 
+        // true -> parts/keys stammen aus dem strukturierten Parser und die
+        // refs sind exakt; false -> heuristischer String-Scan (Fallback)
+        bool structured = false;
+        std::vector<SfxPart> parts;
+
         // Extrahierte Referenzen (dedupliziert, lower-case)
         std::vector<std::string> refImages; // dds/tga/png/jpg/jpeg/bmp
         std::vector<std::string> refSounds; // wav/ogg/mp3/bgm
@@ -23,16 +87,23 @@ namespace asset
         std::vector<std::string> refSfx;    // sfx (verschachtelt)
         std::vector<std::string> refOther;  // alles andere mit Punkt
 
-        // Optional: alle gefundenen "strings" (für Debug/Analyse)
+        // Nur im Fallback: alle gefundenen "strings" (für Debug/Analyse)
         std::vector<std::string> allStrings;
 
-        // Raw unverändert
+        // Raw unverändert – leer bei DecodeOptions::keepRaw = false
         std::vector<std::uint8_t> raw;
     };
 
     class SfxDecoder
     {
     public:
+        struct DecodeOptions
+        {
+            // raw-Kopie behalten (Converter, Debug)
+            bool keepRaw = true;
+        };
+
         static bool decode(DecodedSfxData& out, const BinaryData& inBytes, std::string* outError = nullptr);
+        static bool decode(DecodedSfxData& out, const BinaryData& inBytes, const DecodeOptions& opts, std::string* outError = nullptr);
     };
 }
@@ -18,6 +18,16 @@ namespace asset::normalized
         std::string debugName;
     };
 
+    // Vereinfachte Stufe: eigener Index-Buffer über die Vertex-Arrays des Basis-Meshes
+    struct NormalizedLod
+    {
+        std::vector<uint32_t> indices;
+        std::vector<NormalizedPrimitive> primitives;  // gleiche Reihenfolge/Materialien wie Basis
+
+        float triangleRatio = 1.0f;  // Dreiecke relativ zum Basis-Mesh
+        float error = 0.0f;          // max. Quadrik-Fehler (relativ zur Mesh-Ausdehnung)
+    };
+
     struct NormalizedMesh
     {
         std::string name;
@@ -33,6 +43,9 @@ namespace asset::normalized
         // Subsets / primitives (Materialgruppen)
         std::vector<NormalizedPrimitive> primitives;
 
+        // LOD-Kette (optional, gröber werdend); teilt positions/normals/uvs0
+        std::vector<NormalizedLod> lods;
+
         bool hasNormals() const { return normals.size() == positions.size(); }
         bool hasUvs0()    const { return uvs0.size()    == positions.size(); }
     };
@@ -1,6 +1,8 @@
 #pragma once
 #include "parser/o3d/MeshParamBlockReader.h"
+#include "parser/o3d/VertexBufferReader.h"
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -18,6 +20,21 @@ namespace asset
     };
 
 
+    // Vertex-/Index-Daten eines renderbaren MeshParamBlocks (formatgetrieben gelesen)
+    struct O3DMeshBuffers
+    {
+        std::size_t blockIndex = 0;       // Index in O3DParsedPart::meshParamBlocks
+
+        asset::parser::o3d::VertexLayout layout;
+        bool layoutFromFvf = false;
+
+        std::uint32_t vertexCount  = 0;
+        std::uint32_t vertexStride = 0;
+        std::vector<std::uint8_t> vertexBytes;
+
+        std::vector<std::uint16_t> indices;
+    };
+
     struct O3DParsedPart
     {
         bool exists = false;
@@ -45,12 +62,10 @@ namespace asset
 
         bool hasVertexBuffer = false;
         std::size_t vertexBufferCursor = 0;
-        std::vector<std::uint8_t> vertexBufferBytes;
 
         bool hasIndexBuffer = false;
         std::size_t indexBufferCursor = 0;
         std::uint32_t indexStride = 0;
-        std::vector<std::uint8_t> indexBufferBytes;
         size_t   meshParamCursor   = 0;
 
         uint32_t vertexCount       = 0;
@@ -66,6 +81,25 @@ namespace asset
         size_t   vertexStartAbs    = 0;
         size_t   indexStartAbs     = 0;
         std::vector<asset::parser::o3d::MeshParamBlockResult> meshParamBlocks;
+
+        // ein Eintrag pro renderbarem Block; die Einzel-Felder oben spiegeln den ersten
+        std::vector<O3DMeshBuffers> meshBuffers;
+
+        // Legacy-Sicht auf die Puffer des ersten Blocks (keine eigene Kopie)
+        std::span<const std::uint8_t> vertexBufferBytes() const
+        {
+            if (meshBuffers.empty())
+                return {};
+            return meshBuffers.front().vertexBytes;
+        }
+
+        std::span<const std::uint8_t> indexBufferBytes() const
+        {
+            if (meshBuffers.empty())
+                return {};
+            const auto& indices = meshBuffers.front().indices;
+            return { reinterpret_cast<const std::uint8_t*>(indices.data()), indices.size() * sizeof(std::uint16_t) };
+        }
     };
 
 
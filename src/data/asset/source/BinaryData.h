@@ -2,20 +2,94 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace asset
 {
-    // Simple owned byte buffer used by loaders/decoders.
+    // Byte buffer used by loaders/decoders.
+    //
+    // Two storage modes behind the same data()/size() interface:
+    // - Owned:  std::vector (heap), writable
+    // - Mapped: read-only view into foreign memory (e.g. a memory-mapped file).
+    //           'owner' keeps the mapping alive as long as any copy exists.
+    //
+    // mutableBytes() promotes a mapped view to an owned copy (copy-on-write),
+    // so in-place users (decrypt) never write into the mapping.
     struct BinaryData
     {
-    std::vector<std::uint8_t> bytes;
+    public:
+        BinaryData() = default;
 
-    void clear() { bytes.clear(); }
-    bool empty() const { return bytes.empty(); }
-    std::size_t size() const { return bytes.size(); }
+        explicit BinaryData(std::vector<std::uint8_t>&& owned)
+            : m_owned(std::move(owned)) {}
 
-    std::uint8_t* data() { return bytes.empty() ? nullptr : bytes.data(); }
-    const std::uint8_t* data() const { return bytes.empty() ? nullptr : bytes.data(); }
+        static BinaryData fromView(std::shared_ptr<const void> owner,
+                                   const std::uint8_t* ptr,
+                                   std::size_t size)
+        {
+            BinaryData d;
+            d.m_owner = std::move(owner);
+            d.m_viewPtr = ptr;
+            d.m_viewSize = size;
+            return d;
+        }
+
+        void clear()
+        {
+            m_owned.clear();
+            m_owner.reset();
+            m_viewPtr = nullptr;
+            m_viewSize = 0;
+        }
+
+        bool isMapped() const { return m_owner != nullptr; }
+
+        bool empty() const { return size() == 0; }
+        std::size_t size() const { return isMapped() ? m_viewSize : m_owned.size(); }
+
+        const std::uint8_t* data() const
+        {
+            if (isMapped())
+                return m_viewPtr;
+            return m_owned.empty() ? nullptr : m_owned.data();
+        }
+
+        std::span<const std::uint8_t> view() const { return { data(), size() }; }
+
+        // Replace content with an owned buffer (drops any mapping).
+        void assign(std::vector<std::uint8_t>&& owned)
+        {
+            clear();
+            m_owned = std::move(owned);
+        }
+
+        // Writable access; promotes a mapped view to an owned copy first.
+        std::vector<std::uint8_t>& mutableBytes()
+        {
+            if (isMapped())
+            {
+                std::vector<std::uint8_t> copy(m_viewPtr, m_viewPtr + m_viewSize);
+                assign(std::move(copy));
+            }
+            return m_owned;
+        }
+
+        // Moves the owned buffer out (promotes first); leaves this empty.
+        std::vector<std::uint8_t> releaseBytes()
+        {
+            std::vector<std::uint8_t> out = std::move(mutableBytes());
+            clear();
+            return out;
+        }
+
+    private:
+        std::vector<std::uint8_t> m_owned;
+
+        std::shared_ptr<const void> m_owner;
+        const std::uint8_t* m_viewPtr = nullptr;
+        std::size_t m_viewSize = 0;
     };
 }
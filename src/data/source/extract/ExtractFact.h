@@ -1,23 +1,135 @@
 #pragma once
+#include <cstdint>
+#include <filesystem>
 #include <string>
+#include <vector>
 
 namespace core::source::extract
 {
+    // Alle bekannten Fact-Typen; Name (factTypeName) bleibt der stabile String für Logs/Snapshots
+    enum class FactType : std::uint16_t
+    {
+        Unknown,
+
+        // SubMeshSchema
+        SubMeshBlockStruct,                  // "SubMesh.Block.Struct"
+        SubMeshBlockArrayRead,               // "SubMesh.Block.ArrayRead"
+
+        // DrawCallSchema
+        DrawCallInvokeDrawIndexedPrimitive,  // "DrawCall.Invoke.DrawIndexedPrimitive"
+        DrawCallPerSubMesh,                  // "DrawCall.PerSubMesh"
+        DrawCallPrimitiveTypeTriangleList,   // "DrawCall.PrimitiveType.TriangleList"
+        DrawCallMappingMaterialBlockField,   // "DrawCall.Mapping.MaterialBlockField"
+        DrawCallGroupingSetGroup,            // "DrawCall.Grouping.SetGroup"
+        DrawCallDelegationModelObjectRender, // "DrawCall.Delegation.ModelObjectRender"
+        MaterialVariantSetTextureEx,         // "Material.Variant.SetTextureEx"
+
+        Count
+    };
+
+    inline const char* factTypeName(FactType t)
+    {
+        switch (t)
+        {
+        case FactType::SubMeshBlockStruct:                  return "SubMesh.Block.Struct";
+        case FactType::SubMeshBlockArrayRead:               return "SubMesh.Block.ArrayRead";
+        case FactType::DrawCallInvokeDrawIndexedPrimitive:  return "DrawCall.Invoke.DrawIndexedPrimitive";
+        case FactType::DrawCallPerSubMesh:                  return "DrawCall.PerSubMesh";
+        case FactType::DrawCallPrimitiveTypeTriangleList:   return "DrawCall.PrimitiveType.TriangleList";
+        case FactType::DrawCallMappingMaterialBlockField:   return "DrawCall.Mapping.MaterialBlockField";
+        case FactType::DrawCallGroupingSetGroup:            return "DrawCall.Grouping.SetGroup";
+        case FactType::DrawCallDelegationModelObjectRender: return "DrawCall.Delegation.ModelObjectRender";
+        case FactType::MaterialVariantSetTextureEx:         return "Material.Variant.SetTextureEx";
+        default:                                            return "Unknown";
+        }
+    }
+
+    // Byte-Bereich in TextUnit::content (CRLF -> LF normalisiert)
+    struct TextSpan
+    {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    // Kompakter, allokationsfreier Fact. Strings (Datei, Gruppe, Extractor)
+    // liegen einmalig in ExtractFacts, Snippets/Payload werden erst bei Bedarf
+    // aus dem TextUnit erzeugt (siehe extract/util/FactText.h).
     struct ExtractFact
     {
-        // z.B. "SubMesh.KeywordHit", "DrawCall.Symbol", "Renderer.LoopPattern"
-        std::string factType;
+        FactType type = FactType::Unknown;
 
         // stabiler Ursprung
-        std::string extractorId;   // z.B. "SubMeshDrawCall"
-        int extractorVersion = 1;
+        std::uint16_t extractor = 0;   // Index in ExtractFacts::extractors
 
         // Provenance
-        std::string file;          // relative oder absolute, je nach Wunsch
-        int line = -1;             // 1-based
+        std::uint32_t file = 0;        // Index in ExtractFacts::files
+        std::uint32_t group = 0;       // Index in ExtractFacts::groups
+        int line = -1;                 // 1-based
         float confidence = 1.0f;
 
-        // v1: Payload als JSON-ish string (später kann das typed werden)
-        std::string payload;
+        // Evidenz: Treffer im Text; Snippet = snippetContext Zeilen um line
+        TextSpan evidence;
+        std::uint8_t snippetContext = 2;
+
+        // zusätzliche Spans (z.B. Feldnamen eines Structs) in ExtractFacts::spans
+        std::uint32_t spanBegin = 0;
+        std::uint32_t spanCount = 0;
+    };
+
+    struct ExtractorInfo
+    {
+        std::string id;                // z.B. "DrawCallSchema"
+        int version = 1;
+    };
+
+    struct FactFile
+    {
+        std::filesystem::path absolutePath;
+        std::string relativePath;      // generic
+    };
+
+    // Facts + Intern-Tabellen. Tabellen werden vor dem Extrahieren
+    // festgelegt (deterministisch), Facts referenzieren sie nur per Index.
+    struct ExtractFacts
+    {
+        std::vector<ExtractFact> facts;
+        std::vector<TextSpan> spans;
+
+        std::vector<ExtractorInfo> extractors;
+        std::vector<std::string> groups;     // SourceGroup::id
+        std::vector<FactFile> files;
+
+        void clear()
+        {
+            facts.clear();
+            spans.clear();
+            extractors.clear();
+            groups.clear();
+            files.clear();
+        }
+
+        std::size_t size() const { return facts.size(); }
+        bool empty() const { return facts.empty(); }
+
+        const FactFile& fileOf(const ExtractFact& f) const { return files[f.file]; }
+        const std::string& groupOf(const ExtractFact& f) const { return groups[f.group]; }
+        const ExtractorInfo& extractorOf(const ExtractFact& f) const { return extractors[f.extractor]; }
+
+        // Facts (+ Spans) aus einem lokalen Puffer mit denselben Tabellen anhängen
+        void appendFacts(ExtractFacts&& local)
+        {
+            const auto base = static_cast<std::uint32_t>(spans.size());
+            spans.insert(spans.end(), local.spans.begin(), local.spans.end());
+
+            facts.reserve(facts.size() + local.facts.size());
+            for (auto& f : local.facts)
+            {
+                f.spanBegin += base;
+                facts.push_back(f);
+            }
+
+            local.facts.clear();
+            local.spans.clear();
+        }
     };
 }
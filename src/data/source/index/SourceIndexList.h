@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <filesystem>
@@ -14,6 +15,10 @@ namespace data::source
 
         std::string extension;
         std::string filename;
+
+        // Stat aus dem Scan (für inkrementelle Läufe, siehe SourceCache)
+        std::uint64_t size = 0;
+        std::int64_t writeTime = 0;   // file_time_type::rep, nur auf derselben Plattform vergleichbar
     };
 
     class SourceIndexList
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace data::source
+{
+
+    // Ein Vorkommen eines Identifiers (Kommentare/Strings sind bereits ausgefiltert)
+    struct TokenOccurrence
+    {
+        std::uint32_t file = 0;      // Index in TokenIndex::files()
+        std::uint32_t line = 0;      // 1-based
+        std::uint32_t offset = 0;    // Byte-Offset in TextUnit::content (CRLF -> LF)
+        std::int32_t function = -1;  // Index in TokenIndex::functions(), -1 = außerhalb eines Funktionsrumpfs
+        bool disabled = false;       // unter "#if 0" (toter Code)
+    };
+
+    // Funktionsdefinition (mit Rumpf), voll qualifiziert über Namespace/Class-Scopes
+    // z.B. "CObject3D::Render"
+    struct IndexedFunction
+    {
+        std::string name;
+        std::uint32_t file = 0;
+        std::uint32_t line = 0;      // Zeile des Namens
+        std::uint32_t endLine = 0;   // Zeile der schließenden '}'
+    };
+
+    struct IndexedFile
+    {
+        std::filesystem::path absolutePath;
+        std::filesystem::path relativePath;
+        std::uint32_t tokenCount = 0;
+    };
+
+    // Identifier -> Vorkommen über alle indizierten Dateien.
+    // Reihenfolge der Vorkommen: Datei-Index, dann Offset (deterministisch).
+    class TokenIndex
+    {
+    public:
+        void clear()
+        {
+            m_files.clear();
+            m_functions.clear();
+            m_identifiers.clear();
+            m_occurrenceCount = 0;
+        }
+
+        std::uint32_t addFile(IndexedFile file)
+        {
+            m_files.emplace_back(std::move(file));
+            return static_cast<std::uint32_t>(m_files.size() - 1);
+        }
+
+        std::int32_t addFunction(IndexedFunction fn)
+        {
+            m_functions.emplace_back(std::move(fn));
+            return static_cast<std::int32_t>(m_functions.size() - 1);
+        }
+
+        void addOccurrence(std::string_view identifier, const TokenOccurrence& occ)
+        {
+            auto it = m_identifiers.find(identifier);
+            if (it == m_identifiers.end())
+                it = m_identifiers.emplace(std::string(identifier), std::vector<TokenOccurrence>{}).first;
+
+            it->second.push_back(occ);
+            ++m_occurrenceCount;
+        }
+
+        // O(1) + O(matches); leerer Vektor, wenn unbekannt
+        const std::vector<TokenOccurrence>& find(std::string_view identifier) const
+        {
+            static const std::vector<TokenOccurrence> kNone;
+            auto it = m_identifiers.find(identifier);
+            return it != m_identifiers.end() ? it->second : kNone;
+        }
+
+        const IndexedFunction* functionOf(const TokenOccurrence& occ) const
+        {
+            return occ.function >= 0 ? &m_functions[static_cast<std::size_t>(occ.function)] : nullptr;
+        }
+
+        const std::vector<IndexedFile>& files() const { return m_files; }
+        const std::vector<IndexedFunction>& functions() const { return m_functions; }
+
+        std::size_t identifierCount() const { return m_identifiers.size(); }
+        std::size_t occurrenceCount() const { return m_occurrenceCount; }
+        bool empty() const { return m_files.empty(); }
+
+    private:
+        struct NameHash
+        {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+        };
+
+        std::vector<IndexedFile> m_files;
+        std::vector<IndexedFunction> m_functions;
+        std::unordered_map<std::string, std::vector<TokenOccurrence>, NameHash, std::equal_to<>> m_identifiers;
+        std::size_t m_occurrenceCount = 0;
+    };
+
+} // namespace data::source
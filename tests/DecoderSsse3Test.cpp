@@ -0,0 +1,161 @@
+// SSSE3-Kernel (DecoderSsse3) gegen skalare Referenz auf Zufallsdaten.
+// Die Referenzen entsprechen den skalaren Pfaden in TgaDecoder/DdsDecoder.
+
+#include "TestCheck.h"
+#include "core/asset/decoder/DecoderSsse3.h"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace asset;
+
+    constexpr std::uint8_t kSentinel = 0xCD;
+
+    // ---- TGA ----
+    enum class Kind { Gray8, BGR24, BGRA32 };
+
+    std::size_t srcBpp(Kind k)
+    {
+        return k == Kind::Gray8 ? 1 : k == Kind::BGR24 ? 3 : 4;
+    }
+
+    void referenceTga(Kind k, const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint8_t* d = dst + i * 4;
+            switch (k)
+            {
+            case Kind::BGRA32: d[0] = src[i * 4 + 2]; d[1] = src[i * 4 + 1]; d[2] = src[i * 4]; d[3] = src[i * 4 + 3]; break;
+            case Kind::BGR24:  d[0] = src[i * 3 + 2]; d[1] = src[i * 3 + 1]; d[2] = src[i * 3]; d[3] = 255; break;
+            case Kind::Gray8:  d[0] = d[1] = d[2] = src[i]; d[3] = 255; break;
+            }
+        }
+    }
+
+    std::size_t runTga(Kind k, const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+    {
+        switch (k)
+        {
+        case Kind::BGRA32: return simd::tgaBgra32(src, dst, count);
+        case Kind::BGR24:  return simd::tgaBgr24(src, dst, count);
+        case Kind::Gray8:  return simd::tgaGray8(src, dst, count);
+        }
+        return 0;
+    }
+
+    void testTga(std::mt19937& rng)
+    {
+        for (Kind k : { Kind::Gray8, Kind::BGR24, Kind::BGRA32 })
+        {
+            for (std::size_t count = 0; count <= 70; ++count)
+            {
+                // exakte Größe: Überlesen fällt unter ASan auf
+                std::vector<std::uint8_t> src(count * srcBpp(k));
+                for (auto& b : src)
+                    b = (std::uint8_t)rng();
+
+                std::vector<std::uint8_t> expect(count * 4);
+                std::vector<std::uint8_t> got(count * 4, kSentinel);
+                referenceTga(k, src.data(), expect.data(), count);
+
+                const std::size_t done = runTga(k, src.data(), got.data(), count);
+                CHECK(done <= count, "kind %d count %zu: %zu pixels", (int)k, count, done);
+                if (done > count)
+                    continue;
+
+                // höchstens ein Vektor (plus BGR24-Reserve) bleibt für den skalaren Rest
+                CHECK(count - done < 16, "kind %d count %zu: only %zu pixels converted", (int)k, count, done);
+
+                CHECK(done == 0 || std::memcmp(got.data(), expect.data(), done * 4) == 0,
+                      "kind %d count %zu: pixels differ", (int)k, count);
+
+                bool untouched = true;
+                for (std::size_t i = done * 4; i < got.size(); ++i)
+                    untouched = untouched && got[i] == kSentinel;
+                CHECK(untouched, "kind %d count %zu: wrote past %zu pixels", (int)k, count, done);
+            }
+        }
+    }
+
+    // ---- BCn ----
+    void testBcColor(std::mt19937& rng)
+    {
+        constexpr std::size_t stride = 4 * 4 + 12;
+
+        for (int iter = 0; iter < 2000; ++iter)
+        {
+            alignas(16) std::uint8_t palette[16];
+            alignas(16) std::uint8_t ctrlRows[4][16];
+            std::uint8_t alpha[16];
+            std::uint8_t idx[16];
+
+            for (auto& b : palette) b = (std::uint8_t)rng();
+            for (auto& b : alpha)   b = (std::uint8_t)rng();
+            for (int p = 0; p < 16; ++p)
+            {
+                idx[p] = (std::uint8_t)(rng() & 3);
+                for (int c = 0; c < 4; ++c)
+                    ctrlRows[p / 4][(p % 4) * 4 + c] = (std::uint8_t)(idx[p] * 4 + c);
+            }
+            const std::uint8_t* const ctrl[4] = { ctrlRows[0], ctrlRows[1], ctrlRows[2], ctrlRows[3] };
+            const bool withAlpha = (iter & 1) != 0;
+
+            std::vector<std::uint8_t> expect(4 * stride, kSentinel);
+            std::vector<std::uint8_t> got(4 * stride, kSentinel);
+            for (int p = 0; p < 16; ++p)
+            {
+                std::uint8_t* d = expect.data() + (p / 4) * stride + (p % 4) * 4;
+                std::memcpy(d, palette + idx[p] * 4, 4);
+                if (withAlpha)
+                    d[3] = alpha[p];
+            }
+
+            simd::bcColorRows(palette, ctrl, withAlpha ? alpha : nullptr, got.data(), stride);
+            CHECK(got == expect, "bcColorRows iter %d (alpha %d) differs", iter, (int)withAlpha);
+        }
+    }
+
+    void testBcRG(std::mt19937& rng)
+    {
+        constexpr std::size_t stride = 4 * 4 + 4;
+
+        for (int iter = 0; iter < 2000; ++iter)
+        {
+            std::uint8_t r[16], g[16];
+            for (auto& b : r) b = (std::uint8_t)rng();
+            for (auto& b : g) b = (std::uint8_t)rng();
+            const bool withG = (iter & 1) != 0;
+
+            std::vector<std::uint8_t> expect(4 * stride, kSentinel);
+            std::vector<std::uint8_t> got(4 * stride, kSentinel);
+            for (int p = 0; p < 16; ++p)
+            {
+                std::uint8_t* d = expect.data() + (p / 4) * stride + (p % 4) * 4;
+                d[0] = r[p]; d[1] = withG ? g[p] : 0; d[2] = 0; d[3] = 255;
+            }
+
+            simd::bcRGRows(r, withG ? g : nullptr, got.data(), stride);
+            CHECK(got == expect, "bcRGRows iter %d (g %d) differs", iter, (int)withG);
+        }
+    }
+}
+
+int main()
+{
+    if (!simd::ssse3Available())
+    {
+        std::printf("SSSE3 kernels not available (compiled %d), skipped\n", (int)simd::ssse3KernelsCompiled());
+        return test::kSkipped;
+    }
+
+    std::mt19937 rng(0x5EED);
+    testTga(rng);
+    testBcColor(rng);
+    testBcRG(rng);
+    return test::testResult();
+}
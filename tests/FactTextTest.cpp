@@ -0,0 +1,234 @@
+// ExtractFacts/FactText: Evidenz-Spans decken genau den Treffer ab, Snippets
+// und Feld-Spans kommen aus dem TextUnit, und der Merge mit Span-Rebasing
+// (wie SourceExtractor: Tabellen vorab interniert, ein Slot pro Datei)
+// liefert dieselben Facts/Payloads wie die Extractoren einzeln.
+
+#include "TestCheck.h"
+#include "SourceTestTree.h"
+
+#include "core/source/extract/schema/DrawCallSchemaExtractor.h"
+#include "core/source/extract/schema/SubMeshSchemaExtractor.h"
+#include "core/source/extract/util/FactText.h"
+#include "core/source/extract/util/TextUnit.h"
+
+#include <fstream>
+#include <map>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace core::source::extract;
+    using util::FactText;
+    using util::TextUnit;
+
+    // Evidenz je Fact-Typ = vollständiger Treffer des v1-Regex
+    const std::regex& evidenceRegex(FactType t)
+    {
+        static const std::map<FactType, std::regex> kRegex = {
+            { FactType::SubMeshBlockStruct,                  std::regex(R"(struct\s+MATERIAL_BLOCK\s*\{[\s\S]*?\};)") },
+            { FactType::SubMeshBlockArrayRead,               std::regex(R"(Read\s*\([^;]*sizeof\s*\(\s*MATERIAL_BLOCK\s*\)[^;]*\)\s*;)") },
+            { FactType::DrawCallInvokeDrawIndexedPrimitive,  std::regex(R"(DrawIndexedPrimitive\s*\()") },
+            { FactType::DrawCallPerSubMesh,                  std::regex(R"(DrawIndexedPrimitive\s*\()") },
+            { FactType::DrawCallPrimitiveTypeTriangleList,   std::regex(R"(D3DPT_TRIANGLELIST)") },
+            { FactType::DrawCallMappingMaterialBlockField,   std::regex(R"(m_nStartVertex|m_nPrimitiveCount|m_nTextureID)") },
+            { FactType::DrawCallGroupingSetGroup,            std::regex(R"(SetGroup\s*\()") },
+            { FactType::MaterialVariantSetTextureEx,         std::regex(R"(SetTextureEx\s*\()") },
+            { FactType::DrawCallDelegationModelObjectRender, std::regex(R"(Render\s*\(\s*pd3dDevice)") },
+        };
+        return kRegex.at(t);
+    }
+
+    void checkText(const ExtractFacts& facts, int seed)
+    {
+        FactText text(facts);
+        const std::regex reField(R"(([A-Za-z_]\w*(?:\s*::\s*[A-Za-z_]\w*)?(?:\s*[\*\&])?)\s+([A-Za-z_]\w*)\s*(?:\[[^\]]+\])?\s*;)");
+
+        for (std::size_t i = 0; i < facts.size(); ++i)
+        {
+            const ExtractFact& f = facts.facts[i];
+            const TextUnit& unit = text.unitOf(f);
+            const std::string evidence(text.evidence(f));
+
+            CHECK(std::regex_match(evidence, evidenceRegex(f.type)), "seed %d fact %zu (%s): evidence \"%s\"",
+                  seed, i, factTypeName(f.type), evidence.c_str());
+
+            if (f.type == FactType::SubMeshBlockStruct)
+            {
+                // Feldnamen als Spans in den Header
+                std::vector<std::string> want;
+                const std::size_t open = evidence.find('{');
+                const std::string body = evidence.substr(open + 1, evidence.size() - open - 3);
+                for (std::sregex_iterator it(body.begin(), body.end(), reField), end; it != end; ++it)
+                    want.push_back((*it)[2].str());
+
+                std::vector<std::string> got;
+                for (std::string_view s : text.spans(f))
+                    got.emplace_back(s);
+                CHECK(got == want, "seed %d fact %zu: %zu field spans, expected %zu", seed, i, got.size(), want.size());
+                CHECK(f.line == 1, "seed %d fact %zu: struct fact on line %d", seed, i, f.line);
+            }
+            else
+            {
+                CHECK(f.spanCount == 0, "seed %d fact %zu (%s): unexpected spans", seed, i, factTypeName(f.type));
+                CHECK(unit.lineOfOffset(f.evidence.offset) == f.line, "seed %d fact %zu (%s): line %d, evidence on %d",
+                      seed, i, factTypeName(f.type), f.line, unit.lineOfOffset(f.evidence.offset));
+            }
+
+            CHECK(text.snippet(f) == unit.snippetAtLine(f.line, f.snippetContext),
+                  "seed %d fact %zu: snippet differs from TextUnit", seed, i);
+        }
+    }
+
+    // Wie SourceExtractor: Tabellen vorab (extractor-major), ein lokaler Slot je Item, Merge per appendFacts
+    ExtractFacts extractMerged(const std::vector<const RuleExtractorBase*>& extractors,
+                               const std::vector<data::source::SourceGroup>& groups)
+    {
+        struct Item
+        {
+            const RuleExtractorBase* extractor = nullptr;
+            FactContext ctx;
+        };
+
+        ExtractFacts out;
+        std::vector<Item> items;
+        std::map<std::string, std::uint32_t> fileIndex;
+        std::map<const data::source::SourceGroup*, std::uint32_t> groupIndex;
+
+        for (const RuleExtractorBase* ex : extractors)
+        {
+            const auto extractorId = static_cast<std::uint16_t>(out.extractors.size());
+            out.extractors.push_back({ ex->id(), ex->version() });
+
+            for (const auto& g : groups)
+            {
+                for (const auto& f : g.files)
+                {
+                    if (!ex->wantsFile(g, f))
+                        continue;
+
+                    auto [fit, fNew] = fileIndex.try_emplace(f.absolutePath.generic_string(), (std::uint32_t)out.files.size());
+                    if (fNew)
+                        out.files.push_back({ f.absolutePath, f.relativePath.generic_string() });
+
+                    auto [git, gNew] = groupIndex.try_emplace(&g, (std::uint32_t)out.groups.size());
+                    if (gNew)
+                        out.groups.push_back(g.id);
+
+                    items.push_back({ ex, FactContext{ g, f, extractorId, git->second, fit->second } });
+                }
+            }
+        }
+
+        std::vector<ExtractFacts> slots(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+            const auto unit = TextUnit::load(items[i].ctx.file.absolutePath, items[i].ctx.file.relativePath);
+            items[i].extractor->extractFile(items[i].ctx, unit, slots[i]);
+        }
+
+        for (auto& s : slots)
+            out.appendFacts(std::move(s));
+        return out;
+    }
+
+    void checkMerged(const ExtractFacts& merged, const std::vector<const ExtractFacts*>& single, int seed)
+    {
+        FactText mergedText(merged);
+
+        std::size_t i = 0;
+        for (const ExtractFacts* facts : single)
+        {
+            FactText singleText(*facts);
+            for (const ExtractFact& s : facts->facts)
+            {
+                CHECK(i < merged.size(), "seed %d: merged has only %zu facts", seed, merged.size());
+                if (i >= merged.size())
+                    return;
+
+                const ExtractFact& m = merged.facts[i];
+                const bool same = m.type == s.type && m.line == s.line && m.confidence == s.confidence &&
+                                  merged.extractorOf(m).id == facts->extractorOf(s).id &&
+                                  merged.groupOf(m) == facts->groupOf(s) &&
+                                  merged.fileOf(m).relativePath == facts->fileOf(s).relativePath &&
+                                  mergedText.evidence(m) == singleText.evidence(s) &&
+                                  mergedText.payloadJson(m) == singleText.payloadJson(s);
+                CHECK(same, "seed %d fact %zu (%s %s:%d): merged differs from single extractor",
+                      seed, i, factTypeName(s.type), facts->fileOf(s).relativePath.c_str(), s.line);
+                ++i;
+            }
+        }
+        CHECK(i == merged.size(), "seed %d: merged %zu facts, single extractors %zu", seed, merged.size(), i);
+    }
+
+    void testFacts()
+    {
+        test::SourceTestTree tree("flyff_fact_text_test");
+        const rules::SubMeshSchemaExtractor subMesh;
+        const rules::DrawCallSchemaExtractor drawCall;
+
+        std::size_t structs = 0, spans = 0;
+        for (int seed = 0; seed < 30; ++seed)
+        {
+            std::mt19937 rng(0xFAC7u + (std::uint32_t)seed);
+            tree.generate(rng);
+
+            ExtractFacts a, b;
+            subMesh.extract(tree.groups(), a);
+            drawCall.extract(tree.groups(), b);
+            checkText(a, seed);
+            checkText(b, seed);
+
+            const ExtractFacts merged = extractMerged({ &subMesh, &drawCall }, tree.groups());
+            checkMerged(merged, { &a, &b }, seed);
+
+            for (const ExtractFact& f : a.facts)
+                structs += f.type == FactType::SubMeshBlockStruct;
+            spans += merged.spans.size();
+        }
+
+        // sonst prüft das Rebasing nichts
+        CHECK(structs > 10 && spans > 50, "too few struct facts (%zu) / spans (%zu) generated", structs, spans);
+    }
+
+    void testChangedFile()
+    {
+        // Datei nach dem Extrahieren gekürzt: Spans zeigen ins Leere -> leere Views statt Überlauf
+        test::SourceTestTree tree("flyff_fact_text_changed");
+        const rules::SubMeshSchemaExtractor subMesh;
+
+        for (std::uint32_t seed = 0; seed < 20; ++seed)
+        {
+            std::mt19937 rng(seed);
+            tree.generate(rng);
+
+            ExtractFacts facts;
+            subMesh.extract(tree.groups(), facts);
+            if (facts.empty())
+                continue;
+
+            for (const FactFile& file : facts.files)
+                std::ofstream(file.absolutePath, std::ios::binary | std::ios::trunc) << "x";
+
+            FactText text(facts);
+            for (const ExtractFact& f : facts.facts)
+            {
+                CHECK(text.evidence(f).empty(), "changed file: evidence not empty");
+                for (std::string_view s : text.spans(f))
+                    CHECK(s.empty(), "changed file: span not empty");
+                text.payloadJson(f);
+            }
+            return;
+        }
+        CHECK(false, "changed file: no facts generated");
+    }
+}
+
+int main()
+{
+    testFacts();
+    testChangedFile();
+    return test::testResult();
+}
@@ -0,0 +1,188 @@
+// MeshOptimizer: Dreiecksmenge (inkl. Windung) und Primitive-Grenzen bleiben
+// erhalten, Dedupe/Fetch-Reihenfolge stimmen, ACMR sinkt auf einem gemischten Gitter.
+
+#include "TestCheck.h"
+#include "core/asset/normalizer/MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    using namespace asset::normalized;
+    using asset::normalizer::MeshOptimizer;
+
+    using Key = std::tuple<float, float, float, float, float>;  // Position + UV
+    using Tri = std::array<Key, 3>;
+
+    Key vertexKey(const NormalizedMesh& m, std::uint32_t i)
+    {
+        const Vec3& p = m.positions[i];
+        const Vec2 uv = m.hasUvs0() ? m.uvs0[i] : Vec2{};
+        return { p.x, p.y, p.z, uv.x, uv.y };
+    }
+
+    // Dreiecke eines Index-Bereichs über Vertex-Inhalte, Rotation normalisiert (Windung bleibt)
+    std::vector<Tri> triangles(const NormalizedMesh& m, const std::vector<std::uint32_t>& indices,
+                               std::uint32_t offset, std::uint32_t count)
+    {
+        std::vector<Tri> out;
+        for (std::uint32_t t = offset; t + 2 < offset + count; t += 3)
+        {
+            Tri tri = { vertexKey(m, indices[t]), vertexKey(m, indices[t + 1]), vertexKey(m, indices[t + 2]) };
+            const auto first = std::min_element(tri.begin(), tri.end());
+            std::rotate(tri.begin(), first, tri.end());
+            out.push_back(tri);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    // w x h Quads, Dreiecke zufällig gemischt, zwei Primitives (obere/untere Hälfte)
+    NormalizedMesh makeGrid(int w, int h, bool duplicateVertices, std::mt19937& rng)
+    {
+        NormalizedMesh m;
+        auto vid = [&](int x, int y) { return std::uint32_t(y * (w + 1) + x); };
+
+        for (int y = 0; y <= h; ++y)
+            for (int x = 0; x <= w; ++x)
+            {
+                m.positions.push_back({ float(x), float(y), 0.0f });
+                m.uvs0.push_back({ float(x) / w, float(y) / h });
+            }
+
+        for (int half = 0; half < 2; ++half)
+        {
+            std::vector<std::array<std::uint32_t, 3>> tris;
+            for (int y = half * h / 2; y < (half + 1) * h / 2; ++y)
+                for (int x = 0; x < w; ++x)
+                {
+                    tris.push_back({ vid(x, y), vid(x + 1, y), vid(x + 1, y + 1) });
+                    tris.push_back({ vid(x, y), vid(x + 1, y + 1), vid(x, y + 1) });
+                }
+            std::shuffle(tris.begin(), tris.end(), rng);
+
+            NormalizedPrimitive prim;
+            prim.indexOffset = std::uint32_t(m.indices.size());
+            prim.indexCount = std::uint32_t(tris.size() * 3);
+            prim.materialSlot = half;
+            m.primitives.push_back(prim);
+
+            for (const auto& t : tris)
+                m.indices.insert(m.indices.end(), t.begin(), t.end());
+        }
+
+        if (duplicateVertices)
+        {
+            // jede Ecke als eigener Vertex (wie ungeteilte Quelldaten)
+            NormalizedMesh d = m;
+            d.positions.clear();
+            d.uvs0.clear();
+            for (std::uint32_t& i : d.indices)
+            {
+                d.positions.push_back(m.positions[i]);
+                d.uvs0.push_back(m.uvs0[i]);
+                i = std::uint32_t(d.positions.size() - 1);
+            }
+            return d;
+        }
+        return m;
+    }
+
+    void checkPreserved(const NormalizedMesh& before, const NormalizedMesh& after, const char* what)
+    {
+        CHECK(after.primitives.size() == before.primitives.size(), "%s: primitive count", what);
+        CHECK(after.indices.size() == before.indices.size(), "%s: index count", what);
+        if (after.primitives.size() != before.primitives.size())
+            return;
+
+        for (std::size_t p = 0; p < before.primitives.size(); ++p)
+        {
+            const auto& a = before.primitives[p];
+            const auto& b = after.primitives[p];
+            CHECK(a.indexOffset == b.indexOffset && a.indexCount == b.indexCount && a.materialSlot == b.materialSlot,
+                  "%s: primitive %zu range changed", what, p);
+            CHECK(triangles(before, before.indices, a.indexOffset, a.indexCount) ==
+                  triangles(after, after.indices, b.indexOffset, b.indexCount),
+                  "%s: primitive %zu triangle set changed", what, p);
+        }
+    }
+
+    void checkFetchOrder(const NormalizedMesh& m, const char* what)
+    {
+        // Vertices in Reihenfolge der ersten Verwendung, keiner unbenutzt
+        std::uint32_t next = 0;
+        bool ordered = true;
+        for (std::uint32_t i : m.indices)
+        {
+            if (i == next)
+                ++next;
+            else if (i > next)
+                ordered = false;
+        }
+        CHECK(ordered, "%s: vertices not in first-use order", what);
+        CHECK(next == m.positions.size(), "%s: %zu vertices, %u referenced", what, m.positions.size(), next);
+    }
+
+    void testGrid(std::mt19937& rng)
+    {
+        const NormalizedMesh before = makeGrid(120, 120, false, rng);
+        NormalizedMesh after = before;
+
+        MeshOptimizer::Stats stats;
+        std::string err;
+        CHECK(MeshOptimizer::optimize(after, MeshOptimizer::Options{}, &stats, &err), "optimize: %s", err.c_str());
+
+        checkPreserved(before, after, "grid");
+        checkFetchOrder(after, "grid");
+
+        // gemischtes Gitter: ~3 Misses pro Dreieck, optimiert deutlich unter 1
+        CHECK(stats.acmrBefore > 2.5f, "grid: acmrBefore %.3f", stats.acmrBefore);
+        CHECK(stats.acmrAfter < 0.8f, "grid: acmrAfter %.3f", stats.acmrAfter);
+        CHECK(stats.verticesAfter == before.positions.size(), "grid: %zu vertices after", stats.verticesAfter);
+    }
+
+    void testDedupe(std::mt19937& rng)
+    {
+        const NormalizedMesh shared = makeGrid(16, 10, false, rng);
+        const NormalizedMesh before = makeGrid(16, 10, true, rng);
+        NormalizedMesh after = before;
+
+        MeshOptimizer::Stats stats;
+        CHECK(MeshOptimizer::optimize(after, MeshOptimizer::Options{}, &stats), "optimize (dedupe)");
+
+        checkPreserved(before, after, "dedupe");
+        checkFetchOrder(after, "dedupe");
+        CHECK(stats.verticesBefore == before.positions.size(), "dedupe: verticesBefore %zu", stats.verticesBefore);
+        CHECK(after.positions.size() == shared.positions.size(),
+              "dedupe: %zu vertices, expected %zu", after.positions.size(), shared.positions.size());
+    }
+
+    void testIndicesOnly(std::mt19937& rng)
+    {
+        // LOD-Pfad: nur Indizes, Vertex-Arrays bleiben unangetastet
+        const NormalizedMesh before = makeGrid(40, 24, false, rng);
+        NormalizedMesh after = before;
+
+        MeshOptimizer::optimizeIndices(after.indices, after.primitives, after.positions, MeshOptimizer::Options{});
+
+        CHECK(after.positions.size() == before.positions.size(), "indices only: vertex count changed");
+        checkPreserved(before, after, "indices only");
+        CHECK(MeshOptimizer::acmr(after.indices, after.positions.size()) <
+              MeshOptimizer::acmr(before.indices, before.positions.size()),
+              "indices only: ACMR did not improve");
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(0xAC3);
+    testGrid(rng);
+    testDedupe(rng);
+    testIndicesOnly(rng);
+    return test::testResult();
+}
@@ -0,0 +1,201 @@
+// PngEncoder: Round-Trip über stb_image für alle Level, seriell und parallel,
+// dazu Chunk-CRCs und die Adler-32-Summe des zlib-Streams. 700x400 wird
+// parallel in mehrere Bereiche geteilt (Sync-Flush + kombinierte Adler-32).
+
+#include "TestCheck.h"
+#include "core/asset/writer/PngEncoder.h"
+
+#include "stb_image.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using asset::PngEncoder;
+
+    std::uint32_t readBE32(const std::uint8_t* p)
+    {
+        return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | p[3];
+    }
+
+    std::uint32_t crc32(const std::uint8_t* p, std::size_t n)
+    {
+        std::uint32_t c = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            c ^= p[i];
+            for (int k = 0; k < 8; ++k)
+                c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1u)));
+        }
+        return c ^ 0xFFFFFFFFu;
+    }
+
+    std::uint32_t adler32(const std::uint8_t* p, std::size_t n)
+    {
+        std::uint32_t a = 1, b = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a = (a + p[i]) % 65521u;
+            b = (b + a) % 65521u;
+        }
+        return (b << 16) | a;
+    }
+
+    // Chunks durchgehen, CRCs prüfen, IDAT zusammensetzen
+    bool checkContainer(const std::vector<std::uint8_t>& png, std::vector<std::uint8_t>& idat, std::string& why)
+    {
+        static const std::uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        if (png.size() < 8 || std::memcmp(png.data(), sig, 8) != 0)
+        {
+            why = "bad signature";
+            return false;
+        }
+
+        std::size_t off = 8;
+        bool sawEnd = false;
+        while (off + 12 <= png.size())
+        {
+            const std::uint32_t len = readBE32(&png[off]);
+            if (off + 12 + len > png.size())
+            {
+                why = "truncated chunk";
+                return false;
+            }
+
+            const std::uint8_t* type = &png[off + 4];
+            if (crc32(type, 4 + len) != readBE32(type + 4 + len))
+            {
+                why = "CRC mismatch in " + std::string(reinterpret_cast<const char*>(type), 4);
+                return false;
+            }
+
+            if (std::memcmp(type, "IDAT", 4) == 0)
+                idat.insert(idat.end(), type + 4, type + 4 + len);
+            sawEnd = std::memcmp(type, "IEND", 4) == 0;
+            off += 12 + len;
+        }
+
+        if (!sawEnd || off != png.size())
+        {
+            why = "missing IEND or trailing bytes";
+            return false;
+        }
+        return true;
+    }
+
+    enum class Content { Noise, Gradient, Flat, Pattern };
+
+    std::vector<std::uint8_t> makeImage(int w, int h, Content c, std::mt19937& rng)
+    {
+        std::vector<std::uint8_t> rgba(std::size_t(w) * h * 4);
+        for (int y = 0; y < h; ++y)
+        {
+            for (int x = 0; x < w; ++x)
+            {
+                std::uint8_t* p = &rgba[(std::size_t(y) * w + x) * 4];
+                switch (c)
+                {
+                case Content::Noise:
+                    for (int k = 0; k < 4; ++k) p[k] = std::uint8_t(rng());
+                    break;
+                case Content::Gradient:
+                    p[0] = std::uint8_t(x); p[1] = std::uint8_t(y); p[2] = std::uint8_t(x + y); p[3] = 255;
+                    break;
+                case Content::Flat:
+                    p[0] = 40; p[1] = 80; p[2] = 120; p[3] = 200;
+                    break;
+                case Content::Pattern:
+                    p[0] = std::uint8_t((x / 3) * 17); p[1] = std::uint8_t((y % 5) * 50);
+                    p[2] = std::uint8_t(((x ^ y) & 8) ? 255 : 0); p[3] = std::uint8_t(x % 7 == 0 ? 0 : 255);
+                    break;
+                }
+            }
+        }
+        return rgba;
+    }
+
+    const char* levelName(PngEncoder::Level l)
+    {
+        switch (l)
+        {
+        case PngEncoder::Level::Store:   return "Store";
+        case PngEncoder::Level::Fast:    return "Fast";
+        case PngEncoder::Level::Default: return "Default";
+        case PngEncoder::Level::Best:    return "Best";
+        }
+        return "?";
+    }
+
+    void roundTrip(int w, int h, Content c, PngEncoder::Level level, bool parallel, std::mt19937& rng)
+    {
+        const std::vector<std::uint8_t> rgba = makeImage(w, h, c, rng);
+
+        PngEncoder::Options opts;
+        opts.level = level;
+        opts.parallel = parallel;
+        opts.parallelMinBytes = parallel ? 64u * 1024u : opts.parallelMinBytes;
+
+        std::vector<std::uint8_t> png;
+        std::string err;
+        const bool ok = PngEncoder::encodeRGBA(png, w, h, rgba.data(), opts, &err);
+        CHECK(ok, "%dx%d %s par=%d: encode failed: %s", w, h, levelName(level), (int)parallel, err.c_str());
+        if (!ok)
+            return;
+
+        std::vector<std::uint8_t> idat;
+        std::string why;
+        const bool container = checkContainer(png, idat, why);
+        CHECK(container, "%dx%d %s par=%d: %s", w, h, levelName(level), (int)parallel, why.c_str());
+        if (!container || idat.size() < 6)
+            return;
+
+        // zlib-Stream entpacken und Adler-32 über die gefilterten Zeilen nachrechnen
+        int rawLen = 0;
+        char* raw = stbi_zlib_decode_malloc_guesssize_headerflag(
+            reinterpret_cast<const char*>(idat.data()), (int)idat.size(),
+            (int)(std::size_t(w) * 4 + 1) * h, &rawLen, 1);
+        CHECK(raw != nullptr, "%dx%d %s par=%d: inflate failed", w, h, levelName(level), (int)parallel);
+        if (raw)
+        {
+            CHECK(rawLen == (w * 4 + 1) * h, "%dx%d %s: raw size %d", w, h, levelName(level), rawLen);
+            CHECK(adler32(reinterpret_cast<const std::uint8_t*>(raw), (std::size_t)rawLen) == readBE32(&idat[idat.size() - 4]),
+                  "%dx%d %s par=%d: Adler-32 mismatch", w, h, levelName(level), (int)parallel);
+            std::free(raw);
+        }
+
+        int dw = 0, dh = 0, comp = 0;
+        stbi_uc* dec = stbi_load_from_memory(png.data(), (int)png.size(), &dw, &dh, &comp, 4);
+        CHECK(dec != nullptr, "%dx%d %s par=%d: stb_image: %s", w, h, levelName(level), (int)parallel, stbi_failure_reason());
+        if (!dec)
+            return;
+
+        CHECK(dw == w && dh == h, "%dx%d decoded as %dx%d", w, h, dw, dh);
+        if (dw == w && dh == h)
+            CHECK(std::memcmp(dec, rgba.data(), rgba.size()) == 0,
+                  "%dx%d %s par=%d content %d: pixels differ", w, h, levelName(level), (int)parallel, (int)c);
+        stbi_image_free(dec);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(0x9E37);
+
+    const int sizes[][2] = { { 1, 1 }, { 3, 7 }, { 64, 1 }, { 257, 129 }, { 300, 300 }, { 700, 400 } };
+    const PngEncoder::Level levels[] = {
+        PngEncoder::Level::Store, PngEncoder::Level::Fast, PngEncoder::Level::Default, PngEncoder::Level::Best
+    };
+
+    for (const auto& sz : sizes)
+        for (Content c : { Content::Noise, Content::Gradient, Content::Flat, Content::Pattern })
+            for (PngEncoder::Level l : levels)
+                for (bool parallel : { false, true })
+                    roundTrip(sz[0], sz[1], c, l, parallel, rng);
+
+    return test::testResult();
+}
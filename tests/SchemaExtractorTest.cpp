@@ -0,0 +1,275 @@
+// Schema-Extractoren gegen die frühere std::regex-Fassung als Referenz:
+// gleiche Facts (Typ, Datei, Zeile, Confidence, Payload) in gleicher
+// Reihenfolge auf zufälligen Quellbäumen. DrawCall v2 fragt den TokenIndex ab,
+// Treffer beginnen also an Token-Grenzen (\b in der Referenz); Kommentare,
+// Strings und "#if 0" erzeugt der Baum nicht mit Treffern darin, die prüft
+// TokenIndexTest. Dazu PatternScanner direkt gegen die Regex-Ausdrücke.
+
+#include "TestCheck.h"
+#include "SourceTestTree.h"
+
+#include "core/source/extract/schema/DrawCallSchemaExtractor.h"
+#include "core/source/extract/schema/SubMeshSchemaExtractor.h"
+#include "core/source/extract/util/FactText.h"
+#include "core/source/extract/util/PatternScanner.h"
+#include "core/source/extract/util/TextUnit.h"
+
+#include <cstring>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace core::source::extract;
+    using util::jsonEscape;
+    using util::PatternScanner;
+    using util::TextUnit;
+
+    struct RefFact
+    {
+        std::string type;
+        std::string file;
+        int line = -1;
+        float confidence = 1.0f;
+        std::string payload;
+    };
+
+    // ---------------------------------------------------------------
+    // Referenz: Regex-Extractoren (Stand vor PatternScanner, DrawCall mit Token-Grenzen)
+    // ---------------------------------------------------------------
+    bool endsWith(const std::string& s, const char* suffix)
+    {
+        const std::size_t n = std::strlen(suffix);
+        return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+    }
+
+    void referenceSubMesh(const std::vector<data::source::SourceGroup>& groups, std::vector<RefFact>& out)
+    {
+        const std::regex reStruct(R"(struct\s+MATERIAL_BLOCK\s*\{([\s\S]*?)\};)");
+        const std::regex reField(R"(([A-Za-z_]\w*(?:\s*::\s*[A-Za-z_]\w*)?(?:\s*[\*\&])?)\s+([A-Za-z_]\w*)\s*(?:\[[^\]]+\])?\s*;)");
+        const std::regex reRead(R"(Read\s*\([^;]*sizeof\s*\(\s*MATERIAL_BLOCK\s*\)[^;]*\)\s*;)");
+
+        for (const auto& g : groups)
+        {
+            bool common = false;
+            for (const auto& f : g.files)
+                common = common || f.relativePath.generic_string().find("_Common/Object3D") != std::string::npos;
+            if (!common)
+                continue;
+
+            for (const auto& f : g.files)
+            {
+                const std::string rel = f.relativePath.generic_string();
+                if (!endsWith(rel, "Object3D.h") && !endsWith(rel, "Object3D.cpp"))
+                    continue;
+
+                const TextUnit unit = TextUnit::load(f.absolutePath, f.relativePath);
+
+                if (endsWith(rel, "Object3D.h"))
+                {
+                    std::smatch m;
+                    if (std::regex_search(unit.content, m, reStruct))
+                    {
+                        const std::string body = m[1].str();
+                        std::string fields = "[";
+                        for (std::sregex_iterator it(body.begin(), body.end(), reField), end; it != end; ++it)
+                        {
+                            if (fields.size() > 1)
+                                fields += ",";
+                            fields += "\"" + jsonEscape((*it)[2].str()) + "\"";
+                        }
+                        fields += "]";
+                        out.push_back({ "SubMesh.Block.Struct", rel, 1, 1.0f,
+                                        "{\"struct\":\"MATERIAL_BLOCK\",\"fields\":" + fields + "}" });
+                    }
+                }
+
+                if (endsWith(rel, "Object3D.cpp"))
+                {
+                    for (std::sregex_iterator it(unit.content.begin(), unit.content.end(), reRead), end; it != end; ++it)
+                    {
+                        const int line = unit.lineOfOffset((std::size_t)it->position());
+                        out.push_back({ "SubMesh.Block.ArrayRead", rel, line, 0.95f,
+                                        "{\"hint\":\"Read MATERIAL_BLOCK array\",\"snippet\":\"" +
+                                            jsonEscape(unit.snippetAtLine(line, 2)) + "\"}" });
+                    }
+                }
+            }
+        }
+    }
+
+    void referenceDrawCall(const std::vector<data::source::SourceGroup>& groups, std::vector<RefFact>& out)
+    {
+        const std::regex reDIP(R"(\bDrawIndexedPrimitive\s*\()");
+        const std::regex reTriList(R"(\bD3DPT_TRIANGLELIST\b)");
+        const std::regex reMapping(R"(\b(m_nStartVertex|m_nPrimitiveCount|m_nTextureID)\b)");
+        const std::regex reSetGroup(R"(\bSetGroup\s*\()");
+        const std::regex reSetTextureEx(R"(\bSetTextureEx\s*\()");
+        const std::regex reRenderCall(R"(\bRender\s*\(\s*pd3dDevice)");
+
+        for (const auto& g : groups)
+        {
+            for (const auto& f : g.files)
+            {
+                const std::string rel = f.relativePath.generic_string();
+                const bool isObject3D = rel.find("_Common/Object3D.cpp") != std::string::npos;
+                const bool isModelObject = rel.find("_Common/ModelObject.cpp") != std::string::npos;
+                const bool isObj = rel.find("_Common/Obj.cpp") != std::string::npos;
+                if (!isObject3D && !isModelObject && !isObj)
+                    continue;
+
+                const TextUnit unit = TextUnit::load(f.absolutePath, f.relativePath);
+
+                auto emit = [&](const char* type, std::size_t off, float conf, int ctx)
+                {
+                    const int line = unit.lineOfOffset(off);
+                    out.push_back({ type, rel, line, conf,
+                                    "{\"groupId\":\"" + jsonEscape(g.id) + "\",\"snippet\":\"" +
+                                        jsonEscape(unit.snippetAtLine(line, ctx)) + "\"}" });
+                };
+
+                auto each = [&](const std::regex& re, auto&& fn)
+                {
+                    for (std::sregex_iterator it(unit.content.begin(), unit.content.end(), re), end; it != end; ++it)
+                        fn((std::size_t)it->position());
+                };
+
+                if (isObject3D)
+                {
+                    each(reDIP, [&](std::size_t off)
+                    {
+                        emit("DrawCall.Invoke.DrawIndexedPrimitive", off, 1.0f, 2);
+                        emit("DrawCall.PerSubMesh", off, 0.9f, 2);
+                    });
+                    each(reTriList, [&](std::size_t off) { emit("DrawCall.PrimitiveType.TriangleList", off, 1.0f, 1); });
+                    each(reMapping, [&](std::size_t off) { emit("DrawCall.Mapping.MaterialBlockField", off, 0.8f, 1); });
+                }
+
+                if (isObj)
+                {
+                    each(reSetGroup, [&](std::size_t off) { emit("DrawCall.Grouping.SetGroup", off, 0.95f, 2); });
+                    each(reSetTextureEx, [&](std::size_t off) { emit("Material.Variant.SetTextureEx", off, 0.9f, 2); });
+                }
+
+                if (isModelObject)
+                    each(reRenderCall, [&](std::size_t off) { emit("DrawCall.Delegation.ModelObjectRender", off, 0.7f, 2); });
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------
+    void compare(const RuleExtractorBase& extractor, const std::vector<RefFact>& expect,
+                 const std::vector<data::source::SourceGroup>& groups, int seed)
+    {
+        ExtractFacts facts;
+        extractor.extract(groups, facts);
+        util::FactText text(facts);
+
+        CHECK(facts.size() == expect.size(), "seed %d %s: %zu facts, reference %zu",
+              seed, extractor.id().c_str(), facts.size(), expect.size());
+
+        const std::size_t n = std::min(facts.size(), expect.size());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const ExtractFact& f = facts.facts[i];
+            const RefFact& r = expect[i];
+            const std::string payload = text.payloadJson(f);
+
+            const bool same = r.type == factTypeName(f.type) && r.file == facts.fileOf(f).relativePath &&
+                              r.line == f.line && r.confidence == f.confidence && r.payload == payload &&
+                              facts.extractorOf(f).id == extractor.id();
+            CHECK(same, "seed %d %s fact %zu:\n  ref %s %s:%d %.2f %s\n  got %s %s:%d %.2f %s",
+                  seed, extractor.id().c_str(), i,
+                  r.type.c_str(), r.file.c_str(), r.line, r.confidence, r.payload.c_str(),
+                  factTypeName(f.type), facts.fileOf(f).relativePath.c_str(), f.line, f.confidence, payload.c_str());
+            if (!same)
+                return;
+        }
+    }
+
+    void testExtractors()
+    {
+        test::SourceTestTree tree("flyff_schema_extractor_test");
+        const rules::SubMeshSchemaExtractor subMesh;
+        const rules::DrawCallSchemaExtractor drawCall;
+
+        for (int seed = 0; seed < 40; ++seed)
+        {
+            std::mt19937 rng((std::uint32_t)seed);
+            tree.generate(rng);
+
+            std::vector<RefFact> refSubMesh, refDrawCall;
+            referenceSubMesh(tree.groups(), refSubMesh);
+            referenceDrawCall(tree.groups(), refDrawCall);
+
+            compare(subMesh, refSubMesh, tree.groups(), seed);
+            compare(drawCall, refDrawCall, tree.groups(), seed);
+        }
+    }
+
+    // ---------------------------------------------------------------
+    // PatternScanner direkt: Treffer je Pattern == Regex-Treffer
+    // ---------------------------------------------------------------
+    void testScanner()
+    {
+        struct Case
+        {
+            PatternScanner::Pattern pattern;
+            const char* regex;
+        };
+
+        const std::vector<Case> cases = {
+            { { "ab", 0, true, true, {} }, R"(\bab\b)" },
+            { { "abc", 1, false, false, {} }, R"(abc)" },
+            { { "ab", 2, true, false, { { "(", false }, { "c", false } } }, R"(\bab\s*\(\s*c)" },
+            { { "b", 3, false, true, { { "c", true } } }, R"(b\s+c\b)" },
+        };
+
+        PatternScanner scanner;
+        for (const Case& c : cases)
+            scanner.add(c.pattern);
+        scanner.build();
+
+        static const char* const kPieces[] = { "a", "b", "c", "ab", "abc", " ", "\t", "\n", "(", "_", "x" };
+        std::mt19937 rng(0x5CA);
+        std::vector<PatternScanner::Hit> hits;
+
+        for (int iter = 0; iter < 3000; ++iter)
+        {
+            std::string text;
+            const int n = int(rng() % 40);
+            for (int i = 0; i < n; ++i)
+                text += kPieces[rng() % (sizeof(kPieces) / sizeof(kPieces[0]))];
+
+            scanner.scan(text, hits);
+
+            for (std::size_t p = 0; p < cases.size(); ++p)
+            {
+                std::vector<std::pair<std::size_t, std::size_t>> want, got;
+                const std::regex re(cases[p].regex);
+                for (std::sregex_iterator it(text.begin(), text.end(), re), end; it != end; ++it)
+                    want.emplace_back((std::size_t)it->position(), (std::size_t)(it->position() + it->length()));
+                for (const auto& h : hits)
+                    if (h.pattern == (int)p)
+                        got.emplace_back(h.begin, h.end);
+
+                CHECK(want == got, "scanner pattern %zu (%s) on \"%s\": %zu hits, regex %zu",
+                      p, cases[p].regex, text.c_str(), got.size(), want.size());
+            }
+
+            bool sorted = true;
+            for (std::size_t i = 1; i < hits.size(); ++i)
+                sorted = sorted && hits[i - 1].begin <= hits[i].begin;
+            CHECK(sorted, "scanner hits not sorted by offset");
+        }
+    }
+}
+
+int main()
+{
+    testScanner();
+    testExtractors();
+    return test::testResult();
+}
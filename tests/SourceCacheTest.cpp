@@ -0,0 +1,278 @@
+// SourceCache: Läufe wie in SourcePipeline (Scan -> load -> sameTree/restore
+// -> Extract mit Cache -> storeTree/storeResult/save) mit einer Cache-Instanz.
+// Ungeänderter Baum: keine Datei gelesen, Ergebnis direkt aus dem Cache;
+// eine geänderte Datei wird als einzige neu gelesen. Facts immer gleich einem
+// Lauf ohne Cache. Kaputte oder alte Cache-Dateien laden als leerer Cache.
+
+#include "TestCheck.h"
+#include "SourceTestTree.h"
+
+#include "core/source/cache/SourceCache.h"
+#include "core/source/extract/SourceExtract.h"
+#include "core/source/extract/util/FactText.h"
+#include "core/source/scan/SourceScanner.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    using namespace core::source::extract;
+    using core::source::cache::SourceCache;
+    using data::source::SourceGroup;
+    using data::source::SourceIndexList;
+
+    constexpr std::uint64_t kTreeKey = 0x7E57u;
+
+    SourceIndexList scan(const fs::path& root)
+    {
+        core::source::SourceScanner::Settings s;
+        s.sourceRoot = root;
+        SourceIndexList index;
+        core::source::SourceScanner(s).scan(index);
+        return index;
+    }
+
+    // wie SourceTestTree: eine Gruppe pro Stem, aber mit den Scan-Einträgen (Größe/Schreibzeit)
+    std::vector<SourceGroup> groupsOf(const SourceIndexList& index)
+    {
+        std::map<std::string, SourceGroup> byStem;
+        for (const auto& f : index.files())
+        {
+            auto& g = byStem[f.relativePath.stem().string()];
+            g.id = f.relativePath.stem().string();
+            g.files.push_back(f);
+        }
+
+        std::vector<SourceGroup> out;
+        for (auto& [stem, g] : byStem)
+            out.push_back(std::move(g));
+        return out;
+    }
+
+    // vergleichbare Textform (Tabellen aufgelöst, Evidenz/Payload aus den Dateien)
+    std::vector<std::string> describe(const ExtractFacts& facts)
+    {
+        util::FactText text(facts);
+        std::vector<std::string> out;
+        out.reserve(facts.size());
+        for (const ExtractFact& f : facts.facts)
+        {
+            out.push_back(std::string(factTypeName(f.type)) + " " + facts.extractorOf(f).id + " " +
+                          facts.groupOf(f) + " " + facts.fileOf(f).relativePath + ":" + std::to_string(f.line) +
+                          " " + std::to_string(f.confidence) + " [" + std::string(text.evidence(f)) + "] " +
+                          text.payloadJson(f));
+        }
+        return out;
+    }
+
+    struct Run
+    {
+        bool unchanged = false;                 // sameTree + restoreGroups + restoreResult
+        std::vector<std::string> restored;      // Ergebnis aus dem Cache (nur bei unchanged)
+        std::vector<std::string> extracted;     // Extract mit Cache
+        std::vector<std::string> reference;     // Extract ohne Cache
+        SourceExtractor::Stats stats;
+    };
+
+    Run runPipeline(SourceCache& cache, const fs::path& root, const SourceExtractor& extractor)
+    {
+        Run run;
+        std::string err;
+        CHECK(cache.load(&err), "load: %s", err.c_str());
+
+        const SourceIndexList index = scan(root);
+
+        std::vector<SourceGroup> groups;
+        ExtractFacts restored;
+        if (cache.sameTree(kTreeKey, index) && cache.restoreGroups(index, groups) &&
+            cache.restoreResult(extractor.extractorInfos(), restored))
+        {
+            run.unchanged = true;
+            run.restored = describe(restored);
+        }
+
+        // Gruppen wie SourcePipeline::collectSource: gleiche Dateiliste -> aus dem Cache
+        if (!cache.sameFiles(kTreeKey, index) || !cache.restoreGroups(index, groups))
+            groups = groupsOf(index);
+
+        ExtractFacts facts;
+        extractor.extract(groups, facts, &cache, &run.stats);
+        run.extracted = describe(facts);
+
+        ExtractFacts reference;
+        extractor.extract(groupsOf(index), reference);
+        run.reference = describe(reference);
+
+        cache.storeTree(kTreeKey, index, groups);
+        cache.storeResult(facts);
+        CHECK(cache.save(&err), "save: %s", err.c_str());
+        return run;
+    }
+
+    void checkFacts(const Run& run, const char* what)
+    {
+        CHECK(!run.reference.empty(), "%s: no facts generated", what);
+        CHECK(run.extracted == run.reference, "%s: %zu facts with cache, %zu without",
+              what, run.extracted.size(), run.reference.size());
+        if (run.unchanged)
+            CHECK(run.restored == run.reference, "%s: restored %zu facts, expected %zu",
+                  what, run.restored.size(), run.reference.size());
+    }
+
+    std::vector<char> readFile(const fs::path& p)
+    {
+        std::ifstream f(p, std::ios::binary);
+        return { std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>() };
+    }
+
+    void writeFile(const fs::path& p, const std::vector<char>& bytes)
+    {
+        std::ofstream(p, std::ios::binary | std::ios::trunc).write(bytes.data(), (std::streamsize)bytes.size());
+    }
+
+    // Inhalt ändern und Schreibzeit sicher weiterdrehen (grobe mtime-Auflösung)
+    void touch(const fs::path& p)
+    {
+        const auto before = fs::last_write_time(p);
+        std::ofstream(p, std::ios::binary | std::ios::app) << "\nDrawIndexedPrimitive(";
+        fs::last_write_time(p, before + std::chrono::seconds(2));
+    }
+
+    void checkEmpty(const SourceCache& cache, const SourceExtractor& extractor, const SourceIndexList& index,
+                    const char* what)
+    {
+        ExtractFacts facts;
+        CHECK(cache.fileCount() == 0 && cache.factsEntryCount() == 0, "%s: cache not empty (%zu files, %zu facts)",
+              what, cache.fileCount(), cache.factsEntryCount());
+        CHECK(!cache.sameFiles(kTreeKey, index) && !cache.sameTree(kTreeKey, index), "%s: tree still known", what);
+        CHECK(!cache.restoreResult(extractor.extractorInfos(), facts), "%s: result still restorable", what);
+    }
+
+    void testIncremental()
+    {
+        test::SourceTestTree tree("flyff_source_cache_test");
+        const fs::path cacheFile = fs::temp_directory_path() / "flyff_source_cache_test.bin";
+        const SourceExtractor extractor;
+
+        for (std::uint32_t seed = 0; seed < 10; ++seed)
+        {
+            std::mt19937 rng(0xCAC4Eu + seed);
+            tree.generate(rng);
+            fs::remove(cacheFile);
+
+            SourceCache cache(cacheFile);
+
+            // 1) leerer Cache: alles gelesen
+            const Run first = runPipeline(cache, tree.root(), extractor);
+            CHECK(!first.unchanged, "seed %u: first run reported unchanged tree", seed);
+            CHECK(first.stats.files > 0 && first.stats.filesLoaded == first.stats.files && first.stats.filesReused == 0,
+                  "seed %u first run: %s", seed, first.stats.summary().c_str());
+            checkFacts(first, "first run");
+
+            // 2) unverändert: direkt aus dem Cache, keine Datei gelesen
+            const Run second = runPipeline(cache, tree.root(), extractor);
+            CHECK(second.unchanged, "seed %u: unchanged tree not restored", seed);
+            CHECK(second.stats.filesLoaded == 0 && second.stats.filesReused == second.stats.files &&
+                  second.stats.itemsExtracted == 0,
+                  "seed %u unchanged run: %s", seed, second.stats.summary().c_str());
+            checkFacts(second, "unchanged run");
+            CHECK(second.extracted == first.extracted, "seed %u: unchanged run differs from first run", seed);
+
+            // 3) eine Datei geändert: genau diese wird gelesen
+            touch(tree.root() / "d0" / "_Common" / "Object3D.cpp");
+            const Run third = runPipeline(cache, tree.root(), extractor);
+            CHECK(!third.unchanged, "seed %u: changed tree reported unchanged", seed);
+            CHECK(third.stats.filesLoaded == 1 && third.stats.filesReused == third.stats.files - 1,
+                  "seed %u one file touched: %s", seed, third.stats.summary().c_str());
+            checkFacts(third, "touched run");
+
+            // 4) und danach wieder unverändert
+            const Run fourth = runPipeline(cache, tree.root(), extractor);
+            CHECK(fourth.unchanged && fourth.stats.filesLoaded == 0, "seed %u after touch: %s",
+                  seed, fourth.stats.summary().c_str());
+            checkFacts(fourth, "run after touch");
+        }
+
+        fs::remove(cacheFile);
+    }
+
+    void testBrokenFile()
+    {
+        test::SourceTestTree tree("flyff_source_cache_broken");
+        const fs::path cacheFile = fs::temp_directory_path() / "flyff_source_cache_broken.bin";
+        const SourceExtractor extractor;
+
+        std::mt19937 rng(0xB40Cu);
+        tree.generate(rng);
+        fs::remove(cacheFile);
+
+        SourceCache cache(cacheFile);
+        runPipeline(cache, tree.root(), extractor);
+        const SourceIndexList index = scan(tree.root());
+        const std::vector<char> good = readFile(cacheFile);
+        CHECK(good.size() > 8, "cache file not written");
+        if (good.size() <= 8)
+            return;
+
+        std::string err;
+
+        // gültiger Cache zum Gegenprüfen; vor jedem kaputten load() wieder gefüllt
+        auto reload = [&](const std::vector<char>& bytes)
+        {
+            writeFile(cacheFile, good);
+            CHECK(cache.load(&err) && cache.fileCount() > 0 && cache.sameTree(kTreeKey, index), "good cache not loaded");
+            writeFile(cacheFile, bytes);
+            err.clear();
+            return cache.load(&err);
+        };
+
+        // abgeschnitten / Müll nach gültigem Kopf: Fehler gemeldet, Cache leer
+        for (const std::size_t keep : { std::size_t(8), std::size_t(9), good.size() / 2, good.size() - 1 })
+        {
+            const std::vector<char> cut(good.begin(), good.begin() + (std::ptrdiff_t)keep);
+            CHECK(!reload(cut) && !err.empty(), "truncated to %zu bytes: load succeeded", keep);
+            checkEmpty(cache, extractor, index, "truncated cache");
+        }
+
+        std::vector<char> garbage(good.begin(), good.begin() + 8);
+        for (int i = 0; i < 64; ++i)
+            garbage.push_back(char(0xFF));
+        CHECK(!reload(garbage) && !err.empty(), "garbage after header: load succeeded");
+        checkEmpty(cache, extractor, index, "garbage cache");
+
+        // alte Version / fremde Datei: kein Fehler, nur leer
+        std::vector<char> oldVersion = good;
+        const std::uint32_t version = 0;
+        std::memcpy(oldVersion.data() + 4, &version, 4);
+        CHECK(reload(oldVersion), "old version: %s", err.c_str());
+        checkEmpty(cache, extractor, index, "old version");
+
+        std::vector<char> foreign = good;
+        foreign[0] ^= 0x20;
+        CHECK(reload(foreign), "foreign magic: %s", err.c_str());
+        checkEmpty(cache, extractor, index, "foreign magic");
+
+        // danach baut der nächste Lauf vollständig neu auf
+        const Run rebuilt = runPipeline(cache, tree.root(), extractor);
+        CHECK(!rebuilt.unchanged && rebuilt.stats.filesLoaded == rebuilt.stats.files,
+              "after broken cache: %s", rebuilt.stats.summary().c_str());
+        checkFacts(rebuilt, "rebuild after broken cache");
+
+        fs::remove(cacheFile);
+    }
+}
+
+int main()
+{
+    testIncremental();
+    testBrokenFile();
+    return test::testResult();
+}
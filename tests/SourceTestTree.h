@@ -0,0 +1,88 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "data/source/collect/SourceGroup.h"
+
+// Zufälliger Quellbaum für die Extractor-Tests: <root>/d<n>/_Common/<Stem>.h/.cpp
+// aus Fragmenten, die die Schema-Extractoren treffen (oder knapp verfehlen).
+namespace test
+{
+    class SourceTestTree
+    {
+    public:
+        explicit SourceTestTree(const std::string& name)
+            : m_root(std::filesystem::temp_directory_path() / name)
+        {
+        }
+
+        ~SourceTestTree()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_root, ec);
+        }
+
+        const std::filesystem::path& root() const { return m_root; }
+        const std::vector<data::source::SourceGroup>& groups() const { return m_groups; }
+
+        void generate(std::mt19937& rng, int dirs = 6, int maxFragments = 200)
+        {
+            static const char* const kFragments[] = {
+                "DrawIndexedPrimitive(", "DrawIndexedPrimitive \t(", "xDrawIndexedPrimitive(",
+                "D3DPT_TRIANGLELIST", "m_nStartVertex", "m_nPrimitiveCount", "m_nTextureID", "m_nTextureIDs",
+                "SetGroup(", "SetGroup  (", "_SetGroup(", "SetTextureEx(", "SetTextureEx",
+                "Render(pd3dDevice", "Render ( pd3dDevice", "Render(pd3d",
+                "struct MATERIAL_BLOCK {", "struct  MATERIAL_BLOCK\n{", "struct MATERIAL_BLOCKS {",
+                "int a;", "DWORD* p;", "D3DXVECTOR3 v[4];", "std :: string s;", "char& r;", "int;", "};",
+                "Read(p, sizeof(MATERIAL_BLOCK)*n);", "Read (p, sizeof ( MATERIAL_BLOCK ) * n) ;", "Read(x;",
+                "\n", "\r\n", " ", "\t", "x", "(", ")", ";", "\"q\\\"\"", "// c\n",
+            };
+            constexpr int kCount = int(sizeof(kFragments) / sizeof(kFragments[0]));
+            static const char* const kStems[] = { "Object3D", "Obj", "ModelObject", "Other" };
+
+            std::error_code ec;
+            std::filesystem::remove_all(m_root, ec);
+            m_groups.clear();
+
+            std::map<std::string, data::source::SourceGroup> byStem;
+            for (int d = 0; d < dirs; ++d)
+            {
+                for (const char* stem : kStems)
+                {
+                    for (const char* ext : { ".h", ".cpp" })
+                    {
+                        const std::filesystem::path rel = std::filesystem::path("d" + std::to_string(d)) / "_Common" /
+                                                          (std::string(stem) + ext);
+                        std::filesystem::create_directories((m_root / rel).parent_path());
+
+                        std::string text;
+                        const int n = int(rng() % std::uint32_t(maxFragments));
+                        for (int i = 0; i < n; ++i)
+                            text += kFragments[rng() % kCount];
+                        std::ofstream(m_root / rel, std::ios::binary) << text;
+
+                        data::source::SourceFileEntry f;
+                        f.absolutePath = m_root / rel;
+                        f.relativePath = rel;
+
+                        auto& g = byStem[stem];
+                        g.id = stem;
+                        g.files.push_back(f);
+                    }
+                }
+            }
+
+            for (auto& [stem, g] : byStem)
+                m_groups.push_back(std::move(g));
+        }
+
+    private:
+        std::filesystem::path m_root;
+        std::vector<data::source::SourceGroup> m_groups;
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal-Prüfmakros für die Programme unter tests/ (kein Framework).
+// CHECK zählt Fehlschläge weiter, main() gibt testResult() zurück.
+namespace test
+{
+    inline int& failures()
+    {
+        static int n = 0;
+        return n;
+    }
+
+    inline int testResult()
+    {
+        if (failures() == 0)
+            std::printf("OK\n");
+        else
+            std::printf("%d check(s) failed\n", failures());
+        return failures() == 0 ? 0 : 1;
+    }
+
+    // ctest: SKIP_RETURN_CODE
+    constexpr int kSkipped = 77;
+}
+
+#define CHECK(cond, ...)                                                   \
+    do                                                                     \
+    {                                                                      \
+        if (!(cond))                                                       \
+        {                                                                  \
+            ++test::failures();                                            \
+            std::printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #cond); \
+            std::printf(__VA_ARGS__);                                      \
+            std::printf("\n");                                             \
+        }                                                                  \
+    } while (0)
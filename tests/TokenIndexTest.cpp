@@ -0,0 +1,308 @@
+// TokenIndex/CppLexer auf einer Legacy-artigen Quelldatei: Identifier in
+// Kommentaren, Strings und Raw-Strings werden nicht indiziert, Code unter
+// "#if 0" ist markiert und verschiebt die Funktionsrümpfe nicht, Vorkommen
+// tragen die qualifizierte umschließende Funktion. Dazu DrawCallSchema (v2,
+// fragt den Index ab) auf derselben Datei und der Weg der Facts durch den
+// SourceCache (save, frische Instanz, load, nichts neu gelesen).
+
+#include "TestCheck.h"
+
+#include "core/source/cache/SourceCache.h"
+#include "core/source/extract/SourceExtract.h"
+#include "core/source/extract/schema/DrawCallSchemaExtractor.h"
+#include "core/source/extract/util/FactText.h"
+#include "core/source/extract/util/TextUnit.h"
+#include "core/source/index/CppLexer.h"
+#include "core/source/index/TokenIndexBuilder.h"
+#include "core/source/scan/SourceScanner.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    using namespace core::source;
+    using data::source::TokenIndex;
+
+    // Zeilennummern unten beziehen sich auf diesen Text
+    const char* const kObject3D =
+        "// DrawIndexedPrimitive( im Zeilenkommentar\n"                                       // 1
+        "/* D3DPT_TRIANGLELIST\n"                                                              // 2
+        "   m_nStartVertex */\n"                                                               // 3
+        "#include \"Object3D.h\"\n"                                                            // 4
+        "namespace legacy\n"                                                                   // 5
+        "{\n"                                                                                  // 6
+        "    class CObject3D\n"                                                                // 7
+        "    {\n"                                                                              // 8
+        "    public:\n"                                                                        // 9
+        "        int Count() const { return m_nStartVertex; }\n"                               // 10
+        "    };\n"                                                                             // 11
+        "}\n"                                                                                  // 12
+        "static const char* kText = \"DrawIndexedPrimitive( m_nTextureID\";\n"                 // 13
+        "static const char* kRaw = R\"x(DrawIndexedPrimitive( )\" D3DPT_TRIANGLELIST)x\";\n"   // 14
+        "static const char kQuote = '\"';\n"                                                   // 15
+        "void CObject3D::Render(LPDIRECT3DDEVICE9 pd3dDevice)\n"                               // 16
+        "{\n"                                                                                  // 17
+        "#if 0\n"                                                                              // 18
+        "    if (old) {\n"                                                                     // 19
+        "        pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, 0, 0, 0, 0, 0);\n"      // 20
+        "#else\n"                                                                              // 21
+        "    if (cur) {\n"                                                                     // 22
+        "#endif\n"                                                                             // 23
+        "        pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, m_nStartVertex,\n"       // 24
+        "                                         0, 0, 0, 0); // m_nPrimitiveCount\n"         // 25
+        "    }\n"                                                                              // 26
+        "}\n"                                                                                  // 27
+        "CObject3D::CObject3D() : m_a{ 1 }, m_b()\n"                                           // 28
+        "{\n"                                                                                  // 29
+        "    Init();\n"                                                                        // 30
+        "}\n"                                                                                  // 31
+        "CObject3D::~CObject3D() { Release(); }\n"                                             // 32
+        "bool CObject3D::operator==(const CObject3D& o) const { return Equal(o); }\n"          // 33
+        "template <class T>\n"                                                                 // 34
+        "auto Helper(T t) -> decltype(t) { return Clamp(t); }\n";                              // 35
+
+    const char* const kModelObject =
+        "/* Render(pd3dDevice) */\n"                                                           // 1
+        "void CModelObject::Render(LPDIRECT3DDEVICE9 pd3dDevice)\n"                            // 2
+        "{\n"                                                                                  // 3
+        "    const char* s = \"Render(pd3dDevice\";\n"                                         // 4
+        "    m_pObject3D->Render( pd3dDevice, &m );\n"                                         // 5
+        "}\n";                                                                                 // 6
+
+    class TempTree
+    {
+    public:
+        explicit TempTree(const std::string& name)
+            : m_root(fs::temp_directory_path() / name)
+        {
+            std::error_code ec;
+            fs::remove_all(m_root, ec);
+        }
+
+        ~TempTree()
+        {
+            std::error_code ec;
+            fs::remove_all(m_root, ec);
+        }
+
+        const fs::path& root() const { return m_root; }
+
+        data::source::SourceFileEntry write(const fs::path& rel, const char* text)
+        {
+            fs::create_directories((m_root / rel).parent_path());
+            std::ofstream(m_root / rel, std::ios::binary) << text;
+
+            data::source::SourceFileEntry f;
+            f.absolutePath = m_root / rel;
+            f.relativePath = rel;
+            return f;
+        }
+
+    private:
+        fs::path m_root;
+    };
+
+    std::string functionOf(const TokenIndex& index, const data::source::TokenOccurrence& occ)
+    {
+        const auto* fn = index.functionOf(occ);
+        return fn ? fn->name : "-";
+    }
+
+    void checkOccurrences(const TokenIndex& index, const char* name,
+                          const std::vector<std::uint32_t>& lines,
+                          const std::vector<std::string>& functions,
+                          const std::vector<bool>& disabled)
+    {
+        const auto& occs = index.find(name);
+        CHECK(occs.size() == lines.size(), "%s: %zu occurrences, expected %zu", name, occs.size(), lines.size());
+        if (occs.size() != lines.size())
+            return;
+
+        for (std::size_t i = 0; i < occs.size(); ++i)
+        {
+            CHECK(occs[i].line == lines[i], "%s #%zu: line %u, expected %u", name, i, occs[i].line, lines[i]);
+            CHECK(functionOf(index, occs[i]) == functions[i], "%s #%zu: function %s, expected %s",
+                  name, i, functionOf(index, occs[i]).c_str(), functions[i].c_str());
+            CHECK(occs[i].disabled == disabled[i], "%s #%zu: disabled=%d", name, i, int(occs[i].disabled));
+        }
+    }
+
+    void testLexer()
+    {
+        using index::CppLexer;
+        using index::TokenKind;
+
+        const std::string text = "a // b\n/* c */ \"d\\\"e\" R\"x(f)\" g)x\" 'h'\n#define i \\\n j\nk";
+        std::vector<index::Token> toks;
+        CppLexer::tokenize(text, toks);
+
+        std::vector<std::string> got;
+        for (const auto& t : toks)
+            got.emplace_back(CppLexer::text(text, t));
+
+        const std::vector<std::string> want = { "a", "\"d\\\"e\"", "R\"x(f)\" g)x\"", "'h'", "#", "define", "i", "j", "k" };
+        CHECK(got == want, "lexer: %zu tokens, expected %zu", got.size(), want.size());
+        if (got != want)
+            return;
+
+        CHECK(toks[1].kind == TokenKind::String && toks[2].kind == TokenKind::String && toks[3].kind == TokenKind::Char,
+              "lexer: literal kinds");
+        CHECK(!toks[3].directive && toks[4].directive && toks[7].directive && !toks[8].directive,
+              "lexer: directive flags (continuation line)");
+        CHECK(toks[0].line == 1 && toks[1].line == 2 && toks[4].line == 3 && toks[7].line == 4 && toks[8].line == 5, "lexer: line numbers");
+    }
+
+    void testScopes()
+    {
+        TempTree tree("flyff_token_index_test");
+        const auto file = tree.write("_Common/Object3D.cpp", kObject3D);
+        const auto unit = extract::util::TextUnit::load(file.absolutePath, file.relativePath);
+
+        TokenIndex index;
+        CHECK(index::TokenIndexBuilder::addFile(file, unit, index) == 0, "first file id");
+
+        // nur echter Code, Kommentare/Strings/Raw-Strings fehlen
+        checkOccurrences(index, "DrawIndexedPrimitive", { 20, 24 },
+                         { "CObject3D::Render", "CObject3D::Render" }, { true, false });
+        checkOccurrences(index, "D3DPT_TRIANGLELIST", { 24 }, { "CObject3D::Render" }, { false });
+        checkOccurrences(index, "D3DPT_TRIANGLESTRIP", { 20 }, { "CObject3D::Render" }, { true });
+        checkOccurrences(index, "m_nStartVertex", { 10, 24 },
+                         { "legacy::CObject3D::Count", "CObject3D::Render" }, { false, false });
+        checkOccurrences(index, "m_nTextureID", {}, {}, {});
+        checkOccurrences(index, "m_nPrimitiveCount", {}, {}, {});
+        checkOccurrences(index, "old", { 19 }, { "CObject3D::Render" }, { true });
+        checkOccurrences(index, "cur", { 22 }, { "CObject3D::Render" }, { false });
+        checkOccurrences(index, "kText", { 13 }, { "-" }, { false });
+
+        // Qualifizierung über Namespace/Class und Out-of-line-Definitionen
+        checkOccurrences(index, "Init", { 30 }, { "CObject3D::CObject3D" }, { false });
+        checkOccurrences(index, "Release", { 32 }, { "CObject3D::~CObject3D" }, { false });
+        checkOccurrences(index, "Equal", { 33 }, { "CObject3D::operator==" }, { false });
+        checkOccurrences(index, "Clamp", { 35 }, { "Helper" }, { false });
+
+        std::vector<std::string> names;
+        for (const auto& fn : index.functions())
+            names.push_back(fn.name + ":" + std::to_string(fn.line) + "-" + std::to_string(fn.endLine));
+        const std::vector<std::string> want = {
+            "legacy::CObject3D::Count:10-10", "CObject3D::Render:16-27", "CObject3D::CObject3D:28-31",
+            "CObject3D::~CObject3D:32-32", "CObject3D::operator==:33-33", "Helper:35-35",
+        };
+        CHECK(names == want, "functions: %zu, expected %zu", names.size(), want.size());
+        for (std::size_t i = 0; i < names.size() && names != want; ++i)
+            std::printf("  function %zu: %s\n", i, names[i].c_str());
+
+        // zweite Datei: Indizes laufen weiter
+        const auto second = tree.write("_Common/ModelObject.cpp", kModelObject);
+        const auto unit2 = extract::util::TextUnit::load(second.absolutePath, second.relativePath);
+        CHECK(index::TokenIndexBuilder::addFile(second, unit2, index) == 1, "second file id");
+        const auto& render = index.find("Render");
+        CHECK(render.size() == 3 && render[2].file == 1 && render[2].line == 5 &&
+              functionOf(index, render[2]) == "CModelObject::Render",
+              "Render: %zu occurrences", render.size());
+    }
+
+    // Facts als Text (Tabellen aufgelöst), zum Vergleich über den Cache
+    std::vector<std::string> describe(const extract::ExtractFacts& facts)
+    {
+        extract::util::FactText text(facts);
+        std::vector<std::string> out;
+        for (const auto& f : facts.facts)
+            out.push_back(std::string(extract::factTypeName(f.type)) + " " + facts.fileOf(f).relativePath + ":" +
+                          std::to_string(f.line) + " [" + std::string(text.evidence(f)) + "]");
+        return out;
+    }
+
+    void testDrawCall()
+    {
+        TempTree tree("flyff_token_index_drawcall");
+        data::source::SourceGroup g;
+        g.id = "Object3D";
+        g.files.push_back(tree.write("_Common/Object3D.cpp", kObject3D));
+        g.files.push_back(tree.write("_Common/ModelObject.cpp", kModelObject));
+
+        const extract::rules::DrawCallSchemaExtractor drawCall;
+        extract::ExtractFacts facts;
+        drawCall.extract({ g }, facts);
+
+        const std::vector<std::string> want = {
+            "DrawCall.Invoke.DrawIndexedPrimitive _Common/Object3D.cpp:24 [DrawIndexedPrimitive(]",
+            "DrawCall.PerSubMesh _Common/Object3D.cpp:24 [DrawIndexedPrimitive(]",
+            "DrawCall.PrimitiveType.TriangleList _Common/Object3D.cpp:24 [D3DPT_TRIANGLELIST]",
+            "DrawCall.Mapping.MaterialBlockField _Common/Object3D.cpp:10 [m_nStartVertex]",
+            "DrawCall.Mapping.MaterialBlockField _Common/Object3D.cpp:24 [m_nStartVertex]",
+            "DrawCall.Delegation.ModelObjectRender _Common/ModelObject.cpp:5 [Render( pd3dDevice]",
+        };
+        const auto got = describe(facts);
+        CHECK(got == want, "DrawCall: %zu facts, expected %zu", got.size(), want.size());
+        for (std::size_t i = 0; i < got.size() && got != want; ++i)
+            std::printf("  fact %zu: %s\n", i, got[i].c_str());
+    }
+
+    // Facts aus dem Index landen im SourceCache und kommen nach save/load unverändert zurück
+    void testCacheRoundTrip()
+    {
+        TempTree tree("flyff_token_index_cache");
+        tree.write("_Common/Object3D.cpp", kObject3D);
+        tree.write("_Common/ModelObject.cpp", kModelObject);
+        const fs::path cacheFile = tree.root() / "cache" / "sourcecache.bin";
+
+        SourceScanner::Settings scan;
+        scan.sourceRoot = tree.root();
+        data::source::SourceIndexList index;
+        SourceScanner(scan).scan(index);
+
+        data::source::SourceGroup g;
+        g.id = "Object3D";
+        for (const auto& f : index.files())
+            g.files.push_back(f);
+        const std::vector<data::source::SourceGroup> groups = { g };
+
+        extract::SourceExtractor::Settings settings;
+        settings.enableSubMeshSchema = false;
+        const extract::SourceExtractor extractor(settings);
+
+        std::vector<std::string> first;
+        {
+            cache::SourceCache cache(cacheFile);
+            std::string err;
+            CHECK(cache.load(&err), "load: %s", err.c_str());
+
+            extract::ExtractFacts facts;
+            extract::SourceExtractor::Stats stats;
+            extractor.extract(groups, facts, &cache, &stats);
+            CHECK(stats.filesLoaded == 2, "first run: %s", stats.summary().c_str());
+            first = describe(facts);
+
+            cache.storeResult(facts);
+            CHECK(cache.save(&err), "save: %s", err.c_str());
+        }
+
+        cache::SourceCache cache(cacheFile);
+        std::string err;
+        CHECK(cache.load(&err), "reload: %s", err.c_str());
+
+        extract::ExtractFacts restored;
+        CHECK(cache.restoreResult(extractor.extractorInfos(), restored) && describe(restored) == first,
+              "restored result differs");
+
+        extract::ExtractFacts facts;
+        extract::SourceExtractor::Stats stats;
+        extractor.extract(groups, facts, &cache, &stats);
+        CHECK(stats.filesLoaded == 0 && stats.itemsReused == 2, "cached run: %s", stats.summary().c_str());
+        CHECK(describe(facts) == first && first.size() == 6, "cached run: %zu facts, first run %zu",
+              facts.size(), first.size());
+    }
+}
+
+int main()
+{
+    testLexer();
+    testScopes();
+    testDrawCall();
+    testCacheRoundTrip();
+    return test::testResult();
+}